@@ -697,6 +697,13 @@ proc generate_lwip_opts {libhandle} {
 	puts $lwipopts_fd "\#define LWIP_CHKSUM_ALGORITHM 3"
 	puts $lwipopts_fd ""
 
+	# GEM per queue receive buffers are custom pbufs
+	set emacps_rx_queues [common::get_property CONFIG.emacps_rx_queues $libhandle]
+	if {$emacps_rx_queues > 1} {
+		puts $lwipopts_fd "\#define LWIP_SUPPORT_CUSTOM_PBUF 1"
+		puts $lwipopts_fd ""
+	}
+
 	# UDP options
 	set lwip_udp 		[expr [common::get_property CONFIG.lwip_udp $libhandle] == true]
 	set udp_ttl 		[common::get_property CONFIG.udp_ttl $libhandle]
@@ -1574,11 +1581,15 @@ proc generate_adapterconfig_include {libhandle} {
 		puts $fd "\#define XLWIP_CONFIG_N_TX_COALESCE $ncoalesce"
 		set ncoalesce [common::get_property CONFIG.n_rx_coalesce $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_RX_COALESCE $ncoalesce"
+		set nbatch [common::get_property CONFIG.n_tx_batch $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_N_TX_BATCH $nbatch"
 		puts $fd ""
 	}
 	if {$have_ps_ethernet == 1} {
 		set emacnum [common::get_property CONFIG.emac_number $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_EMAC_NUMBER $emacnum"
+		set rxqueues [common::get_property CONFIG.emacps_rx_queues $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_EMACPS_RX_QUEUES $rxqueues"
 		set ndesc [common::get_property CONFIG.n_tx_descriptors $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_TX_DESC $ndesc"
 		set ndesc [common::get_property CONFIG.n_rx_descriptors $libhandle]
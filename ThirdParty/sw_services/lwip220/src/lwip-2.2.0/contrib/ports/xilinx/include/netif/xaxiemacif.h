@@ -57,6 +57,11 @@ extern "C" {
 #include "netif/xpqueue.h"
 #include "xlwipconfig.h"
 
+/* Maximum number of frames handed to the TX DMA with one tail pointer update */
+#ifndef XLWIP_CONFIG_N_TX_BATCH
+#define XLWIP_CONFIG_N_TX_BATCH 1
+#endif
+
 #if XLWIP_CONFIG_INCLUDE_AXIETH_ON_ZYNQ == 1
 #define AXIDMA_TX_INTR_PRIORITY_SET_IN_GIC      0xA0
 #define AXIDMA_RX_INTR_PRIORITY_SET_IN_GIC      0xA0
@@ -100,6 +105,14 @@ typedef struct {
 	void *rx_bdspace;
 	void *tx_bdspace;
 
+#if !defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_FIFO) && \
+	!defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA)
+	/* TX BDs filled but not yet handed to the DMA (batched transmit) */
+	XAxiDma_Bd *tx_batch_bdset;
+	u32_t tx_batch_bds;
+	u32_t tx_batch_frames;
+#endif
+
 	enum ethernet_link_status eth_link_status;
 } xaxiemacif_s;
 
@@ -127,6 +140,7 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p,
 #else
 XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p);
 #endif
+XStatus axidma_tx_batch_flush(xaxiemacif_s *xaxiemacif);
 #endif
 #endif
 
@@ -112,6 +112,19 @@ extern "C" {
 
 #define MAX_FRAME_SIZE_JUMBO (XEMACPS_MTU_JUMBO + XEMACPS_HDR_SIZE + XEMACPS_TRL_SIZE)
 
+/* Number of GEM queues used for reception. Queue 0 receives everything that
+ * is not steered to a priority queue with xemacpsif_rxq_steer().
+ */
+#ifdef XLWIP_CONFIG_EMACPS_RX_QUEUES
+#define XEMACPSIF_RX_QUEUES XLWIP_CONFIG_EMACPS_RX_QUEUES
+#else
+#define XEMACPSIF_RX_QUEUES 1
+#endif
+
+#if (XEMACPSIF_RX_QUEUES < 1) || (XEMACPSIF_RX_QUEUES > 2)
+#error "GEM lwIP adapter supports 1 or 2 receive queues"
+#endif
+
 void 	xemacpsif_setmac(u32_t index, u8_t *addr);
 u8_t*	xemacpsif_getmac(u32_t index);
 err_t 	xemacpsif_init(struct netif *netif);
@@ -134,6 +147,13 @@ typedef struct {
 	void *rx_bdspace;
 	void *tx_bdspace;
 
+#if XEMACPSIF_RX_QUEUES > 1
+	/* receive rings of the priority queues, queue 0 uses emacps.RxBdRing */
+	XEmacPs_BdRing rxq_ring[XEMACPSIF_RX_QUEUES - 1];
+	void *rxq_bdspace[XEMACPSIF_RX_QUEUES - 1];
+#endif
+	u32_t n_rx_queues;
+
 	unsigned int last_rx_frms_cntr;
 	enum ethernet_link_status eth_link_status;
 } xemacpsif_s;
@@ -173,6 +193,8 @@ void init_emacps_on_error (xemacpsif_s *xemacps, struct netif *netif);
 void clean_dma_txdescs(struct xemac_s *xemac);
 void resetrx_on_no_rxdata(xemacpsif_s *xemacpsif);
 void reset_dma(struct xemac_s *xemac);
+s32_t xemacpsif_rxq_steer(struct netif *netif, u8_t index, u8_t queue,
+			s32_t udp_port, s32_t tos);
 
 #ifdef __cplusplus
 }
@@ -38,16 +38,25 @@ extern "C" {
 
 #include "lwip/debug.h"
 
-#define PQ_QUEUE_SIZE 4096
-
+/*
+ * Single producer, single consumer queue used to hand packets from the
+ * interrupt handler to the thread running the stack. The producer only
+ * writes head and the consumer only writes tail, so neither side needs to
+ * mask interrupts. Head and tail run freely and are masked on access,
+ * so pq_create_queue() rounds the requested size up to a power of two.
+ */
 typedef struct {
-	void *data[PQ_QUEUE_SIZE];
-	int head, tail, len;
+	u32_t head;	/* next slot to fill, written by the producer only */
+	u32_t tail;	/* next slot to drain, written by the consumer only */
+	u32_t size;	/* number of slots, a power of two */
+	void *data[];
 } pq_queue_t;
 
-pq_queue_t*	pq_create_queue();
+pq_queue_t*	pq_create_queue(u32_t size);
 int 		pq_enqueue(pq_queue_t *q, void *p);
+int		pq_enqueue_batch(pq_queue_t *q, void **p, int n);
 void*		pq_dequeue(pq_queue_t *q);
+int		pq_dequeue_batch(pq_queue_t *q, void **p, int n);
 int		pq_qlength(pq_queue_t *q);
 
 #ifdef __cplusplus
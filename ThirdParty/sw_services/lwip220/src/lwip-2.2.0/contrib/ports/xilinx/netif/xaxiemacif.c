@@ -206,6 +206,8 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 			lwip_stats.link.drop++;
 #endif
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA
+			/* batched frames hold BDs until they are handed to h/w */
+			axidma_tx_batch_flush(xaxiemacif);
 			process_sent_bds(txring);
 #endif
 			count--;
@@ -251,11 +253,7 @@ static struct pbuf *low_level_input(struct netif *netif)
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	struct pbuf *p;
 
-	/* see if there is data to process */
-	if (pq_qlength(xaxiemacif->recv_q) == 0)
-		return NULL;
-
-	/* return one packet from receive q */
+	/* return one packet from receive q, NULL if there is none */
 	p = (struct pbuf *)pq_dequeue(xaxiemacif->recv_q);
 	return p;
 }
@@ -293,16 +291,14 @@ int xaxiemacif_input(struct netif *netif)
 {
 	struct eth_hdr *ethhdr;
 	struct pbuf *p;
-	SYS_ARCH_DECL_PROTECT(lev);
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
-		/* move received packet into a new pbuf */
-		SYS_ARCH_PROTECT(lev);
+		/* move received packet into a new pbuf, the receive queue
+		 * is lock free so interrupts stay enabled */
 		p = low_level_input(netif);
-		SYS_ARCH_UNPROTECT(lev);
 
 		/* no packet could be read, silently ignore this */
 		if (p == NULL)
@@ -369,7 +365,8 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_axi_ethernet;
 
 	xaxiemacif->send_q = NULL;
-	xaxiemacif->recv_q = pq_create_queue();
+	/* a full ring of frames waiting for the stack while it is refilled */
+	xaxiemacif->recv_q = pq_create_queue(2 * XLWIP_CONFIG_N_RX_DESC);
 	if (!xaxiemacif->recv_q)
 		return ERR_MEM;
 
@@ -309,6 +309,8 @@ static void axidma_send_handler(void *arg)
 	/* If Transmit done interrupt is asserted, process completed BD's */
 	if (irq_status & (XAXIDMA_IRQ_DELAY_MASK | XAXIDMA_IRQ_IOC_MASK)) {
 		process_sent_bds(txringptr);
+		/* start the frames that were batched while the DMA was busy */
+		axidma_tx_batch_flush(xaxiemacif);
 	}
 
 	XAxiDma_BdRingIntEnable(txringptr, XAXIDMA_IRQ_ALL_MASK);
@@ -526,6 +528,96 @@ s32_t process_sent_bds(XAxiDma_BdRing *txring)
 	return (XAxiDma_BdRingFree(txring, n_bds, txbdset));
 }
 
+#if LWIP_PARTIAL_CSUM_OFFLOAD_TX==1
+/*
+ * Programs the partial checksum fields of the first BD of a frame. The h/w
+ * sums the frame from the start of the TCP (or UDP) header, adds the pseudo
+ * header sum given as init value and inserts the result into the header.
+ * Partial checksum is disabled for all other frames, including IP fragments,
+ * as the BD is reused from an earlier frame.
+ */
+static void update_partial_cksum_offload(XAxiDma_Bd *txbd, struct pbuf *p)
+{
+	struct ethip_hdr *ehdr = p->payload;
+	ip4_addr_t src, dest;
+	u16_t iphdr_len, proto_len, proto_offset, csum_insert_offset;
+	u16_t csum;
+	u8_t proto;
+
+	bd_csum_disable(txbd);
+
+	if (p->len <= sizeof(struct ethip_hdr) ||
+			htons(ehdr->eth.type) != ETHTYPE_IP ||
+			(IPH_OFFSET(&ehdr->ip) & PP_HTONS(IP_OFFMASK | IP_MF)) != 0) {
+		return;
+	}
+
+	/* insert checksum at offset 16 for TCP, 6 for UDP */
+	proto = IPH_PROTO(&ehdr->ip);
+	if (proto == IP_PROTO_TCP) {
+		csum_insert_offset = 16;
+#if !CHECKSUM_GEN_UDP
+	} else if (proto == IP_PROTO_UDP) {
+		csum_insert_offset = 6;
+#endif
+	} else {
+		return;
+	}
+
+	iphdr_len = IPH_HL_BYTES(&ehdr->ip);
+	proto_offset = XAE_HDR_SIZE + iphdr_len;
+	/* use the IP length, the frame may carry trailing padding */
+	proto_len = lwip_ntohs(IPH_LEN(&ehdr->ip)) - iphdr_len;
+
+	/* pseudo header only: no bytes of the pbuf are summed */
+	ip4_addr_copy(src, ehdr->ip.src);
+	ip4_addr_copy(dest, ehdr->ip.dest);
+	csum = inet_chksum_pseudo_partial(p, proto, proto_len, 0, &src, &dest);
+
+	bd_csum_set(txbd, proto_offset, proto_offset + csum_insert_offset,
+			lwip_htons((u16_t)~csum));
+}
+#endif
+
+/*
+ * Hands the BDs of all batched frames to the DMA with a single tail pointer
+ * update. Called from the TX completion handler, when the batch is full and
+ * whenever the caller runs out of BDs.
+ */
+XStatus axidma_tx_batch_flush(xaxiemacif_s *xaxiemacif)
+{
+	XAxiDma_BdRing *txring = XAxiDma_GetTxRing(&xaxiemacif->axidma);
+	XAxiDma_Bd *txbd;
+	XStatus status;
+	u32_t i;
+
+	if (xaxiemacif->tx_batch_bds == 0) {
+		return XST_SUCCESS;
+	}
+
+	status = XAxiDma_BdRingToHw(txring, xaxiemacif->tx_batch_bds,
+				    xaxiemacif->tx_batch_bdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD batch\r\n"));
+		/* drop the batch, its BDs are the last ones allocated */
+		for (i = 0, txbd = xaxiemacif->tx_batch_bdset;
+				i < xaxiemacif->tx_batch_bds; i++) {
+			pbuf_free((struct pbuf *)(UINTPTR)XAxiDma_BdGetId(txbd));
+			txbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(txring, txbd);
+		}
+		XAxiDma_BdRingUnAlloc(txring, xaxiemacif->tx_batch_bds,
+				      xaxiemacif->tx_batch_bdset);
+#if LINK_STATS
+		lwip_stats.link.drop += xaxiemacif->tx_batch_frames;
+#endif
+	}
+
+	xaxiemacif->tx_batch_bds = 0;
+	xaxiemacif->tx_batch_frames = 0;
+
+	return status;
+}
+
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p,
         u32_t block_till_tx_complete, u32_t *to_block_index)
@@ -600,41 +692,7 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 	}
 #endif
 #if LWIP_PARTIAL_CSUM_OFFLOAD_TX==1
-	bd_csum_disable(txbdset);
-	if (p->len > sizeof(struct ethip_hdr)) {
-		struct ethip_hdr *ehdr = p->payload;
-		u8_t proto = IPH_PROTO(&ehdr->ip);
-
-		/* check if it is a TCP packet */
-		if (htons(ehdr->eth.type) == ETHTYPE_IP && proto ==
-											IP_PROTO_TCP) {
-			u32_t iphdr_len, csum_insert_offset;
-			u16_t tcp_len;	/* TCP header length + data length in bytes */
-			u16_t csum_init = 0;
-			u16_t tcp_payload_offset;
-
-			/* determine length of IP header */
-			iphdr_len = (IPH_HL(&ehdr->ip) * 4);
-
-			tcp_payload_offset = XAE_HDR_SIZE + iphdr_len;
-			tcp_len = p->tot_len - tcp_payload_offset;
-
-			/* insert checksum at offset 16 for TCP, 6 for UDP */
-			if (proto == IP_PROTO_TCP)
-				csum_insert_offset = tcp_payload_offset + 16;
-			else if (proto == IP_PROTO_UDP)
-				csum_insert_offset = tcp_payload_offset + 6;
-			else
-				csum_insert_offset = 0;
-			/* compute pseudo header checksum value */
-			csum_init = inet_chksum_pseudo(NULL,
-					(ip_addr_t *)&ehdr->ip.src,
-					(ip_addr_t *)&ehdr->ip.dest, proto, tcp_len);
-			/* init buffer descriptor */
-			bd_csum_set(txbdset, tcp_payload_offset,
-			csum_insert_offset, htons(~csum_init));
-		}
-	}
+	update_partial_cksum_offload(txbdset, p);
 #endif
 
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
@@ -644,8 +702,27 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
     }
 #endif
 
-	/* enq to h/w */
-	return XAxiDma_BdRingToHw(txring, n_pbufs, txbdset);
+	/* queue the frame behind the ones already batched */
+	if (xaxiemacif->tx_batch_bds == 0) {
+		xaxiemacif->tx_batch_bdset = txbdset;
+	}
+	xaxiemacif->tx_batch_bds += n_pbufs;
+	xaxiemacif->tx_batch_frames++;
+
+	/* While the DMA is busy its completion interrupt flushes the batch.
+	 * Flush right away when it is idle, when the batch is full or when
+	 * the caller waits for this frame.
+	 */
+	if (txring->HwCnt == 0 ||
+			xaxiemacif->tx_batch_frames >= XLWIP_CONFIG_N_TX_BATCH
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+			|| block_till_tx_complete == 1
+#endif
+			) {
+		return axidma_tx_batch_flush(xaxiemacif);
+	}
+
+	return XST_SUCCESS;
 }
 
 XStatus init_axi_dma(struct xemac_s *xemac)
@@ -701,6 +778,10 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 				__FILE__, __LINE__);
 		return ERR_IF;
 	}
+	xaxiemacif->tx_batch_bdset = NULL;
+	xaxiemacif->tx_batch_bds = 0;
+	xaxiemacif->tx_batch_frames = 0;
+
 	/* initialize DMA */
 #ifndef SDT
 	baseaddr = xaxiemacif->axi_ethernet.Config.AxiDevBaseAddress;
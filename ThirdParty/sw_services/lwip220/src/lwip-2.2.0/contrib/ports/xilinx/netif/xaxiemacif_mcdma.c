@@ -108,12 +108,12 @@ static inline void bd_csum_enable(XMcdma_Bd *bd)
 
 static inline void bd_csum_disable(XMcdma_Bd *bd)
 {
-	XMcDma_BdSetAppWord(bd, BD_USR0_OFFSET, ~PARTIAL_CSUM_ENABLE);
+	XMcDma_BdSetAppWord(bd, BD_USR0_OFFSET, 0);
 }
 
 static inline void bd_fullcsum_disable(XMcdma_Bd *bd)
 {
-	XMcDma_BdSetAppWord(bd, BD_USR0_OFFSET, ~FULL_CSUM_ENABLE);
+	XMcDma_BdSetAppWord(bd, BD_USR0_OFFSET, 0);
 }
 
 static inline void bd_fullcsum_enable(XMcdma_Bd *bd)
@@ -489,42 +489,48 @@ s32_t process_sent_bds(XMcdma_ChanCtrl *Tx_Chan)
 }
 
 #if LWIP_PARTIAL_CSUM_OFFLOAD_TX==1
+/*
+ * Programs the partial checksum fields of the first BD of a frame, see
+ * xaxiemacif_dma.c. IP fragments are left to the stack.
+ */
 static void update_partial_cksum_offload(XMcdma_Bd *txbdset, struct pbuf *p)
 {
-	if (p->len > sizeof(struct ethip_hdr)) {
-		struct ethip_hdr *ehdr = p->payload;
-		u8_t proto = IPH_PROTO(&ehdr->ip);
-
-		/* check if it is a TCP packet */
-		if (htons(ehdr->eth.type) == ETHTYPE_IP && proto ==
-				IP_PROTO_TCP) {
-			u32_t iphdr_len, csum_insert_offset;
-			u16_t tcp_len;	/* TCP header length + data length in bytes */
-			u16_t csum_init = 0;
-			u16_t tcp_payload_offset;
-
-			/* determine length of IP header */
-			iphdr_len = (IPH_HL(&ehdr->ip) * 4);
-
-			tcp_payload_offset = XAE_HDR_SIZE + iphdr_len;
-			tcp_len = p->tot_len - tcp_payload_offset;
-
-			/* insert checksum at offset 16 for TCP, 6 for UDP */
-			if (proto == IP_PROTO_TCP)
-				csum_insert_offset = tcp_payload_offset + 16;
-			else if (proto == IP_PROTO_UDP)
-				csum_insert_offset = tcp_payload_offset + 6;
-			else
-				csum_insert_offset = 0;
-			/* compute pseudo header checksum value */
-			csum_init = ip_chksum_pseudo(NULL, proto, tcp_len,
-					(ip_addr_t *)&ehdr->ip.src,
-					(ip_addr_t *)&ehdr->ip.dest);
-			/* init buffer descriptor */
-			bd_csum_set(txbdset, tcp_payload_offset,
-					csum_insert_offset, htons(~csum_init));
-		}
+	struct ethip_hdr *ehdr = p->payload;
+	ip4_addr_t src, dest;
+	u16_t iphdr_len, proto_len, proto_offset, csum_insert_offset;
+	u16_t csum;
+	u8_t proto;
+
+	if (p->len <= sizeof(struct ethip_hdr) ||
+			htons(ehdr->eth.type) != ETHTYPE_IP ||
+			(IPH_OFFSET(&ehdr->ip) & PP_HTONS(IP_OFFMASK | IP_MF)) != 0) {
+		return;
 	}
+
+	/* insert checksum at offset 16 for TCP, 6 for UDP */
+	proto = IPH_PROTO(&ehdr->ip);
+	if (proto == IP_PROTO_TCP) {
+		csum_insert_offset = 16;
+#if !CHECKSUM_GEN_UDP
+	} else if (proto == IP_PROTO_UDP) {
+		csum_insert_offset = 6;
+#endif
+	} else {
+		return;
+	}
+
+	iphdr_len = IPH_HL_BYTES(&ehdr->ip);
+	proto_offset = XAE_HDR_SIZE + iphdr_len;
+	proto_len = lwip_ntohs(IPH_LEN(&ehdr->ip)) - iphdr_len;
+
+	/* compute pseudo header checksum value */
+	ip4_addr_copy(src, ehdr->ip.src);
+	ip4_addr_copy(dest, ehdr->ip.dest);
+	csum = inet_chksum_pseudo_partial(p, proto, proto_len, 0, &src, &dest);
+
+	/* init buffer descriptor */
+	bd_csum_set(txbdset, proto_offset, proto_offset + csum_insert_offset,
+			lwip_htons((u16_t)~csum));
 }
 #endif
 
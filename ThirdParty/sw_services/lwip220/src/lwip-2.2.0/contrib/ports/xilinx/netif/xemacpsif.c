@@ -218,11 +218,7 @@ static struct pbuf * low_level_input(struct netif *netif)
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 	struct pbuf *p;
 
-	/* see if there is data to process */
-	if (pq_qlength(xemacpsif->recv_q) == 0)
-		return NULL;
-
-	/* return one packet from receive q */
+	/* return one packet from receive q, NULL if there is none */
 	p = (struct pbuf *)pq_dequeue(xemacpsif->recv_q);
 	return p;
 }
@@ -260,16 +256,14 @@ s32_t xemacpsif_input(struct netif *netif)
 {
 	struct eth_hdr *ethhdr;
 	struct pbuf *p;
-	SYS_ARCH_DECL_PROTECT(lev);
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
-		/* move received packet into a new pbuf */
-		SYS_ARCH_PROTECT(lev);
+		/* move received packet into a new pbuf, the receive queue
+		 * is lock free so interrupts stay enabled */
 		p = low_level_input(netif);
-		SYS_ARCH_UNPROTECT(lev);
 
 		/* no packet could be read, silently ignore this */
 		if (p == NULL) {
@@ -359,7 +353,12 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_emacps;
 
 	xemacpsif->send_q = NULL;
-	xemacpsif->recv_q = pq_create_queue();
+	/*
+	 * Each receive queue can have a full ring of frames waiting for the
+	 * stack while the ring is refilled once more.
+	 */
+	xemacpsif->recv_q = pq_create_queue(2 * XEMACPSIF_RX_QUEUES *
+						XLWIP_CONFIG_N_RX_DESC);
 	if (!xemacpsif->recv_q)
 		return ERR_MEM;
 
@@ -32,6 +32,7 @@
 #include "lwipopts.h"
 #include "lwip/stats.h"
 #include "lwip/sys.h"
+#include "lwip/memp.h"
 #include "lwip/inet_chksum.h"
 
 #include "netif/xadapter.h"
@@ -67,7 +68,7 @@
 
 /* A max of 4 different ethernet interfaces are supported */
 static UINTPTR tx_pbufs_storage[4*XLWIP_CONFIG_N_TX_DESC];
-static UINTPTR rx_pbufs_storage[4*XLWIP_CONFIG_N_RX_DESC];
+static UINTPTR rx_pbufs_storage[4*XEMACPSIF_RX_QUEUES*XLWIP_CONFIG_N_RX_DESC];
 
 static s32_t emac_intr_num;
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
@@ -123,6 +124,94 @@ u8_t emac_bd_space[0x100000] __attribute__ ((aligned (0x100000)));
 static volatile u32_t bd_space_index = 0;
 static volatile u32_t bd_space_attr_set = 0;
 
+#ifdef ZYNQMP_USE_JUMBO
+#define RX_PBUF_SIZE	MAX_FRAME_SIZE_JUMBO
+#else
+#define RX_PBUF_SIZE	XEMACPS_MAX_FRAME_SIZE
+#endif
+
+#if XEMACPSIF_RX_QUEUES > 1
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "GEM receive queues need LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+/******************************************************************************
+ * With more than one receive queue, the receive buffers of each queue of each
+ * GEM come from a pool of their own, so that bulk traffic on queue 0 or on
+ * another GEM cannot starve a priority queue of buffers, and the buffers are
+ * passed to the stack as custom pbufs without copying. Pools are only
+ * declared for the GEM instances present in xparameters.h.
+ *
+ * These buffers are only ever used for reception, so the CPU can have
+ * dirtied at most the part of the payload that held the previous frame.
+ * Only that part is invalidated when the buffer is handed back to the GEM,
+ * instead of a full frame size for every refill.
+ ******************************************************************************/
+#ifndef XEMACPSIF_RXQ_PBUFS
+#define XEMACPSIF_RXQ_PBUFS	(2 * XLWIP_CONFIG_N_RX_DESC)
+#endif
+
+#ifdef ZYNQMP_USE_JUMBO
+#define RXQ_BUF_SIZE	MAX_FRAME_SIZE_JUMBO
+#else
+/* The GEM writes up to the DMA buffer size of the queue */
+#define RXQ_BUF_SIZE	XEMACPS_RX_BUF_SIZE
+#endif
+
+typedef struct {
+	struct pbuf_custom pc;
+	/* Payload is cache line aligned, the fields below do not share a
+	 * cache line with it */
+	u8_t payload[RXQ_BUF_SIZE] __attribute__ ((aligned (MEM_ALIGNMENT)));
+	const struct memp_desc *pool;
+	u32_t dirty_len;
+} rxq_buf_t;
+
+/* GEM instances with receive storage, see get_base_index_rxpbufsstorage() */
+#define XEMACPSIF_MAX_INSTANCES	4
+
+#ifdef XPAR_XEMACPS_0_BASEADDR
+LWIP_MEMPOOL_DECLARE(EMACPS0_RXQ0, XEMACPSIF_RXQ_PBUFS, sizeof(rxq_buf_t), "EMACPS0 RXQ0")
+LWIP_MEMPOOL_DECLARE(EMACPS0_RXQ1, XEMACPSIF_RXQ_PBUFS, sizeof(rxq_buf_t), "EMACPS0 RXQ1")
+#endif
+#ifdef XPAR_XEMACPS_1_BASEADDR
+LWIP_MEMPOOL_DECLARE(EMACPS1_RXQ0, XEMACPSIF_RXQ_PBUFS, sizeof(rxq_buf_t), "EMACPS1 RXQ0")
+LWIP_MEMPOOL_DECLARE(EMACPS1_RXQ1, XEMACPSIF_RXQ_PBUFS, sizeof(rxq_buf_t), "EMACPS1 RXQ1")
+#endif
+#ifdef XPAR_XEMACPS_2_BASEADDR
+LWIP_MEMPOOL_DECLARE(EMACPS2_RXQ0, XEMACPSIF_RXQ_PBUFS, sizeof(rxq_buf_t), "EMACPS2 RXQ0")
+LWIP_MEMPOOL_DECLARE(EMACPS2_RXQ1, XEMACPSIF_RXQ_PBUFS, sizeof(rxq_buf_t), "EMACPS2 RXQ1")
+#endif
+#ifdef XPAR_XEMACPS_3_BASEADDR
+LWIP_MEMPOOL_DECLARE(EMACPS3_RXQ0, XEMACPSIF_RXQ_PBUFS, sizeof(rxq_buf_t), "EMACPS3 RXQ0")
+LWIP_MEMPOOL_DECLARE(EMACPS3_RXQ1, XEMACPSIF_RXQ_PBUFS, sizeof(rxq_buf_t), "EMACPS3 RXQ1")
+#endif
+
+static const struct memp_desc *const rxq_pools[XEMACPSIF_MAX_INSTANCES][XEMACPSIF_RX_QUEUES] = {
+#ifdef XPAR_XEMACPS_0_BASEADDR
+	[0] = { &memp_EMACPS0_RXQ0, &memp_EMACPS0_RXQ1 },
+#endif
+#ifdef XPAR_XEMACPS_1_BASEADDR
+	[1] = { &memp_EMACPS1_RXQ0, &memp_EMACPS1_RXQ1 },
+#endif
+#ifdef XPAR_XEMACPS_2_BASEADDR
+	[2] = { &memp_EMACPS2_RXQ0, &memp_EMACPS2_RXQ1 },
+#endif
+#ifdef XPAR_XEMACPS_3_BASEADDR
+	[3] = { &memp_EMACPS3_RXQ0, &memp_EMACPS3_RXQ1 },
+#endif
+};
+/* One bit per GEM instance whose pools are initialized */
+static volatile u32_t rxq_pools_init = 0;
+
+static void rxq_pbuf_free(struct pbuf *p)
+{
+	rxq_buf_t *buf = (rxq_buf_t *)p;
+
+	memp_free_pool(buf->pool, buf);
+}
+#endif
+
 #if !NO_SYS
 extern u32 xInsideISR;
 #endif
@@ -130,6 +219,9 @@ extern u32 xInsideISR;
 #define XEMACPS_BD_TO_INDEX(ringptr, bdptr)				\
 	(((UINTPTR)bdptr - (UINTPTR)(ringptr)->BaseBdAddr) / (ringptr)->Separation)
 
+/* Received frames published to the stack with one queue update */
+#define RX_ENQUEUE_BATCH	16
+
 
 s32_t xemacps_is_tx_space_available(xemacpsif_s *emac)
 {
@@ -227,6 +319,86 @@ u32_t get_base_index_rxpbufsstorage (xemacpsif_s *xemacpsif)
 	return index;
 }
 
+/* Receive queues of one interface use consecutive storage slots */
+static inline
+u32_t get_base_index_rxq (xemacpsif_s *xemacpsif, u32_t queue)
+{
+	return (get_base_index_rxpbufsstorage(xemacpsif) * XEMACPSIF_RX_QUEUES) +
+		(queue * XLWIP_CONFIG_N_RX_DESC);
+}
+
+static inline
+XEmacPs_BdRing *get_rx_ring (xemacpsif_s *xemacpsif, u32_t queue)
+{
+#if XEMACPSIF_RX_QUEUES > 1
+	if (queue > 0) {
+		return &xemacpsif->rxq_ring[queue - 1];
+	}
+#endif
+	return &XEmacPs_GetRxRing(&xemacpsif->emacps);
+}
+
+static inline
+u32_t get_rx_queue (xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
+{
+	u32_t queue;
+
+	for (queue = xemacpsif->n_rx_queues - 1; queue > 0; queue--) {
+		if (rxring == get_rx_ring(xemacpsif, queue)) {
+			break;
+		}
+	}
+	return queue;
+}
+
+#if XEMACPSIF_RX_QUEUES > 1
+static inline
+u32_t get_rxq_pools_index (xemacpsif_s *xemacpsif)
+{
+	return get_base_index_rxpbufsstorage(xemacpsif) / XLWIP_CONFIG_N_RX_DESC;
+}
+#endif
+
+/*
+ * Allocate a receive buffer for the given queue and invalidate the part of
+ * it the CPU may have dirtied.
+ */
+static struct pbuf *alloc_rx_pbuf(xemacpsif_s *xemacpsif, u32_t queue)
+{
+	struct pbuf *p;
+	u32_t inval_len;
+#if XEMACPSIF_RX_QUEUES > 1
+	const struct memp_desc *pool;
+	rxq_buf_t *buf;
+
+	pool = rxq_pools[get_rxq_pools_index(xemacpsif)][queue];
+	buf = (rxq_buf_t *)memp_malloc_pool(pool);
+	if (!buf) {
+		return NULL;
+	}
+	/* pool memory is zeroed, a buffer without pool is used the first time */
+	if (buf->pool == NULL) {
+		buf->pool = pool;
+		buf->dirty_len = RXQ_BUF_SIZE;
+	}
+	inval_len = buf->dirty_len;
+	buf->pc.custom_free_function = rxq_pbuf_free;
+	p = pbuf_alloced_custom(PBUF_RAW, RX_PBUF_SIZE, PBUF_POOL, &buf->pc,
+				buf->payload, RXQ_BUF_SIZE);
+#else
+	LWIP_UNUSED_ARG(queue);
+	p = pbuf_alloc(PBUF_RAW, RX_PBUF_SIZE, PBUF_POOL);
+	if (!p) {
+		return NULL;
+	}
+	inval_len = RX_PBUF_SIZE;
+#endif
+	if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+		Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)inval_len);
+	}
+	return p;
+}
+
 void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 {
 	XEmacPs_Bd *txbdset;
@@ -416,8 +588,9 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	return status;
 }
 
-void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
+static void setup_rxq_bds(xemacpsif_s *xemacpsif, u32_t queue)
 {
+	XEmacPs_BdRing *rxring;
 	XEmacPs_Bd *rxbd;
 	XStatus status;
 	struct pbuf *p;
@@ -426,16 +599,13 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 	u32 *temp;
 	u32_t index;
 
-	index = get_base_index_rxpbufsstorage (xemacpsif);
+	rxring = get_rx_ring(xemacpsif, queue);
+	index = get_base_index_rxq(xemacpsif, queue);
 
 	freebds = XEmacPs_BdRingGetFreeCnt (rxring);
 	while (freebds > 0) {
 		freebds--;
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+		p = alloc_rx_pbuf(xemacpsif, queue);
 		if (!p) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
@@ -464,15 +634,6 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 			XEmacPs_BdRingUnAlloc(rxring, 1, rxbd);
 			return;
 		}
-#ifdef ZYNQMP_USE_JUMBO
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
-		}
-#else
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
-		}
-#endif
 		bdindex = XEMACPS_BD_TO_INDEX(rxring, rxbd);
 		temp = (u32 *)rxbd;
 		temp++;
@@ -496,6 +657,28 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 	}
 }
 
+void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
+{
+	setup_rxq_bds(xemacpsif, get_rx_queue(xemacpsif, rxring));
+}
+
+/*
+ * Hands received frames to the stack through the receive queue. Frames
+ * that do not fit are dropped.
+ */
+static void enqueue_rx_frames(xemacpsif_s *xemacpsif, void **frames, s32_t n)
+{
+	s32_t i;
+
+	for (i = pq_enqueue_batch(xemacpsif->recv_q, frames, n); i < n; i++) {
+#if LINK_STATS
+		lwip_stats.link.memerr++;
+		lwip_stats.link.drop++;
+#endif
+		pbuf_free((struct pbuf *)frames[i]);
+	}
+}
+
 void emacps_recv_handler(void *arg)
 {
 	struct pbuf *p;
@@ -505,21 +688,22 @@ void emacps_recv_handler(void *arg)
 	XEmacPs_BdRing *rxring;
 	volatile s32_t bd_processed;
 	s32_t rx_bytes, k;
+	void *frames[RX_ENQUEUE_BATCH];
+	s32_t n_frames = 0;
 	u32_t bdindex;
 	u32_t regval;
 	u32_t index;
 	u32_t gigeversion;
+	u32_t queue;
 
 	xemac = (struct xemac_s *)(arg);
 	xemacpsif = (xemacpsif_s *)(xemac->state);
-	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
 
 #if !NO_SYS
 	xInsideISR++;
 #endif
 
 	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
-	index = get_base_index_rxpbufsstorage (xemacpsif);
 	/*
 	 * If Reception done interrupt is asserted, call RX call back function
 	 * to handle the processed BDs and then raise the according flag.
@@ -530,50 +714,65 @@ void emacps_recv_handler(void *arg)
 			resetrx_on_no_rxdata(xemacpsif);
 	}
 
-	while(1) {
+	/* Drain the priority queues first, the driver reports completions of
+	 * all queues through this one handler */
+	queue = xemacpsif->n_rx_queues;
+	while (queue > 0) {
+		queue--;
+		rxring = get_rx_ring(xemacpsif, queue);
+		index = get_base_index_rxq(xemacpsif, queue);
 
-		bd_processed = XEmacPs_BdRingFromHwRx(rxring, XLWIP_CONFIG_N_RX_DESC, &rxbdset);
-		if (bd_processed <= 0) {
-			break;
-		}
+		while(1) {
 
-		for (k = 0, curbdptr=rxbdset; k < bd_processed; k++) {
+			bd_processed = XEmacPs_BdRingFromHwRx(rxring, XLWIP_CONFIG_N_RX_DESC, &rxbdset);
+			if (bd_processed <= 0) {
+				break;
+			}
 
-			bdindex = XEMACPS_BD_TO_INDEX(rxring, curbdptr);
-			p = (struct pbuf *)rx_pbufs_storage[index + bdindex];
+			for (k = 0, curbdptr=rxbdset; k < bd_processed; k++) {
 
-			/*
-			 * Adjust the buffer size to the actual number of bytes received.
-			 */
+				bdindex = XEMACPS_BD_TO_INDEX(rxring, curbdptr);
+				p = (struct pbuf *)rx_pbufs_storage[index + bdindex];
+
+				/*
+				 * Adjust the buffer size to the actual number of bytes received.
+				 */
 #ifdef ZYNQMP_USE_JUMBO
-			rx_bytes = XEmacPs_GetRxFrameSize(&xemacpsif->emacps, curbdptr);
+				rx_bytes = XEmacPs_GetRxFrameSize(&xemacpsif->emacps, curbdptr);
 #else
-			rx_bytes = XEmacPs_BdGetLength(curbdptr);
+				rx_bytes = XEmacPs_BdGetLength(curbdptr);
+#endif
+				pbuf_realloc(p, rx_bytes);
+
+				/* Invalidate RX frame before queuing to handle
+				 * L1 cache prefetch conditions on any architecture.
+				 */
+				if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+					Xil_DCacheInvalidateRange((UINTPTR)p->payload, rx_bytes);
+				}
+#if XEMACPSIF_RX_QUEUES > 1
+				/* The stack can only write the received part */
+				((rxq_buf_t *)p)->dirty_len = rx_bytes;
 #endif
-			pbuf_realloc(p, rx_bytes);
 
-			/* Invalidate RX frame before queuing to handle
-			 * L1 cache prefetch conditions on any architecture.
-			 */
-			if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-				Xil_DCacheInvalidateRange((UINTPTR)p->payload, rx_bytes);
+				/* store it in the receive queue,
+				 * where it'll be processed by a different handler
+				 */
+				frames[n_frames++] = p;
+				if (n_frames == RX_ENQUEUE_BATCH) {
+					enqueue_rx_frames(xemacpsif, frames, n_frames);
+					n_frames = 0;
+				}
+				curbdptr = XEmacPs_BdRingNext( rxring, curbdptr);
 			}
-
-			/* store it in the receive queue,
-			 * where it'll be processed by a different handler
-			 */
-			if (pq_enqueue(xemacpsif->recv_q, (void*)p) < 0) {
-#if LINK_STATS
-				lwip_stats.link.memerr++;
-				lwip_stats.link.drop++;
-#endif
-				pbuf_free(p);
+			if (n_frames > 0) {
+				enqueue_rx_frames(xemacpsif, frames, n_frames);
+				n_frames = 0;
 			}
-			curbdptr = XEmacPs_BdRingNext( rxring, curbdptr);
+			/* free up the BD's */
+			XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
+			setup_rxq_bds(xemacpsif, queue);
 		}
-		/* free up the BD's */
-		XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
-		setup_rx_bds(xemacpsif, rxring);
 	}
 #if !NO_SYS
 	sys_sem_signal(&xemac->sem_rx_data_available);
@@ -603,26 +802,113 @@ void clean_dma_txdescs(struct xemac_s *xemac)
 	XEmacPs_BdRingClone(txringptr, &bdtemplate, XEMACPS_SEND);
 }
 
-XStatus init_dma(struct xemac_s *xemac)
+/*
+ * Create the receive BD ring of a queue, fill it with buffers and hand it
+ * to the GEM.
+ */
+static XStatus init_rx_queue(xemacpsif_s *xemacpsif, u32_t queue, void *bdspace)
 {
 	XEmacPs_Bd bdtemplate;
-	XEmacPs_BdRing *rxringptr, *txringptr;
+	XEmacPs_BdRing *rxringptr;
 	XEmacPs_Bd *rxbd;
 	struct pbuf *p;
 	XStatus status;
 	s32_t i;
 	u32_t bdindex;
-	volatile UINTPTR tempaddress;
 	u32_t index;
+	u32 *temp;
+
+	rxringptr = get_rx_ring(xemacpsif, queue);
+	index = get_base_index_rxq(xemacpsif, queue);
+	LWIP_DEBUGF(NETIF_DEBUG, ("rxringptr: 0x%08x\r\n", rxringptr));
+
+	/*
+	 * Setup RxBD space.
+	 *
+	 * Setup a BD template for the Rx channel. This template will be copied to
+	 * every RxBD. We will not have to explicitly set these again.
+	 */
+	XEmacPs_BdClear(&bdtemplate);
+
+	/*
+	 * Create the RxBD ring
+	 */
+
+	status = XEmacPs_BdRingCreate(rxringptr, (UINTPTR) bdspace,
+				(UINTPTR) bdspace, BD_ALIGNMENT,
+				     XLWIP_CONFIG_N_RX_DESC);
+
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD space\r\n"));
+		return ERR_IF;
+	}
+
+	status = XEmacPs_BdRingClone(rxringptr, &bdtemplate, XEMACPS_RECV);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error initializing RxBD space\r\n"));
+		return ERR_IF;
+	}
+
+	/*
+	 * Allocate RX descriptors, 1 RxBD at a time.
+	 */
+	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
+		p = alloc_rx_pbuf(xemacpsif, queue);
+		if (!p) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			xil_printf("unable to alloc pbuf in init_dma\r\n");
+			return ERR_IF;
+		}
+		status = XEmacPs_BdRingAlloc(rxringptr, 1, &rxbd);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("init_dma: Error allocating RxBD\r\n"));
+			pbuf_free(p);
+			return ERR_IF;
+		}
+		/* Enqueue to HW */
+		status = XEmacPs_BdRingToHw(rxringptr, 1, rxbd);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error: committing RxBD to HW\r\n"));
+			pbuf_free(p);
+			XEmacPs_BdRingUnAlloc(rxringptr, 1, rxbd);
+			return ERR_IF;
+		}
+
+		bdindex = XEMACPS_BD_TO_INDEX(rxringptr, rxbd);
+		temp = (u32 *)rxbd;
+		*temp = 0;
+		if (bdindex == (XLWIP_CONFIG_N_RX_DESC - 1)) {
+			*temp = 0x00000002;
+		}
+		temp++;
+		*temp = 0;
+		dsb();
+		XEmacPs_BdSetAddressRx(rxbd, (UINTPTR)p->payload);
+
+		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
+	}
+	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), rxringptr->BaseBdAddr, queue, XEMACPS_RECV);
+
+	return XST_SUCCESS;
+}
+
+XStatus init_dma(struct xemac_s *xemac)
+{
+	XEmacPs_Bd bdtemplate;
+	XEmacPs_BdRing *txringptr;
+	XStatus status;
+	volatile UINTPTR tempaddress;
 	u32_t gigeversion;
+	u32_t queue;
 	XEmacPs_Bd *bdtxterminate = NULL;
 	XEmacPs_Bd *bdrxterminate = NULL;
-	u32 *temp;
 
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
 
-	index = get_base_index_rxpbufsstorage (xemacpsif);
 	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
 	/*
 	 * The BDs need to be allocated in uncached memory. Hence the 1 MB
@@ -644,9 +930,21 @@ XStatus init_dma(struct xemac_s *xemac)
 		bd_space_attr_set = 1;
 	}
 
-	rxringptr = &XEmacPs_GetRxRing(&xemacpsif->emacps);
+	/* Priority queues are only present from GEM version 3 on */
+	xemacpsif->n_rx_queues = 1;
+#if XEMACPSIF_RX_QUEUES > 1
+	if ((gigeversion > 2) && (xemacpsif->emacps.MaxQueues >= XEMACPSIF_RX_QUEUES)) {
+		xemacpsif->n_rx_queues = XEMACPSIF_RX_QUEUES;
+	}
+	if ((rxq_pools_init & (1U << get_rxq_pools_index(xemacpsif))) == 0) {
+		for (queue = 0; queue < XEMACPSIF_RX_QUEUES; queue++) {
+			memp_init_pool(rxq_pools[get_rxq_pools_index(xemacpsif)][queue]);
+		}
+		rxq_pools_init |= (1U << get_rxq_pools_index(xemacpsif));
+	}
+#endif
+
 	txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
-	LWIP_DEBUGF(NETIF_DEBUG, ("rxringptr: 0x%08x\r\n", rxringptr));
 	LWIP_DEBUGF(NETIF_DEBUG, ("txringptr: 0x%08x\r\n", txringptr));
 
 	/* Allocate 64k for Rx and Tx bds each to take care of extreme cases */
@@ -657,8 +955,16 @@ XStatus init_dma(struct xemac_s *xemac)
 	xemacpsif->tx_bdspace = (void *)tempaddress;
 	bd_space_index += 0x10000;
 	if (gigeversion > 2) {
+		/* The RX queue 1 ring takes the place of its terminate BD */
 		tempaddress = (UINTPTR)&(emac_bd_space[bd_space_index]);
-		bdrxterminate = (XEmacPs_Bd *)tempaddress;
+#if XEMACPSIF_RX_QUEUES > 1
+		if (xemacpsif->n_rx_queues > 1) {
+			xemacpsif->rxq_bdspace[0] = (void *)tempaddress;
+		} else
+#endif
+		{
+			bdrxterminate = (XEmacPs_Bd *)tempaddress;
+		}
 		bd_space_index += 0x10000;
 		tempaddress = (UINTPTR)&(emac_bd_space[bd_space_index]);
 		bdtxterminate = (XEmacPs_Bd *)tempaddress;
@@ -674,33 +980,6 @@ XStatus init_dma(struct xemac_s *xemac)
 		return ERR_IF;
 	}
 
-	/*
-	 * Setup RxBD space.
-	 *
-	 * Setup a BD template for the Rx channel. This template will be copied to
-	 * every RxBD. We will not have to explicitly set these again.
-	 */
-	XEmacPs_BdClear(&bdtemplate);
-
-	/*
-	 * Create the RxBD ring
-	 */
-
-	status = XEmacPs_BdRingCreate(rxringptr, (UINTPTR) xemacpsif->rx_bdspace,
-				(UINTPTR) xemacpsif->rx_bdspace, BD_ALIGNMENT,
-				     XLWIP_CONFIG_N_RX_DESC);
-
-	if (status != XST_SUCCESS) {
-		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD space\r\n"));
-		return ERR_IF;
-	}
-
-	status = XEmacPs_BdRingClone(rxringptr, &bdtemplate, XEMACPS_RECV);
-	if (status != XST_SUCCESS) {
-		LWIP_DEBUGF(NETIF_DEBUG, ("Error initializing RxBD space\r\n"));
-		return ERR_IF;
-	}
-
 	XEmacPs_BdClear(&bdtemplate);
 	XEmacPs_BdSetStatus(&bdtemplate, XEMACPS_TXBUF_USED_MASK);
 	/*
@@ -720,61 +999,18 @@ XStatus init_dma(struct xemac_s *xemac)
 		return ERR_IF;
 	}
 
-	/*
-	 * Allocate RX descriptors, 1 RxBD at a time.
-	 */
-	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
+	for (queue = 0; queue < xemacpsif->n_rx_queues; queue++) {
+#if XEMACPSIF_RX_QUEUES > 1
+		status = init_rx_queue(xemacpsif, queue, (queue == 0) ?
+				       xemacpsif->rx_bdspace : xemacpsif->rxq_bdspace[queue - 1]);
 #else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
-		if (!p) {
-#if LINK_STATS
-			lwip_stats.link.memerr++;
-			lwip_stats.link.drop++;
+		status = init_rx_queue(xemacpsif, queue, xemacpsif->rx_bdspace);
 #endif
-			xil_printf("unable to alloc pbuf in init_dma\r\n");
-			return ERR_IF;
-		}
-		status = XEmacPs_BdRingAlloc(rxringptr, 1, &rxbd);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("init_dma: Error allocating RxBD\r\n"));
-			pbuf_free(p);
-			return ERR_IF;
-		}
-		/* Enqueue to HW */
-		status = XEmacPs_BdRingToHw(rxringptr, 1, rxbd);
 		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("Error: committing RxBD to HW\r\n"));
-			pbuf_free(p);
-			XEmacPs_BdRingUnAlloc(rxringptr, 1, rxbd);
 			return ERR_IF;
 		}
-
-		bdindex = XEMACPS_BD_TO_INDEX(rxringptr, rxbd);
-		temp = (u32 *)rxbd;
-		*temp = 0;
-		if (bdindex == (XLWIP_CONFIG_N_RX_DESC - 1)) {
-			*temp = 0x00000002;
-		}
-		temp++;
-		*temp = 0;
-		dsb();
-#ifdef ZYNQMP_USE_JUMBO
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
-		}
-#else
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
-		}
-#endif
-		XEmacPs_BdSetAddressRx(rxbd, (UINTPTR)p->payload);
-
-		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
 	}
-	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
+
 	if (gigeversion > 2) {
 		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, 1, XEMACPS_SEND);
 	}else {
@@ -785,16 +1021,18 @@ XStatus init_dma(struct xemac_s *xemac)
 		/*
 		 * This version of GEM supports priority queuing and the current
 		 * driver is using tx priority queue 1 and normal rx queue for
-		 * packet transmit and receive. The below code ensure that the
-		 * other queue pointers are parked to known state for avoiding
-		 * the controller to malfunction by fetching the descriptors
-		 * from these queues.
+		 * packet transmit and receive, unless rx queue 1 is enabled.
+		 * The below code ensure that the other queue pointers are parked
+		 * to known state for avoiding the controller to malfunction by
+		 * fetching the descriptors from these queues.
 		 */
-		XEmacPs_BdClear(bdrxterminate);
-		XEmacPs_BdSetAddressRx(bdrxterminate, (XEMACPS_RXBUF_NEW_MASK |
-						XEMACPS_RXBUF_WRAP_MASK));
-		XEmacPs_Out32((xemacpsif->emacps.Config.BaseAddress + XEMACPS_RXQ1BASE_OFFSET),
-				   (UINTPTR)bdrxterminate);
+		if (bdrxterminate != NULL) {
+			XEmacPs_BdClear(bdrxterminate);
+			XEmacPs_BdSetAddressRx(bdrxterminate, (XEMACPS_RXBUF_NEW_MASK |
+							XEMACPS_RXBUF_WRAP_MASK));
+			XEmacPs_Out32((xemacpsif->emacps.Config.BaseAddress + XEMACPS_RXQ1BASE_OFFSET),
+					   (UINTPTR)bdrxterminate);
+		}
 		XEmacPs_BdClear(bdtxterminate);
 		XEmacPs_BdSetStatus(bdtxterminate, (XEMACPS_TXBUF_USED_MASK |
 						XEMACPS_TXBUF_WRAP_MASK));
@@ -891,8 +1129,8 @@ void free_txrx_pbufs(xemacpsif_s *xemacpsif)
 		}
 	}
 
-	index1 = get_base_index_rxpbufsstorage(xemacpsif);
-	for (index = index1; index < (index1 + XLWIP_CONFIG_N_RX_DESC); index++) {
+	index1 = get_base_index_rxq(xemacpsif, 0);
+	for (index = index1; index < (index1 + (xemacpsif->n_rx_queues * XLWIP_CONFIG_N_RX_DESC)); index++) {
 		p = (struct pbuf *)rx_pbufs_storage[index];
 		pbuf_free(p);
 
@@ -920,12 +1158,19 @@ void reset_dma(struct xemac_s *xemac)
 {
 	u8 txqueuenum;
 	u32_t gigeversion;
+	u32_t queue;
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 	XEmacPs_BdRing *txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
 	XEmacPs_BdRing *rxringptr = &XEmacPs_GetRxRing(&xemacpsif->emacps);
 
 	XEmacPs_BdRingPtrReset(txringptr, xemacpsif->tx_bdspace);
 	XEmacPs_BdRingPtrReset(rxringptr, xemacpsif->rx_bdspace);
+#if XEMACPSIF_RX_QUEUES > 1
+	for (queue = 1; queue < xemacpsif->n_rx_queues; queue++) {
+		XEmacPs_BdRingPtrReset(&xemacpsif->rxq_ring[queue - 1],
+				       xemacpsif->rxq_bdspace[queue - 1]);
+	}
+#endif
 
 	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
 	if (gigeversion > 2) {
@@ -934,10 +1179,43 @@ void reset_dma(struct xemac_s *xemac)
 		txqueuenum = 0;
 	}
 
-	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
+	for (queue = 0; queue < xemacpsif->n_rx_queues; queue++) {
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), get_rx_ring(xemacpsif, queue)->BaseBdAddr,
+				    queue, XEMACPS_RECV);
+	}
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, txqueuenum, XEMACPS_SEND);
 }
 
+/*
+ * xemacpsif_rxq_steer():
+ *
+ * Steers received frames to a receive queue with the Type 1 screener
+ * <index>. Frames match on the UDP destination port, the IP TOS/traffic
+ * class byte, or both; pass -1 for a field that should not be compared.
+ * Passing -1 for both fields disables the screener.
+ */
+s32_t xemacpsif_rxq_steer(struct netif *netif, u8_t index, u8_t queue,
+			s32_t udp_port, s32_t tos)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	u32_t match = 0;
+
+	if (queue >= xemacpsif->n_rx_queues) {
+		return XST_INVALID_PARAM;
+	}
+	if (udp_port >= 0) {
+		match |= XEMACPS_SCRT1_UDP_EN_MASK |
+			(((u32_t)udp_port << XEMACPS_SCRT1_UDP_SHIFT) & XEMACPS_SCRT1_UDP_MASK);
+	}
+	if (tos >= 0) {
+		match |= XEMACPS_SCRT1_DSTC_EN_MASK |
+			(((u32_t)tos << XEMACPS_SCRT1_DSTC_SHIFT) & XEMACPS_SCRT1_DSTC_MASK);
+	}
+
+	return XEmacPs_SetScreenType1(&xemacpsif->emacps, index, queue, match);
+}
+
 #ifndef SDT
 void emac_disable_intr(void)
 {
@@ -33,61 +33,116 @@
 
 #include "netif/xpqueue.h"
 
-#define NUM_QUEUES	2
-
-pq_queue_t pq_queue[NUM_QUEUES];
+/*
+ * The producer publishes new entries with a release store of head, which
+ * the consumer reads with acquire semantics before touching the entries.
+ * The consumer returns slots the same way through tail.
+ */
+#define PQ_LOAD_ACQUIRE(v)	__atomic_load_n(&(v), __ATOMIC_ACQUIRE)
+#define PQ_STORE_RELEASE(v, x)	__atomic_store_n(&(v), (x), __ATOMIC_RELEASE)
 
+/*
+ * Allocates a queue of at least size entries. Each netif creates its own
+ * queues, sized from the number of buffers it can have in flight, so the
+ * number of interfaces is only limited by the heap.
+ */
 pq_queue_t *
-pq_create_queue()
+pq_create_queue(u32_t size)
 {
-	static int i;
-	pq_queue_t *q = NULL;
-
-	if (i >= NUM_QUEUES) {
-		LWIP_DEBUGF(NETIF_DEBUG, ("ERR: Max Queues allocated\n\r"));
-		return q;
-	}
+	pq_queue_t *q;
+	u32_t slots = 2;
 
-	q = &pq_queue[i++];
+	while (slots < size)
+		slots <<= 1;
 
-	if (!q)
+	q = malloc(sizeof *q + slots * sizeof q->data[0]);
+	if (!q) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("ERR: Unable to allocate queue\n\r"));
 		return q;
+	}
 
-	q->head = q->tail = q->len = 0;
+	q->head = q->tail = 0;
+	q->size = slots;
 
 	return q;
 }
 
+/* Producer side, returns -1 when the queue is full */
 int
 pq_enqueue(pq_queue_t *q, void *p)
 {
-	if (q->len == PQ_QUEUE_SIZE)
+	u32_t head = q->head;
+
+	if (head - PQ_LOAD_ACQUIRE(q->tail) == q->size)
 		return -1;
 
-	q->data[q->head] = p;
-	q->head = (q->head + 1)%PQ_QUEUE_SIZE;
-	q->len++;
+	q->data[head & (q->size - 1)] = p;
+	PQ_STORE_RELEASE(q->head, head + 1);
 
 	return 0;
 }
 
+/*
+ * Producer side, enqueues as many of the n entries as fit and publishes
+ * them at once. Returns the number of entries enqueued.
+ */
+int
+pq_enqueue_batch(pq_queue_t *q, void **p, int n)
+{
+	u32_t head = q->head;
+	u32_t space = q->size - (head - PQ_LOAD_ACQUIRE(q->tail));
+	int i;
+
+	if ((u32_t)n > space)
+		n = space;
+
+	for (i = 0; i < n; i++)
+		q->data[(head + i) & (q->size - 1)] = p[i];
+	PQ_STORE_RELEASE(q->head, head + n);
+
+	return n;
+}
+
+/* Consumer side, returns NULL when the queue is empty */
 void*
 pq_dequeue(pq_queue_t *q)
 {
-	int ptail;
+	u32_t tail = q->tail;
+	void *p;
 
-	if (q->len == 0)
+	if (PQ_LOAD_ACQUIRE(q->head) == tail)
 		return NULL;
 
-	ptail = q->tail;
-	q->tail = (q->tail + 1)%PQ_QUEUE_SIZE;
-	q->len--;
+	p = q->data[tail & (q->size - 1)];
+	PQ_STORE_RELEASE(q->tail, tail + 1);
+
+	return p;
+}
+
+/*
+ * Consumer side, dequeues up to n entries into p. Returns the number of
+ * entries dequeued.
+ */
+int
+pq_dequeue_batch(pq_queue_t *q, void **p, int n)
+{
+	u32_t tail = q->tail;
+	u32_t avail = PQ_LOAD_ACQUIRE(q->head) - tail;
+	int i;
+
+	if ((u32_t)n > avail)
+		n = avail;
+
+	for (i = 0; i < n; i++)
+		p[i] = q->data[(tail + i) & (q->size - 1)];
+	PQ_STORE_RELEASE(q->tail, tail + n);
 
-	return q->data[ptail];
+	return n;
 }
 
+/* Number of queued entries, the other side may change it at any time */
 int
 pq_qlength(pq_queue_t *q)
 {
-	return q->len;
+	return PQ_LOAD_ACQUIRE(q->head) - PQ_LOAD_ACQUIRE(q->tail);
 }
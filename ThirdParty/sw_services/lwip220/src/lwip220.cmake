@@ -15,6 +15,7 @@ set(lwip220_n_tx_descriptors 64 CACHE STRING "Number of TX Buffer Descriptors to
 set(lwip220_n_rx_descriptors 64 CACHE STRING "Number of RX Buffer Descriptors to be used in SDMA mode")
 set(lwip220_n_tx_coalesce 1 CACHE STRING "Setting for TX Interrupt coalescing.")
 set(lwip220_n_rx_coalesce 1 CACHE STRING "Setting for RX Interrupt coalescing.")
+set(lwip220_n_tx_batch 1 CACHE STRING "Maximum number of frames handed to the TX DMA in one go, 1 disables batching.")
 option(lwip220_temac_tcp_rx_checksum_offload "Offload TCP Receive checksum calculation (hardware support required)" OFF)
 option(lwip220_temac_tcp_tx_checksum_offload "Offload TCP Transmit checksum calculation (hardware support required)" OFF)
 option(lwip220_temac_tcp_ip_rx_checksum_offload "Offload TCP and IP Receive checksum calculation (hardware support required)" OFF)
@@ -23,6 +24,8 @@ set(lwip220_temac_phy_link_speed CONFIG_LINKSPEED_AUTODETECT CACHE STRING "link
 set_property(CACHE lwip220_temac_phy_link_speed PROPERTY STRINGS CONFIG_LINKSPEED10 CONFIG_LINKSPEED100 CONFIG_LINKSPEED1000 CONFIG_LINKSPEED_AUTODETECT)
 option(lwip220_temac_use_jumbo_frames "use jumbo frames" OFF)
 set(lwip220_temac_emac_number 0 CACHE STRING "Zynq Ethernet Interface number")
+set(lwip220_emacps_rx_queues 1 CACHE STRING "Number of GEM priority queues used for reception, frames are steered with screeners")
+set_property(CACHE lwip220_emacps_rx_queues PROPERTY STRINGS 1 2)
 
 set(lwip220_mem_size 131072 CACHE STRING "Size of the heap memory (bytes).")
 set(lwip220_memp_n_pbuf 16 CACHE STRING "Number of memp struct pbufs. Set this high if application sends lot of data out of ROM")
@@ -368,6 +371,12 @@ set(XLWIP_CONFIG_N_TX_DESC ${lwip220_n_tx_descriptors})
 set(XLWIP_CONFIG_N_RX_DESC ${lwip220_n_rx_descriptors})
 set(XLWIP_CONFIG_N_TX_COALESCE ${lwip220_n_tx_coalesce})
 set(XLWIP_CONFIG_N_RX_COALESCE ${lwip220_n_rx_coalesce})
+set(XLWIP_CONFIG_N_TX_BATCH ${lwip220_n_tx_batch})
+set(XLWIP_CONFIG_EMACPS_RX_QUEUES ${lwip220_emacps_rx_queues})
+if (${lwip220_emacps_rx_queues} GREATER 1)
+    # Per queue receive buffers are custom pbufs
+    set(LWIP_SUPPORT_CUSTOM_PBUF 1)
+endif()
 
 if(("${CMAKE_SYSTEM_NAME}" STREQUAL "FreeRTOS") AND
    ("${lwip220_api_mode}" STREQUAL SOCKET_API))
@@ -0,0 +1,895 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xaxidma_example_sg_adaptive.c
+ *
+ * This file demonstrates the adaptive interrupt/polling mode of the receive
+ * BD ring when the AXIDMA core is configured in Scatter Gather Mode.
+ *
+ * Packets are sent in bursts. The receive ring starts in interrupt mode,
+ * the interrupt handler retrieves completed BDs with XAxiDma_BdRingPoll().
+ * When one call returns a full budget of BDs the driver disables the receive
+ * completion interrupts and the main loop polls the ring until it stays idle,
+ * then the driver enables the interrupts again. At the end the counters of
+ * XAxiDma_BdRingGetStats() are printed, they show how many BDs were handled
+ * per interrupt and per poll.
+ *
+ * This code assumes a loopback hardware widget is connected to the AXI DMA
+ * core for data packet loopback.
+ *
+ * To see the debug print, you need a Uart16550 or uartlite in your system,
+ * and please set "-DDEBUG" in your compiler options. You need to rebuild your
+ * software executable.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 9.20  mb   10/16/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+/***************************** Include Files *********************************/
+#include "xaxidma.h"
+#include "xparameters.h"
+#include "xil_exception.h"
+#include "xdebug.h"
+#include "xil_util.h"
+#ifdef SDT
+#include "xinterrupt_wrap.h"
+#endif
+
+#ifdef __aarch64__
+#include "xil_mmu.h"
+#endif
+
+#ifndef DEBUG
+extern void xil_printf(const char *format, ...);
+#endif
+
+#ifndef SDT
+#ifdef XPAR_INTC_0_DEVICE_ID
+#include "xintc.h"
+#else
+#include "xscugic.h"
+#endif
+#endif
+
+/******************** Constant Definitions **********************************/
+/*
+ * Device hardware build related constants.
+ */
+
+#ifndef SDT
+#define DMA_DEV_ID		XPAR_AXIDMA_0_DEVICE_ID
+
+#ifdef XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#elif defined (XPAR_MIG7SERIES_0_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_MIG7SERIES_0_BASEADDR
+#elif defined (XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR
+#elif defined (XPAR_PSU_DDR_0_S_AXI_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#endif
+
+#else
+
+#ifdef XPAR_MEM0_BASEADDRESS
+#define DDR_BASE_ADDR		XPAR_MEM0_BASEADDRESS
+#endif
+#endif
+
+#ifndef DDR_BASE_ADDR
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+DEFAULT SET TO 0x01000000
+#define MEM_BASE_ADDR		0x01000000
+#else
+#define MEM_BASE_ADDR		(DDR_BASE_ADDR + 0x1000000)
+#endif
+
+#ifndef SDT
+#ifdef XPAR_INTC_0_DEVICE_ID
+#define RX_INTR_ID		XPAR_INTC_0_AXIDMA_0_S2MM_INTROUT_VEC_ID
+#define INTC_DEVICE_ID		XPAR_INTC_0_DEVICE_ID
+#define INTC			XIntc
+#define INTC_HANDLER		XIntc_InterruptHandler
+#else
+#define RX_INTR_ID		XPAR_FABRIC_AXIDMA_0_S2MM_INTROUT_VEC_ID
+#define INTC_DEVICE_ID		XPAR_SCUGIC_SINGLE_DEVICE_ID
+#define INTC			XScuGic
+#define INTC_HANDLER		XScuGic_InterruptHandler
+#endif
+#endif
+
+#define RX_BD_SPACE_BASE	(MEM_BASE_ADDR)
+#define RX_BD_SPACE_HIGH	(MEM_BASE_ADDR + 0x0000FFFF)
+#define TX_BD_SPACE_BASE	(MEM_BASE_ADDR + 0x00010000)
+#define TX_BD_SPACE_HIGH	(MEM_BASE_ADDR + 0x0001FFFF)
+#define TX_BUFFER_BASE		(MEM_BASE_ADDR + 0x00100000)
+#define RX_BUFFER_BASE		(MEM_BASE_ADDR + 0x00300000)
+
+/* Timeout loop counter for reset
+ */
+#define RESET_TIMEOUT_COUNTER	10000
+
+#define MAX_PKT_LEN		0x100
+#define MARK_UNCACHEABLE	0x701
+
+/*
+ * The packets are sent in NUMBER_OF_BURSTS bursts of PKTS_PER_BURST single
+ * BD packets. A burst is larger than the poll budget, so the receive ring
+ * goes to polling mode during a burst and back to interrupt mode after it.
+ */
+#define PKTS_PER_BURST		128
+#define NUMBER_OF_BURSTS	4
+#define NUMBER_OF_PKTS		(PKTS_PER_BURST * NUMBER_OF_BURSTS)
+
+/* Adaptive mode: BDs per poll and empty polls before going back to
+ * interrupts
+ */
+#define POLL_BUDGET		32
+#define IDLE_POLLS		16
+
+/* The coalescing threshold the adaptation starts from, and the delay timer
+ * that reports BDs below the raised threshold
+ */
+#define COALESCING_COUNT	1
+#define DELAY_TIMER_COUNT	100
+
+#define POLL_TIMEOUT_COUNTER	1000000U
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+static int RxSetup(XAxiDma *AxiDmaInstPtr);
+static int TxSetup(XAxiDma *AxiDmaInstPtr);
+static int SendBurst(XAxiDma *AxiDmaInstPtr, int FirstPkt);
+static void TxReclaim(XAxiDma_BdRing *TxRingPtr);
+static void RxProcess(XAxiDma_BdRing *RxRingPtr);
+static void RxIntrHandler(void *Callback);
+static int CheckData(void);
+
+#ifndef SDT
+static int SetupIntrSystem(INTC *IntcInstancePtr, XAxiDma *AxiDmaPtr,
+			   u16 RxIntrId);
+static void DisableIntrSystem(INTC *IntcInstancePtr, u16 RxIntrId);
+#endif
+
+/************************** Variable Definitions *****************************/
+/*
+ * Device instance definitions
+ */
+XAxiDma AxiDma;
+
+#ifndef SDT
+static INTC Intc;	/* Instance of the Interrupt Controller */
+#endif
+
+/*
+ * Flags the interrupt handler and the main loop use to count the events.
+ */
+volatile u32 RxDone;
+volatile u32 Error;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function is the main entry of the adaptive mode example. It does the
+* following:
+*	- Initialize the DMA engine
+*	- Set up Tx and Rx channels, the Rx ring in adaptive mode
+*	- Set up the interrupt system for the Rx interrupt
+*	- Send the bursts, polling the Rx ring while it is in polling mode
+*	- Check the data and print the Rx ring counters
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if tests pass
+*		- XST_FAILURE if fails.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+	int Burst;
+	u32 Wait;
+	XAxiDma_Config *Config;
+	XAxiDma_BdRing *RxRingPtr;
+	XAxiDma_BdRing *TxRingPtr;
+	XAxiDma_BdRingStats Stats;
+
+	xil_printf("\r\n--- Entering main() --- \r\n");
+#ifdef __aarch64__
+	Xil_SetTlbAttributes(TX_BD_SPACE_BASE, MARK_UNCACHEABLE);
+	Xil_SetTlbAttributes(RX_BD_SPACE_BASE, MARK_UNCACHEABLE);
+#endif
+
+#ifndef SDT
+	Config = XAxiDma_LookupConfig(DMA_DEV_ID);
+	if (!Config) {
+		xil_printf("No config found for %d\r\n", DMA_DEV_ID);
+
+		return XST_FAILURE;
+	}
+#else
+	Config = XAxiDma_LookupConfig(XPAR_XAXIDMA_0_BASEADDR);
+	if (!Config) {
+		xil_printf("No config found for %d\r\n", XPAR_XAXIDMA_0_BASEADDR);
+
+		return XST_FAILURE;
+	}
+#endif
+	/* Initialize DMA engine */
+	XAxiDma_CfgInitialize(&AxiDma, Config);
+
+	if (!XAxiDma_HasSg(&AxiDma)) {
+		xil_printf("Device configured as Simple mode \r\n");
+		return XST_FAILURE;
+	}
+
+	RxRingPtr = XAxiDma_GetRxRing(&AxiDma);
+	TxRingPtr = XAxiDma_GetTxRing(&AxiDma);
+
+	Status = TxSetup(&AxiDma);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed TX setup\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = RxSetup(&AxiDma);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed RX setup\r\n");
+		return XST_FAILURE;
+	}
+
+	/* Set up Interrupt system  */
+#ifndef SDT
+	Status = SetupIntrSystem(&Intc, &AxiDma, RX_INTR_ID);
+#else
+	Status = XSetupInterruptSystem(RxRingPtr, &RxIntrHandler,
+				       Config->IntrId[1], Config->IntrParent,
+				       XINTERRUPT_DEFAULT_PRIORITY);
+#endif
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed intr setup\r\n");
+		return XST_FAILURE;
+	}
+
+	RxDone = 0;
+	Error = 0;
+
+	for (Burst = 0; Burst < NUMBER_OF_BURSTS; Burst++) {
+		Status = SendBurst(&AxiDma, Burst * PKTS_PER_BURST);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Failed send burst %d\r\n", Burst);
+			goto Done;
+		}
+
+		/*
+		 * While the Rx ring is in polling mode its completion
+		 * interrupts are off and the BDs are retrieved here. The
+		 * driver goes back to interrupt mode after IDLE_POLLS empty
+		 * polls, which ends the loop once the burst is received.
+		 */
+		for (Wait = 0; Wait < POLL_TIMEOUT_COUNTER; Wait++) {
+			TxReclaim(TxRingPtr);
+			if (XAxiDma_BdRingIsPolling(RxRingPtr)) {
+				RxProcess(RxRingPtr);
+			} else if ((RxDone == (u32)((Burst + 1) *
+						   PKTS_PER_BURST)) ||
+				   (Error != 0)) {
+				break;
+			}
+		}
+
+		if ((Error != 0) || (Wait == POLL_TIMEOUT_COUNTER)) {
+			xil_printf("Receive failure in burst %d, %d packets "
+				   "received\r\n", Burst, RxDone);
+			Status = XST_FAILURE;
+			goto Done;
+		}
+	}
+
+	Status = CheckData();
+	if (Status != XST_SUCCESS) {
+		xil_printf("Data check failed\r\n");
+		goto Done;
+	}
+
+	XAxiDma_BdRingGetStats(RxRingPtr, &Stats, 0);
+	xil_printf("Rx ring: %d BDs, %d interrupts, %d polls (%d idle), "
+		   "%d mode switches\r\n", Stats.BdCnt, Stats.IntrCnt,
+		   Stats.PollCnt, Stats.IdlePollCnt, Stats.ModeSwitchCnt);
+	if (Stats.BdCnt != NUMBER_OF_PKTS) {
+		xil_printf("Rx ring counted %d of %d BDs\r\n", Stats.BdCnt,
+			   NUMBER_OF_PKTS);
+		Status = XST_FAILURE;
+		goto Done;
+	}
+
+	xil_printf("Successfully ran AXI DMA SG adaptive Example\r\n");
+
+#ifndef SDT
+	DisableIntrSystem(&Intc, RX_INTR_ID);
+#else
+	XDisconnectInterruptCntrl(Config->IntrId[1], Config->IntrParent);
+#endif
+
+Done:
+	xil_printf("--- Exiting main() --- \r\n");
+
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+*
+* This function checks the received packets. Packet N holds the bytes
+* N, N + 1, ... modulo 256.
+*
+* @param	None
+*
+* @return	- XST_SUCCESS if validation is successful
+*		- XST_FAILURE if validation fails.
+*
+* @note		None.
+*
+******************************************************************************/
+static int CheckData(void)
+{
+	u8 *RxPacket = (u8 *)RX_BUFFER_BASE;
+	int Pkt;
+	int Index;
+	u8 Value;
+
+	Xil_DCacheInvalidateRange((UINTPTR)RxPacket,
+				  MAX_PKT_LEN * NUMBER_OF_PKTS);
+
+	for (Pkt = 0; Pkt < NUMBER_OF_PKTS; Pkt++) {
+		Value = (u8)Pkt;
+		for (Index = 0; Index < MAX_PKT_LEN; Index++) {
+			if (*RxPacket != Value) {
+				xil_printf("Data error in packet %d byte %d: "
+					   "%x/%x\r\n", Pkt, Index, *RxPacket,
+					   Value);
+
+				return XST_FAILURE;
+			}
+			RxPacket++;
+			Value++;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+*
+* This function retrieves the Rx BDs completed by hardware through the
+* adaptive mode of the ring and frees them. It is called from the Rx
+* interrupt handler in interrupt mode and from the main loop in polling mode.
+*
+* @param	RxRingPtr is a pointer to RX channel of the DMA engine.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void RxProcess(XAxiDma_BdRing *RxRingPtr)
+{
+	int BdCount;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	u32 BdSts;
+	int Index;
+
+	/* At most POLL_BUDGET BDs, the mode is adapted to the count */
+	BdCount = XAxiDma_BdRingPoll(RxRingPtr, &BdPtr);
+	if (BdCount == 0) {
+		return;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0; Index < BdCount; Index++) {
+		BdSts = XAxiDma_BdGetSts(BdCurPtr);
+		if ((BdSts & XAXIDMA_BD_STS_ALL_ERR_MASK) ||
+		    (!(BdSts & XAXIDMA_BD_STS_COMPLETE_MASK))) {
+			Error = 1;
+			break;
+		}
+
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RxRingPtr, BdCurPtr);
+		RxDone += 1;
+	}
+
+	if (XAxiDma_BdRingFree(RxRingPtr, BdCount, BdPtr) != XST_SUCCESS) {
+		Error = 1;
+	}
+}
+
+/*****************************************************************************/
+/*
+*
+* This is the DMA RX interrupt handler function. It is only called while the
+* Rx ring is in interrupt mode.
+*
+* @param	Callback is a pointer to RX channel of the DMA engine.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void RxIntrHandler(void *Callback)
+{
+	XAxiDma_BdRing *RxRingPtr = (XAxiDma_BdRing *) Callback;
+	u32 IrqStatus;
+	int TimeOut;
+
+	/* Read and acknowledge pending interrupts */
+	IrqStatus = XAxiDma_BdRingGetIrq(RxRingPtr);
+	XAxiDma_BdRingAckIrq(RxRingPtr, IrqStatus);
+
+	if (!(IrqStatus & XAXIDMA_IRQ_ALL_MASK)) {
+		return;
+	}
+
+	if ((IrqStatus & XAXIDMA_IRQ_ERROR_MASK)) {
+
+		XAxiDma_BdRingDumpRegs(RxRingPtr);
+
+		Error = 1;
+
+		XAxiDma_Reset(&AxiDma);
+
+		TimeOut = RESET_TIMEOUT_COUNTER;
+
+		while (TimeOut) {
+			if (XAxiDma_ResetIsDone(&AxiDma)) {
+				break;
+			}
+
+			TimeOut -= 1;
+		}
+
+		return;
+	}
+
+	if ((IrqStatus & (XAXIDMA_IRQ_DELAY_MASK | XAXIDMA_IRQ_IOC_MASK))) {
+		RxProcess(RxRingPtr);
+	}
+}
+
+#ifndef SDT
+/*****************************************************************************/
+/*
+*
+* This function sets up the interrupt system so the Rx interrupt can occur
+* for the DMA, it assumes INTC component exists in the hardware system.
+*
+* @param	IntcInstancePtr is a pointer to the instance of the INTC.
+* @param	AxiDmaPtr is a pointer to the instance of the DMA engine
+* @param	RxIntrId is the RX channel Interrupt ID.
+*
+* @return
+*		- XST_SUCCESS if successful,
+*		- XST_FAILURE.if not successful
+*
+* @note		None.
+*
+******************************************************************************/
+static int SetupIntrSystem(INTC *IntcInstancePtr, XAxiDma *AxiDmaPtr,
+			   u16 RxIntrId)
+{
+	XAxiDma_BdRing *RxRingPtr = XAxiDma_GetRxRing(AxiDmaPtr);
+	int Status;
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+
+	Status = XIntc_Initialize(IntcInstancePtr, INTC_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed init intc\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XIntc_Connect(IntcInstancePtr, RxIntrId,
+			       (XInterruptHandler) RxIntrHandler, RxRingPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed rx connect intc\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XIntc_Start(IntcInstancePtr, XIN_REAL_MODE);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed to start intc\r\n");
+		return XST_FAILURE;
+	}
+
+	XIntc_Enable(IntcInstancePtr, RxIntrId);
+
+#else
+
+	XScuGic_Config *IntcConfig;
+
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_CfgInitialize(IntcInstancePtr, IntcConfig,
+				       IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XScuGic_SetPriorityTriggerType(IntcInstancePtr, RxIntrId, 0xA0, 0x3);
+
+	Status = XScuGic_Connect(IntcInstancePtr, RxIntrId,
+				 (Xil_InterruptHandler)RxIntrHandler,
+				 RxRingPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	XScuGic_Enable(IntcInstancePtr, RxIntrId);
+#endif
+
+	Xil_ExceptionInit();
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+				     (Xil_ExceptionHandler)INTC_HANDLER,
+				     (void *)IntcInstancePtr);
+
+	Xil_ExceptionEnable();
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function disables the Rx interrupt of the DMA engine.
+*
+* @param	IntcInstancePtr is the pointer to the INTC component instance
+* @param	RxIntrId is interrupt ID associated w/ DMA RX channel
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void DisableIntrSystem(INTC *IntcInstancePtr, u16 RxIntrId)
+{
+#ifdef XPAR_INTC_0_DEVICE_ID
+	XIntc_Disconnect(IntcInstancePtr, RxIntrId);
+#else
+	XScuGic_Disconnect(IntcInstancePtr, RxIntrId);
+#endif
+}
+#endif
+
+/*****************************************************************************/
+/*
+*
+* This function sets up the RX channel with one buffer per BD for all the
+* packets of the example, and enables the adaptive mode of the ring.
+*
+* @param	AxiDmaInstPtr is the pointer to the instance of the DMA engine.
+*
+* @return	- XST_SUCCESS if the setup is successful.
+*		- XST_FAILURE if fails.
+*
+* @note		None.
+*
+******************************************************************************/
+static int RxSetup(XAxiDma *AxiDmaInstPtr)
+{
+	XAxiDma_BdRing *RxRingPtr = XAxiDma_GetRxRing(AxiDmaInstPtr);
+	XAxiDma_Bd BdTemplate;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR RxBufferPtr;
+	int BdCount;
+	int Status;
+	int Index;
+
+	XAxiDma_BdRingIntDisable(RxRingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	BdCount = XAxiDma_BdRingCntCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT,
+					RX_BD_SPACE_HIGH - RX_BD_SPACE_BASE + 1);
+	if (BdCount < NUMBER_OF_PKTS) {
+		xil_printf("Rx BD space holds only %d BDs\r\n", BdCount);
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingCreate(RxRingPtr, RX_BD_SPACE_BASE,
+				      RX_BD_SPACE_BASE,
+				      XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Rx bd create failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(RxRingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Rx bd clone failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingAlloc(RxRingPtr, NUMBER_OF_PKTS, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Rx bd alloc failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	BdCurPtr = BdPtr;
+	RxBufferPtr = RX_BUFFER_BASE;
+
+	for (Index = 0; Index < NUMBER_OF_PKTS; Index++) {
+		Status = XAxiDma_BdSetBufAddr(BdCurPtr, RxBufferPtr);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Rx set buffer addr %x on BD %x failed %d\r\n",
+				   (unsigned int)RxBufferPtr,
+				   (UINTPTR)BdCurPtr, Status);
+			return XST_FAILURE;
+		}
+
+		Status = XAxiDma_BdSetLength(BdCurPtr, MAX_PKT_LEN,
+					     RxRingPtr->MaxTransferLen);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Rx set length %d on BD %x failed %d\r\n",
+				   MAX_PKT_LEN, (UINTPTR)BdCurPtr, Status);
+			return XST_FAILURE;
+		}
+
+		XAxiDma_BdSetCtrl(BdCurPtr, 0);
+		XAxiDma_BdSetId(BdCurPtr, RxBufferPtr);
+
+		RxBufferPtr += MAX_PKT_LEN;
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RxRingPtr, BdCurPtr);
+	}
+
+	Xil_DCacheFlushRange((UINTPTR)RX_BUFFER_BASE,
+			     MAX_PKT_LEN * NUMBER_OF_PKTS);
+
+	/*
+	 * The threshold set here is the lower bound of the adaptation, the
+	 * delay timer reports packets below a raised threshold
+	 */
+	Status = XAxiDma_BdRingSetCoalesce(RxRingPtr, COALESCING_COUNT,
+					   DELAY_TIMER_COUNT);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Rx set coalesce failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingSetAdaptive(RxRingPtr, POLL_BUDGET, IDLE_POLLS);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Rx set adaptive failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingToHw(RxRingPtr, NUMBER_OF_PKTS, BdPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Rx ToHw failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdRingIntEnable(RxRingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	Status = XAxiDma_BdRingStart(RxRingPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Rx start BD ring failed with %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+*
+* This function sets up the TX channel. Its completions are reclaimed by the
+* main loop, so the TX interrupts stay disabled.
+*
+* @param	AxiDmaInstPtr is the pointer to the instance of the DMA engine.
+*
+* @return	- XST_SUCCESS if the setup is successful.
+*		- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int TxSetup(XAxiDma *AxiDmaInstPtr)
+{
+	XAxiDma_BdRing *TxRingPtr = XAxiDma_GetTxRing(AxiDmaInstPtr);
+	XAxiDma_Bd BdTemplate;
+	int Status;
+	u32 BdCount;
+
+	XAxiDma_BdRingIntDisable(TxRingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	BdCount = XAxiDma_BdRingCntCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT,
+					(UINTPTR)TX_BD_SPACE_HIGH - (UINTPTR)TX_BD_SPACE_BASE + 1);
+
+	Status = XAxiDma_BdRingCreate(TxRingPtr, TX_BD_SPACE_BASE,
+				      TX_BD_SPACE_BASE,
+				      XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed create BD ring\r\n");
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(TxRingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed clone BDs\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingStart(TxRingPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed bd start\r\n");
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+*
+* This function frees the TX BDs completed by hardware.
+*
+* @param	TxRingPtr is a pointer to TX channel of the DMA engine.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void TxReclaim(XAxiDma_BdRing *TxRingPtr)
+{
+	XAxiDma_Bd *BdPtr;
+	int BdCount;
+
+	BdCount = XAxiDma_BdRingFromHw(TxRingPtr, XAXIDMA_ALL_BDS, &BdPtr);
+	if (BdCount > 0) {
+		if (XAxiDma_BdRingFree(TxRingPtr, BdCount, BdPtr) !=
+		    XST_SUCCESS) {
+			Error = 1;
+		}
+	}
+}
+
+/*****************************************************************************/
+/*
+*
+* This function transmits a burst of PKTS_PER_BURST single BD packets.
+*
+* @param	AxiDmaInstPtr points to the DMA engine instance
+* @param	FirstPkt is the number of the first packet of the burst
+*
+* @return
+* 		- XST_SUCCESS if the DMA accepts all the packets successfully,
+* 		- XST_FAILURE if error occurs
+*
+* @note		None.
+*
+******************************************************************************/
+static int SendBurst(XAxiDma *AxiDmaInstPtr, int FirstPkt)
+{
+	XAxiDma_BdRing *TxRingPtr = XAxiDma_GetTxRing(AxiDmaInstPtr);
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR BufferAddr;
+	u8 *TxPacket;
+	u8 Value;
+	int Status;
+	int Pkt;
+	int Index;
+
+	BufferAddr = TX_BUFFER_BASE + ((UINTPTR)FirstPkt * MAX_PKT_LEN);
+	TxPacket = (u8 *)BufferAddr;
+	for (Pkt = FirstPkt; Pkt < (FirstPkt + PKTS_PER_BURST); Pkt++) {
+		Value = (u8)Pkt;
+		for (Index = 0; Index < MAX_PKT_LEN; Index++) {
+			*TxPacket = Value;
+			TxPacket++;
+			Value++;
+		}
+	}
+	Xil_DCacheFlushRange(BufferAddr, MAX_PKT_LEN * PKTS_PER_BURST);
+
+	Status = XAxiDma_BdRingAlloc(TxRingPtr, PKTS_PER_BURST, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed bd alloc\r\n");
+		return XST_FAILURE;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Pkt = 0; Pkt < PKTS_PER_BURST; Pkt++) {
+		Status = XAxiDma_BdSetBufAddr(BdCurPtr, BufferAddr);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Tx set buffer addr %x on BD %x failed %d\r\n",
+				   (unsigned int)BufferAddr,
+				   (UINTPTR)BdCurPtr, Status);
+			return XST_FAILURE;
+		}
+
+		Status = XAxiDma_BdSetLength(BdCurPtr, MAX_PKT_LEN,
+					     TxRingPtr->MaxTransferLen);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Tx set length %d on BD %x failed %d\r\n",
+				   MAX_PKT_LEN, (UINTPTR)BdCurPtr, Status);
+			return XST_FAILURE;
+		}
+
+#ifndef SDT
+#if (XPAR_AXIDMA_0_SG_INCLUDE_STSCNTRL_STRM == 1)
+		/* The packet length is set in the last APP word, this is
+		 * for the loopback widget
+		 */
+		Status = XAxiDma_BdSetAppWord(BdCurPtr, XAXIDMA_LAST_APPWORD,
+					      MAX_PKT_LEN);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Set app word failed with %d\r\n", Status);
+		}
+#endif
+#else
+		if (TxRingPtr->HasStsCntrlStrm) {
+			/* The packet length is set in the last APP word, this
+			 * is for the loopback widget
+			 */
+			Status = XAxiDma_BdSetAppWord(BdCurPtr,
+						      XAXIDMA_LAST_APPWORD,
+						      MAX_PKT_LEN);
+			if (Status != XST_SUCCESS) {
+				xil_printf("Set app word failed with %d\r\n",
+					   Status);
+			}
+		}
+#endif
+
+		/* Every packet is a single BD with SOF and EOF set */
+		XAxiDma_BdSetCtrl(BdCurPtr, XAXIDMA_BD_CTRL_TXSOF_MASK |
+				  XAXIDMA_BD_CTRL_TXEOF_MASK);
+		XAxiDma_BdSetId(BdCurPtr, BufferAddr);
+
+		BufferAddr += MAX_PKT_LEN;
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(TxRingPtr, BdCurPtr);
+	}
+
+	Status = XAxiDma_BdRingToHw(TxRingPtr, PKTS_PER_BURST, BdPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed to hw, length %d\r\n",
+			   (int)XAxiDma_BdGetLength(BdPtr,
+						    TxRingPtr->MaxTransferLen));
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
@@ -77,6 +77,8 @@
  * 8.0   srt  01/29/14 Added support for Micro DMA Mode.
  * 9.2   vak  15/04/16 Fixed compilation warnings in axidma driver
  * 9.8   rsp  07/11/18 Fix cppcheck portability warnings. CR #1006164
+ * 9.20  mb   10/16/26 Added XAXIDMA_CACHE_INVALIDATE_RANGE() to invalidate
+ *		       several BDs at once.
  *
  * </pre>
  *****************************************************************************/
@@ -121,12 +123,16 @@ typedef u32 XAxiDma_Bd[XAXIDMA_BD_NUM_WORDS];
 #ifdef __aarch64__
 #define XAXIDMA_CACHE_FLUSH(BdPtr)
 #define XAXIDMA_CACHE_INVALIDATE(BdPtr)
+#define XAXIDMA_CACHE_INVALIDATE_RANGE(BdPtr, Bytes)
 #else
 #define XAXIDMA_CACHE_FLUSH(BdPtr) \
 	Xil_DCacheFlushRange((UINTPTR)(BdPtr), XAXIDMA_BD_HW_NUM_BYTES)
 
 #define XAXIDMA_CACHE_INVALIDATE(BdPtr) \
 	Xil_DCacheInvalidateRange((UINTPTR)(BdPtr), XAXIDMA_BD_HW_NUM_BYTES)
+
+#define XAXIDMA_CACHE_INVALIDATE_RANGE(BdPtr, Bytes) \
+	Xil_DCacheInvalidateRange((UINTPTR)(BdPtr), (Bytes))
 #endif
 
 /*****************************************************************************/
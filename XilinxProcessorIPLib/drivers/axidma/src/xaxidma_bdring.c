@@ -45,6 +45,12 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.20  mb   10/16/26  Invalidate BDs in batches in XAxiDma_BdRingFromHw().
+*		       Added adaptive interrupt/polling mode with
+*		       XAxiDma_BdRingSetAdaptive(), XAxiDma_BdRingPoll() and
+*		       XAxiDma_BdRingGetStats().
+*       mb   10/16/26  Never invalidate BDs past HwTail in
+*		       XAxiDma_BdRingFromHw().
 *
 * </pre>
 ******************************************************************************/
@@ -60,6 +66,14 @@
  */
 #define XAXIDMA_STOP_TIMEOUT	500000   /* about 100 milliseconds on 100MHz */
 
+/* Number of BDs XAxiDma_BdRingFromHw() invalidates with one cache operation
+ */
+#define XAXIDMA_BD_INVALIDATE_BATCH	8
+
+/* Largest packet coalescing threshold the hardware supports
+ */
+#define XAXIDMA_COALESCE_MAX		0xFF
+
 /**************************** Type Definitions *******************************/
 
 
@@ -339,6 +353,14 @@ u32 XAxiDma_BdRingCreate(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
 	RingPtr->PreCnt = 0;
 	RingPtr->PostCnt = 0;
 	RingPtr->Cyclic = 0;
+	RingPtr->Adaptive = 0;
+	RingPtr->Polling = 0;
+	RingPtr->PollBudget = 0;
+	RingPtr->IdlePollLimit = 0;
+	RingPtr->IdlePolls = 0;
+	RingPtr->CoalesceMin = 0;
+	RingPtr->Coalesce = 0;
+	memset(&RingPtr->Stats, 0, sizeof(RingPtr->Stats));
 
 	/* Make sure Alignment parameter meets minimum requirements */
 	if (Alignment < XAXIDMA_BD_MINIMUM_ALIGNMENT) {
@@ -746,6 +768,241 @@ void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing *RingPtr,
 	*TimerPtr = ((Cr & XAXIDMA_DELAY_MASK) >> XAXIDMA_DELAY_SHIFT);
 }
 
+/*****************************************************************************/
+/**
+ * Enable or disable the adaptive interrupt/polling mode of a ring. In this
+ * mode completed BDs are retrieved with XAxiDma_BdRingPoll() instead of
+ * XAxiDma_BdRingFromHw():
+ *
+ * - In interrupt mode the application calls XAxiDma_BdRingPoll() from its
+ *   completion handler. The packet coalescing threshold is doubled while
+ *   interrupts keep reporting at least a threshold worth of BDs, and halved
+ *   back towards the value set by the user when they report less than half.
+ * - When one call returns a full budget of BDs, the completion interrupts are
+ *   disabled and the ring is in polling mode; XAxiDma_BdRingIsPolling()
+ *   returns TRUE and the application calls XAxiDma_BdRingPoll() from its
+ *   main loop.
+ * - After IdlePolls consecutive polls that found no completed BD, the
+ *   completion interrupts are enabled again.
+ *
+ * <pre>
+ *        // Completion interrupt handler
+ *        XAxiDma_BdRingAckIrq(MyRingPtr, IrqStatus);
+ *        NumBd = XAxiDma_BdRingPoll(MyRingPtr, &MyBdSet);
+ *        // Process and free NumBd BDs
+ *
+ *        // Main loop
+ *        if (XAxiDma_BdRingIsPolling(MyRingPtr)) {
+ *            NumBd = XAxiDma_BdRingPoll(MyRingPtr, &MyBdSet);
+ *            // Process and free NumBd BDs
+ *        }
+ * </pre>
+ *
+ * The delay timer interrupt must be enabled, otherwise BDs below the raised
+ * coalescing threshold would not be reported.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	Budget is the maximum number of BDs returned by one call to
+ *		XAxiDma_BdRingPoll(). 0 disables the adaptive mode.
+ * @param	IdlePolls is the number of consecutive empty polls after which
+ *		the ring goes back to interrupt mode. Must be non zero when
+ *		Budget is non zero.
+ *
+ * @return
+ *		- XST_SUCCESS if the mode was updated
+ *		- XST_INVALID_PARAM if the ring is cyclic, IdlePolls is 0 or
+ *		the delay timer is disabled
+ *
+ * @note	The coalescing threshold at the time of the call is the lower
+ *		bound of the adaptation and is restored when the adaptive mode
+ *		is disabled.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSetAdaptive(XAxiDma_BdRing *RingPtr, u32 Budget,
+			      u32 IdlePolls)
+{
+	u32 Counter;
+	u32 Timer;
+
+	if (Budget == 0) {
+		if (RingPtr->Adaptive) {
+			RingPtr->Adaptive = 0;
+			XAxiDma_BdRingSetCoalesce(RingPtr, RingPtr->CoalesceMin,
+						  XAXIDMA_NO_CHANGE);
+			if (RingPtr->Polling) {
+				RingPtr->Polling = 0;
+				XAxiDma_BdRingIntEnable(RingPtr,
+					XAXIDMA_IRQ_IOC_MASK |
+					XAXIDMA_IRQ_DELAY_MASK);
+			}
+		}
+
+		return XST_SUCCESS;
+	}
+
+	XAxiDma_BdRingGetCoalesce(RingPtr, &Counter, &Timer);
+
+	if (RingPtr->Cyclic || (IdlePolls == 0) || (Timer == 0)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSetAdaptive: "
+			    "invalid parameters\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (!RingPtr->Adaptive) {
+		RingPtr->CoalesceMin = Counter;
+		RingPtr->Coalesce = Counter;
+		RingPtr->Polling = 0;
+		RingPtr->IdlePolls = 0;
+	}
+
+	RingPtr->PollBudget = Budget;
+	RingPtr->IdlePollLimit = IdlePolls;
+	RingPtr->Adaptive = 1;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Retrieve up to the poll budget of completed BDs and adapt the interrupt
+ * mode of the ring, see XAxiDma_BdRingSetAdaptive(). The returned BDs are
+ * handled as with XAxiDma_BdRingFromHw().
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for examination.
+ *
+ * @return	The number of BDs processed by hardware, 0 if none.
+ *
+ * @note	Without the adaptive mode this is XAxiDma_BdRingFromHw() for
+ *		all BDs, with the counters updated.
+ *
+ *		This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingPoll(XAxiDma_BdRing *RingPtr, XAxiDma_Bd **BdSetPtr)
+{
+	int BdCount;
+	u32 Coalesce;
+
+	if (!RingPtr->Adaptive) {
+		BdCount = XAxiDma_BdRingFromHw(RingPtr, XAXIDMA_ALL_BDS,
+					       BdSetPtr);
+		RingPtr->Stats.IntrCnt++;
+		RingPtr->Stats.BdCnt += BdCount;
+
+		return BdCount;
+	}
+
+	BdCount = XAxiDma_BdRingFromHw(RingPtr, (int)RingPtr->PollBudget,
+				       BdSetPtr);
+	RingPtr->Stats.BdCnt += BdCount;
+
+	if (RingPtr->Polling) {
+		RingPtr->Stats.PollCnt++;
+		if (BdCount != 0) {
+			RingPtr->IdlePolls = 0;
+
+			return BdCount;
+		}
+
+		RingPtr->Stats.IdlePollCnt++;
+		RingPtr->IdlePolls++;
+		if (RingPtr->IdlePolls >= RingPtr->IdlePollLimit) {
+			/* Traffic is gone, go back to interrupts. Status
+			 * raised while polling is left pending so that any
+			 * BD completed since the last poll interrupts at once.
+			 */
+			RingPtr->Coalesce = RingPtr->CoalesceMin;
+			XAxiDma_BdRingSetCoalesce(RingPtr, RingPtr->Coalesce,
+						  XAXIDMA_NO_CHANGE);
+			RingPtr->Polling = 0;
+			RingPtr->IdlePolls = 0;
+			RingPtr->Stats.ModeSwitchCnt++;
+			XAxiDma_BdRingIntEnable(RingPtr, XAXIDMA_IRQ_IOC_MASK |
+						XAXIDMA_IRQ_DELAY_MASK);
+		}
+
+		return BdCount;
+	}
+
+	RingPtr->Stats.IntrCnt++;
+
+	if ((u32)BdCount >= RingPtr->PollBudget) {
+		/* More work than one interrupt can take, switch to polling */
+		XAxiDma_BdRingIntDisable(RingPtr, XAXIDMA_IRQ_IOC_MASK |
+					 XAXIDMA_IRQ_DELAY_MASK);
+		RingPtr->Polling = 1;
+		RingPtr->IdlePolls = 0;
+		RingPtr->Stats.ModeSwitchCnt++;
+
+		return BdCount;
+	}
+
+	/* Stay in interrupt mode, adapt the coalescing threshold to the load
+	 */
+	Coalesce = RingPtr->Coalesce;
+	if ((u32)BdCount >= Coalesce) {
+		Coalesce *= 2;
+		if (Coalesce > XAXIDMA_COALESCE_MAX) {
+			Coalesce = XAXIDMA_COALESCE_MAX;
+		}
+		if (Coalesce > RingPtr->PollBudget) {
+			Coalesce = RingPtr->PollBudget;
+		}
+	} else if ((u32)BdCount < (Coalesce / 2)) {
+		Coalesce /= 2;
+		if (Coalesce < RingPtr->CoalesceMin) {
+			Coalesce = RingPtr->CoalesceMin;
+		}
+	}
+
+	if ((Coalesce != RingPtr->Coalesce) &&
+	    (XAxiDma_BdRingSetCoalesce(RingPtr, Coalesce,
+				       XAXIDMA_NO_CHANGE) == XST_SUCCESS)) {
+		RingPtr->Coalesce = Coalesce;
+	}
+
+	return BdCount;
+}
+
+/*****************************************************************************/
+/**
+ * Retrieve the completion counters of a ring. The counters are updated by
+ * XAxiDma_BdRingPoll() and wrap around; rates are derived by sampling them
+ * at a known interval.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	StatsPtr points to a memory location where the counters will be
+ *		copied.
+ * @param	Reset clears the counters after they are copied when non zero.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+void XAxiDma_BdRingGetStats(XAxiDma_BdRing *RingPtr,
+			    XAxiDma_BdRingStats *StatsPtr, int Reset)
+{
+	*StatsPtr = RingPtr->Stats;
+
+	if (Reset) {
+		memset(&RingPtr->Stats, 0, sizeof(RingPtr->Stats));
+	}
+}
+
 /*****************************************************************************/
 /**
  * Reserve locations in the BD ring. The set of returned BDs may be modified in
@@ -1216,12 +1473,15 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 	XAxiDma_Bd *CurBdPtr;
 	int BdCount;
 	int BdPartialCount;
+	int InvalCount;
+	int NumInval;
 	u32 BdSts;
 	u32 BdCr;
 
 	CurBdPtr = RingPtr->HwHead;
 	BdCount = 0;
 	BdPartialCount = 0;
+	InvalCount = 0;
 	BdSts = 0;
 	BdCr = 0;
 
@@ -1245,8 +1505,32 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing *RingPtr, int BdLimit,
 	 */
 
 	while (BdCount < BdLimit) {
+		/* Invalidate the next few BDs at once, as long as they are
+		 * contiguous, within the limit and owned by hardware. BDs
+		 * past HwTail may hold writes of the application that are
+		 * not flushed yet, invalidating them would drop these writes.
+		 */
+		if (InvalCount == 0) {
+			NumInval = (int)((RingPtr->LastBdAddr -
+					  (UINTPTR)CurBdPtr) /
+					 RingPtr->Separation) + 1;
+			if (NumInval > (BdLimit - BdCount)) {
+				NumInval = BdLimit - BdCount;
+			}
+			if (NumInval > (RingPtr->HwCnt - BdCount)) {
+				NumInval = RingPtr->HwCnt - BdCount;
+			}
+			if (NumInval > XAXIDMA_BD_INVALIDATE_BATCH) {
+				NumInval = XAXIDMA_BD_INVALIDATE_BATCH;
+			}
+			XAXIDMA_CACHE_INVALIDATE_RANGE(CurBdPtr,
+				((NumInval - 1) * RingPtr->Separation) +
+				XAXIDMA_BD_HW_NUM_BYTES);
+			InvalCount = NumInval;
+		}
+		InvalCount--;
+
 		/* Read the status */
-		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 
@@ -45,6 +45,9 @@
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
 * 9.15  adk  08/16/22  Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+* 9.20  mb   10/16/26  Added adaptive interrupt/polling mode with
+*		       XAxiDma_BdRingSetAdaptive(), XAxiDma_BdRingPoll() and
+*		       XAxiDma_BdRingGetStats().
 *
 * </pre>
 *
@@ -76,6 +79,18 @@ extern "C" {
 
 /**************************** Type Definitions *******************************/
 
+/** Completion counters of a BD ring, see XAxiDma_BdRingGetStats(). Dividing
+ * the counters by the time they were collected over gives interrupts per
+ * second versus BDs per second.
+ */
+typedef struct {
+	u32 IntrCnt;		/**< Completion interrupts handled */
+	u32 PollCnt;		/**< Polls made in polling mode */
+	u32 IdlePollCnt;	/**< Polls that found no completed BD */
+	u32 BdCnt;		/**< BDs completed */
+	u32 ModeSwitchCnt;	/**< Switches between interrupt and polling */
+} XAxiDma_BdRingStats;
+
 /** Container structure for descriptor storage control. If address translation
  * is enabled, then all addresses and pointers excluding FirstBdPhysAddr are
  * expressed in terms of the virtual address.
@@ -111,6 +126,14 @@ typedef struct {
 	int AllCnt;		/**< Total Number of BDs for channel */
 	int RingIndex;		/**< Ring Index */
 	int Cyclic;		/**< Check for cyclic DMA Mode */
+	int Adaptive;		/**< Adaptive interrupt/polling mode enabled */
+	volatile int Polling;	/**< Ring is polled, completion interrupts off */
+	u32 PollBudget;		/**< Max BDs returned by XAxiDma_BdRingPoll() */
+	u32 IdlePollLimit;	/**< Empty polls before going back to interrupts */
+	u32 IdlePolls;		/**< Consecutive empty polls */
+	u32 CoalesceMin;	/**< Coalescing threshold set by the user */
+	u32 Coalesce;		/**< Coalescing threshold currently in use */
+	XAxiDma_BdRingStats Stats; /**< Completion counters */
 } XAxiDma_BdRing;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -329,6 +352,26 @@ typedef struct {
 	 (XAxiDma_Bd*)(RingPtr)->LastBdAddr :		\
 	 (XAxiDma_Bd*)((u32)(BdPtr) - (RingPtr)->Separation))
 
+/****************************************************************************/
+/**
+* Check whether the ring is in the polling state of the adaptive mode. While
+* it is, completion interrupts are disabled and the application has to call
+* XAxiDma_BdRingPoll() from its main loop.
+*
+* @param	RingPtr is the BD ring to operate on.
+*
+* @return
+*		- TRUE if the ring has to be polled
+*		- FALSE otherwise
+*
+* @note
+*		C-style signature:
+*		int XAxiDma_BdRingIsPolling(XAxiDma_BdRing* RingPtr)
+*		This function is used only when system is configured as SG mode
+*
+*****************************************************************************/
+#define XAxiDma_BdRingIsPolling(RingPtr)  ((RingPtr)->Polling)
+
 /****************************************************************************/
 /**
 * Retrieve the contents of the channel status register
@@ -544,6 +587,11 @@ int XAxiDma_BdRingStart(XAxiDma_BdRing *RingPtr);
 int XAxiDma_BdRingSetCoalesce(XAxiDma_BdRing *RingPtr, u32 Counter, u32 Timer);
 void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing *RingPtr,
 			       u32 *CounterPtr, u32 *TimerPtr);
+int XAxiDma_BdRingSetAdaptive(XAxiDma_BdRing *RingPtr, u32 Budget,
+			      u32 IdlePolls);
+int XAxiDma_BdRingPoll(XAxiDma_BdRing *RingPtr, XAxiDma_Bd **BdSetPtr);
+void XAxiDma_BdRingGetStats(XAxiDma_BdRing *RingPtr,
+			    XAxiDma_BdRingStats *StatsPtr, int Reset);
 
 /* The following functions are for debug only
  */
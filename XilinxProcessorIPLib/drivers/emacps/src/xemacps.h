@@ -310,6 +310,7 @@
  * 3.9   hk   01/23/19 Add RX watermark support
  * 3.11  sd   02/14/20 Add clock support
  * 3.13  nsk  12/14/20 Updated the tcl to not to use the instance names.
+ * 3.21  mb   10/16/26 Add XEmacPs_SetScreenType1() for receive queue steering.
  *
  * </pre>
  *
@@ -857,6 +858,8 @@ LONG XEmacPs_PhyRead(XEmacPs *InstancePtr, u32 PhyAddress,
 LONG XEmacPs_PhyWrite(XEmacPs *InstancePtr, u32 PhyAddress,
 		      u32 RegisterNum, u16 PhyData);
 LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index);
+LONG XEmacPs_SetScreenType1(XEmacPs *InstancePtr, u8 Index, u8 QueueNum,
+			    u32 Match);
 
 LONG XEmacPs_SendPausePacket(XEmacPs *InstancePtr);
 void XEmacPs_DMABLengthUpdate(XEmacPs *InstancePtr, s32 BLength);
@@ -27,6 +27,8 @@
  * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
  * 3.0   hk   02/20/15 Added support for jumbo frames.
  * 3.2   hk   02/22/16 Added SGMII support for Zynq Ultrascale+ MPSoC.
+ * 3.21  mb   10/16/26 Added XEmacPs_SetScreenType1() to steer received
+ *                     frames to priority queues.
  * </pre>
  *****************************************************************************/
 
@@ -410,6 +412,47 @@ LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * Program a Type 1 screener. Received frames matching the screener are
+ * written to the receive ring of queue QueueNum instead of queue 0. A
+ * screener matches on the DS/TC byte of the IP header, the UDP destination
+ * port, or both, depending on the enable bits in Match.
+ *
+ * @param InstancePtr is a pointer to the instance to be worked on.
+ * @param Index is the screener to be programmed (0-15). The number of
+ *        screeners implemented is design dependent.
+ * @param QueueNum is the priority queue matching frames are steered to.
+ * @param Match is an OR of XEMACPS_SCRT1_DSTC_EN_MASK, the DS/TC value
+ *        shifted by XEMACPS_SCRT1_DSTC_SHIFT, XEMACPS_SCRT1_UDP_EN_MASK and
+ *        the UDP port shifted by XEMACPS_SCRT1_UDP_SHIFT. 0 disables the
+ *        screener.
+ *
+ * @return
+ * - XST_SUCCESS if the screener was programmed
+ * - XST_INVALID_PARAM if QueueNum is not a queue of this device
+ *
+ *****************************************************************************/
+LONG XEmacPs_SetScreenType1(XEmacPs *InstancePtr, u8 Index, u8 QueueNum,
+			    u32 Match)
+{
+	LONG Status;
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Index < (u8)XEMACPS_MAX_SCREEN_TYPE1);
+
+	if ((u32)QueueNum >= InstancePtr->MaxQueues) {
+		Status = (LONG)(XST_INVALID_PARAM);
+	} else {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 ((u32)XEMACPS_SCREEN_TYPE1_REG0 + ((u32)Index * (u32)4)),
+				 (Match & ~(u32)XEMACPS_SCRT1_QUEUE_MASK) |
+				 ((u32)QueueNum & (u32)XEMACPS_SCRT1_QUEUE_MASK));
+		Status = (LONG)(XST_SUCCESS);
+	}
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * Set options for the driver/device. The driver should be stopped with
@@ -293,6 +293,7 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 							reg */
 #define XEMACPS_MSBBUF_RXQBASE_OFFSET  0x000004D4U /**< MSB Buffer RX Q Base
 							reg */
+#define XEMACPS_SCREEN_TYPE1_REG0       0x00000500U /**< Screening Type1 Reg0 */
 #define XEMACPS_SCREEN_TYPE2_REG0       0x00000540U /** Screening Type2 Reg0 **/
 
 #define XEMACPS_INTQ1_IER_OFFSET     0x00000600U /**< Interrupt Q1 Enable
@@ -546,6 +547,21 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_RXWM_LOW_SHFT_MSK	16U	/**< Shift for RXWM low */
 /*@}*/
 
+/** @name Screening Type1 bit definitions
+ * @{
+ */
+#define XEMACPS_SCRT1_QUEUE_MASK	0x0000000FU	/**< Queue number */
+#define XEMACPS_SCRT1_DSTC_MASK		0x00000FF0U	/**< DS/TC byte match */
+#define XEMACPS_SCRT1_DSTC_SHIFT	4U		/**< Shift for DS/TC */
+#define XEMACPS_SCRT1_UDP_MASK		0x0FFFF000U	/**< UDP port match */
+#define XEMACPS_SCRT1_UDP_SHIFT		12U		/**< Shift for UDP port */
+#define XEMACPS_SCRT1_DSTC_EN_MASK	0x10000000U	/**< Enable DS/TC match */
+#define XEMACPS_SCRT1_UDP_EN_MASK	0x20000000U	/**< Enable UDP port
+							     match */
+#define XEMACPS_MAX_SCREEN_TYPE1	16U		/**< Type1 register
+							     space */
+/*@}*/
+
 /** @name Screening Type2 bit definitions
  * @{
  */
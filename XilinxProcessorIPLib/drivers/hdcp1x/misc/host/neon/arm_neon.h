@@ -0,0 +1,141 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file arm_neon.h
+*
+* Portable C model of the ARMv8 NEON and cryptographic extension intrinsics
+* used by sha1.c. It lets the ARMv8 CE path of the hdcp1x SHA-1 be built and
+* checked on a host which is not aarch64. The instructions follow the
+* pseudocode of the Arm Architecture Reference Manual for A-profile:
+* SHA1C, SHA1P, SHA1M and SHA1H.
+*
+* Vector lane i is the i-th element in memory order, as on a little endian
+* aarch64 target.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  mb   10/16/26 First Release
+*</pre>
+*
+*****************************************************************************/
+#ifndef ARM_NEON_H
+#define ARM_NEON_H
+
+#include <stdint.h>
+#include <string.h>
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	uint32_t Lane[4];
+} uint32x4_t;
+
+/************************** Function Definitions *****************************/
+
+static inline uint32x4_t vld1q_u32(const uint32_t *Ptr)
+{
+	uint32x4_t V;
+
+	memcpy(V.Lane, Ptr, sizeof(V.Lane));
+	return V;
+}
+
+static inline void vst1q_u32(uint32_t *Ptr, uint32x4_t V)
+{
+	memcpy(Ptr, V.Lane, sizeof(V.Lane));
+}
+
+static inline uint32x4_t vdupq_n_u32(uint32_t Value)
+{
+	uint32x4_t V;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		V.Lane[i] = Value;
+	}
+	return V;
+}
+
+static inline uint32_t vgetq_lane_u32(uint32x4_t V, int Lane)
+{
+	return V.Lane[Lane];
+}
+
+static inline uint32x4_t vaddq_u32(uint32x4_t A, uint32x4_t B)
+{
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		A.Lane[i] += B.Lane[i];
+	}
+	return A;
+}
+
+/* SHA1 ---------------------------------------------------------------------*/
+
+#define NEON_EMU_ROL(X, N)	(((X) << (N)) | ((X) >> (32 - (N))))
+
+#define NEON_EMU_SHA1_CHOOSE	0
+#define NEON_EMU_SHA1_PARITY	1
+#define NEON_EMU_SHA1_MAJORITY	2
+
+/* Four rounds of SHA1C, SHA1P or SHA1M, X is abcd and Y is e */
+static inline uint32x4_t NeonEmuSha1Hash(uint32x4_t X, uint32_t Y,
+	uint32x4_t W, int Func)
+{
+	uint32_t T;
+	int e;
+
+	for (e = 0; e < 4; e++) {
+		if (Func == NEON_EMU_SHA1_CHOOSE) {
+			T = ((X.Lane[2] ^ X.Lane[3]) & X.Lane[1]) ^ X.Lane[3];
+		} else if (Func == NEON_EMU_SHA1_PARITY) {
+			T = X.Lane[1] ^ X.Lane[2] ^ X.Lane[3];
+		} else {
+			T = (X.Lane[1] & X.Lane[2]) |
+				((X.Lane[1] | X.Lane[2]) & X.Lane[3]);
+		}
+		Y = Y + NEON_EMU_ROL(X.Lane[0], 5) + T + W.Lane[e];
+		X.Lane[1] = NEON_EMU_ROL(X.Lane[1], 30);
+
+		/* (Y:X) = ROL(Y:X, 32) */
+		T = X.Lane[3];
+		X.Lane[3] = X.Lane[2];
+		X.Lane[2] = X.Lane[1];
+		X.Lane[1] = X.Lane[0];
+		X.Lane[0] = Y;
+		Y = T;
+	}
+	return X;
+}
+
+static inline uint32x4_t vsha1cq_u32(uint32x4_t HashAbcd, uint32_t HashE,
+	uint32x4_t Wk)
+{
+	return NeonEmuSha1Hash(HashAbcd, HashE, Wk, NEON_EMU_SHA1_CHOOSE);
+}
+
+static inline uint32x4_t vsha1pq_u32(uint32x4_t HashAbcd, uint32_t HashE,
+	uint32x4_t Wk)
+{
+	return NeonEmuSha1Hash(HashAbcd, HashE, Wk, NEON_EMU_SHA1_PARITY);
+}
+
+static inline uint32x4_t vsha1mq_u32(uint32x4_t HashAbcd, uint32_t HashE,
+	uint32x4_t Wk)
+{
+	return NeonEmuSha1Hash(HashAbcd, HashE, Wk, NEON_EMU_SHA1_MAJORITY);
+}
+
+static inline uint32_t vsha1h_u32(uint32_t HashE)
+{
+	return NEON_EMU_ROL(HashE, 30);
+}
+
+#endif /* ARM_NEON_H */
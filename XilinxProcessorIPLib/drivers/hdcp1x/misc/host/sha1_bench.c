@@ -0,0 +1,178 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file sha1_bench.c
+*
+* Host benchmark of the hdcp1x SHA-1 on the repeater V computation. V is
+* the SHA-1 of the KSV list, BINFO/BSTATUS and M0, up to 645 bytes for the
+* maximum topology of 127 devices. The list is fed to SHA1Input in one call,
+* as XHdcp1x_TxValidateKsvList does, a KSV FIFO read (15 bytes) at a time
+* and a KSV (5 bytes) at a time, as XHdcp1x_RxCalculateSHA1Value does.
+*
+* The ARMv8 CE build of sha1.c is timed only when it runs on the SHA1
+* instructions, not on the C model of the intrinsics.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  mb   10/16/26 First Release
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sha1.h"
+
+/************************** Constant Definitions *****************************/
+#define BENCH_KSV_SIZE		5	/* XHDCP1X_PORT_SIZE_BKSV */
+#define BENCH_KSV_FIFO_SIZE	15	/* XHDCP1X_PORT_SIZE_KSVFIFO */
+#define BENCH_KSV_MAX		127
+
+/**************************** Type Definitions *******************************/
+/** One build of sha1.c */
+typedef struct {
+	const char *Name;
+	int (*Reset)(SHA1Context *Context);
+	int (*Input)(SHA1Context *Context, const uint8_t *Data,
+		unsigned int Length);
+	int (*Result)(SHA1Context *Context, uint8_t Digest[SHA1HashSize]);
+} BenchBackend;
+
+/************************** Function Prototypes ******************************/
+/* The builds of sha1.c, renamed by the Makefile */
+int SHA1ResetGeneric(SHA1Context *Context);
+int SHA1InputGeneric(SHA1Context *Context, const uint8_t *Data,
+	unsigned int Length);
+int SHA1ResultGeneric(SHA1Context *Context, uint8_t Digest[SHA1HashSize]);
+int SHA1ResetCe(SHA1Context *Context);
+int SHA1InputCe(SHA1Context *Context, const uint8_t *Data,
+	unsigned int Length);
+int SHA1ResultCe(SHA1Context *Context, uint8_t Digest[SHA1HashSize]);
+
+/************************** Variable Definitions *****************************/
+static const BenchBackend BenchBackends[] = {
+	{ "generic", SHA1ResetGeneric, SHA1InputGeneric, SHA1ResultGeneric },
+#ifdef SHA1_BENCH_CE
+	{ "ARMv8 CE", SHA1ResetCe, SHA1InputCe, SHA1ResultCe },
+#endif
+};
+
+static uint8_t BenchList[BENCH_KSV_MAX * BENCH_KSV_SIZE];
+
+/************************** Function Definitions *****************************/
+
+static double BenchNow(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (double)Ts.tv_sec + ((double)Ts.tv_nsec * 1e-9);
+}
+
+/* One V computation over DeviceCount KSVs, the list in Chunk byte pieces */
+static void BenchV(const BenchBackend *Be, int DeviceCount,
+	unsigned int Chunk, uint8_t Digest[SHA1HashSize])
+{
+	static const uint8_t M0[8] = { 0xEF, 0xCD, 0xAB, 0x89,
+		0x67, 0x45, 0x23, 0x01 };
+	SHA1Context Context;
+	uint8_t Info[2];
+	unsigned int Len = (unsigned int)DeviceCount * BENCH_KSV_SIZE;
+	unsigned int Offset;
+	unsigned int Size;
+
+	Be->Reset(&Context);
+	for (Offset = 0; Offset < Len; Offset += Size) {
+		Size = ((Len - Offset) < Chunk) ? (Len - Offset) : Chunk;
+		Be->Input(&Context, &BenchList[Offset], Size);
+	}
+	Info[0] = (uint8_t)DeviceCount;
+	Info[1] = 1;
+	Be->Input(&Context, Info, 2);
+	Be->Input(&Context, M0, 8);
+	Be->Result(&Context, Digest);
+}
+
+/* Time per V computation in us */
+static double BenchTime(const BenchBackend *Be, int DeviceCount,
+	unsigned int Chunk, int Iterations)
+{
+	uint8_t Digest[SHA1HashSize];
+	uint8_t Check[SHA1HashSize];
+	double Start;
+	int i;
+
+	/* Every feeding must give the same V */
+	BenchV(Be, DeviceCount, Chunk, Digest);
+	BenchV(&BenchBackends[0], DeviceCount, 1, Check);
+	if (memcmp(Digest, Check, SHA1HashSize) != 0) {
+		printf("FAIL %s: V of %d KSVs in %u byte pieces\n", Be->Name,
+			DeviceCount, Chunk);
+		exit(1);
+	}
+
+	Start = BenchNow();
+	for (i = 0; i < Iterations; i++) {
+		BenchV(Be, DeviceCount, Chunk, Digest);
+	}
+
+	return (BenchNow() - Start) * 1e6 / Iterations;
+}
+
+static void BenchRun(const BenchBackend *Be, int DeviceCount, int Iterations)
+{
+	unsigned int Len = (unsigned int)DeviceCount * BENCH_KSV_SIZE;
+	double PerKsv;
+	double PerRead;
+	double OnePass;
+
+	PerKsv = BenchTime(Be, DeviceCount, BENCH_KSV_SIZE, Iterations);
+	PerRead = BenchTime(Be, DeviceCount, BENCH_KSV_FIFO_SIZE, Iterations);
+	OnePass = BenchTime(Be, DeviceCount, (Len > 0) ? Len : 1, Iterations);
+
+	printf("%-10s %7d %7u %10.2f %10.2f %10.2f %7.2fx\n", Be->Name,
+		DeviceCount, Len + 10, PerKsv, PerRead, OnePass,
+		PerKsv / OnePass);
+}
+
+int main(int argc, char *argv[])
+{
+	static const int Counts[] = { 1, 9, 32, BENCH_KSV_MAX };
+	int Scale = 1;
+	size_t b, c;
+	unsigned int i;
+
+	if (argc > 1) {
+		Scale = atoi(argv[1]);
+		if (Scale <= 0) {
+			fprintf(stderr, "usage: %s [scale]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	for (i = 0; i < sizeof(BenchList); i++) {
+		BenchList[i] = (uint8_t)((i * 0x3B) + 0x5C);
+	}
+
+	printf("%-10s %7s %7s %10s %10s %10s %8s\n", "us per V", "KSVs",
+		"bytes", "per KSV", "per read", "one pass", "speedup");
+	for (b = 0; b < sizeof(BenchBackends) / sizeof(BenchBackends[0]);
+			b++) {
+		for (c = 0; c < sizeof(Counts) / sizeof(Counts[0]); c++) {
+			BenchRun(&BenchBackends[b], Counts[c],
+				(200000 / Counts[c]) * Scale);
+		}
+	}
+
+	return 0;
+}
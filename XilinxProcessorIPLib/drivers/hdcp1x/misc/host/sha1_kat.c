@@ -0,0 +1,348 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file sha1_kat.c
+*
+* Host known answer tests of the hdcp1x SHA-1. sha1.c is built twice, with
+* the portable C rounds and with the ARMv8 cryptographic extension code, and
+* the public functions of each build are renamed with a Generic or Ce
+* suffix. Both backends are checked against the FIPS 180 example vectors
+* fed in one call and in chunks, so that SHA1Input takes both the whole
+* block path and the partial block path, and against the V value of KSV
+* lists laid out as XHdcp1x_TxValidateKsvList and
+* XHdcp1x_RxCalculateSHA1Value hash them. Then the backends are compared
+* with each other on pseudo random messages and on every KSV list length.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  mb   10/16/26 First Release
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha1.h"
+
+/************************** Constant Definitions *****************************/
+#define KAT_SHA_MAX_LEN		300
+#define KAT_SHA_MILLION		1000000
+#define KAT_KSV_SIZE		5	/* XHDCP1X_PORT_SIZE_BKSV */
+#define KAT_KSV_FIFO_SIZE	15	/* XHDCP1X_PORT_SIZE_KSVFIFO */
+#define KAT_KSV_MAX		127
+#define KAT_M0			0x0123456789ABCDEFull
+
+/**************************** Type Definitions *******************************/
+/** One build of sha1.c */
+typedef struct {
+	const char *Name;
+	int (*Reset)(SHA1Context *Context);
+	int (*Input)(SHA1Context *Context, const uint8_t *Data,
+		unsigned int Length);
+	int (*Result)(SHA1Context *Context, uint8_t Digest[SHA1HashSize]);
+} KatBackend;
+
+/** SHA-1 example vector, Repeat copies of Msg */
+typedef struct {
+	const char *Name;
+	const char *Msg;
+	uint32_t Repeat;
+	const char *Digest;
+} KatShaVector;
+
+/** V of a KSV list of DeviceCount devices, see KatKsvMessage() */
+typedef struct {
+	int DeviceCount;
+	const char *Digest;
+} KatKsvVector;
+
+/************************** Function Prototypes ******************************/
+/* The builds of sha1.c, renamed by the Makefile */
+int SHA1ResetGeneric(SHA1Context *Context);
+int SHA1InputGeneric(SHA1Context *Context, const uint8_t *Data,
+	unsigned int Length);
+int SHA1ResultGeneric(SHA1Context *Context, uint8_t Digest[SHA1HashSize]);
+int SHA1ResetCe(SHA1Context *Context);
+int SHA1InputCe(SHA1Context *Context, const uint8_t *Data,
+	unsigned int Length);
+int SHA1ResultCe(SHA1Context *Context, uint8_t Digest[SHA1HashSize]);
+
+/************************** Variable Definitions *****************************/
+static const KatBackend KatBackends[] = {
+	{ "generic", SHA1ResetGeneric, SHA1InputGeneric, SHA1ResultGeneric },
+	{ "ARMv8 CE", SHA1ResetCe, SHA1InputCe, SHA1ResultCe },
+};
+
+/* FIPS 180 examples of SHA-1, and the empty message */
+static const KatShaVector KatShaVectors[] = {
+	{ "empty", "", 1,
+	  "da39a3ee5e6b4b0d3255bfef95601890afd80709" },
+	{ "one block", "abc", 1,
+	  "a9993e364706816aba3e25717850c26c9cd0d89d" },
+	{ "two blocks",
+	  "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+	  "84983e441c3bd26ebaae4aa1f95129e5e54670f1" },
+	{ "896 bits",
+	  "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+	  "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 1,
+	  "a49b2446a02c645bf419f995b67091253a04a259" },
+	{ "million a", "a", KAT_SHA_MILLION,
+	  "34aa973cd4c4daa4f61eeb2bdbad27316534016f" },
+};
+
+/*
+ * The messages are 5 * DeviceCount + 10 bytes long, none a multiple of
+ * 64: 55 and 60 bytes sit either side of the one block padding limit and
+ * 645 bytes is the maximum topology.
+ */
+static const KatKsvVector KatKsvVectors[] = {
+	{ 1, "9f7fbd32410648214bf69bb98e4ca7c92faa3e83" },
+	{ 3, "c0de6dceb7f06afdc6327045dd0eec6f8bafcbed" },
+	{ 9, "b1568d2e47fe7b28584e9603fcdc0e110cac7985" },
+	{ 10, "7656274dd3cd58c8646ab2fbc0f6deb6f8e028e3" },
+	{ 11, "4d6b088132175fd3ec6a59d3e6eb2cad3777e78c" },
+	{ 13, "973f0ba6031cdb956f5dd36daf11249ccdee02f3" },
+	{ KAT_KSV_MAX, "6fa962c764a4d0f7989bd1f4b4c74c868881387c" },
+};
+
+/* Chunk sizes for feeding the example vectors */
+static const unsigned int KatChunks[] = { 1, 3, 5, 15, 63, 64, 65, 200 };
+
+static uint32_t KatSeed = 0x9E3779B9;
+static int KatErrors;
+
+/************************** Function Definitions *****************************/
+
+static uint32_t KatRand(void)
+{
+	KatSeed ^= KatSeed << 13;
+	KatSeed ^= KatSeed >> 17;
+	KatSeed ^= KatSeed << 5;
+	return KatSeed;
+}
+
+static void KatRandom(uint8_t *Buf, uint32_t Len)
+{
+	uint32_t i;
+
+	for (i = 0; i < Len; i++) {
+		Buf[i] = (uint8_t)KatRand();
+	}
+}
+
+static void KatHex(uint8_t *Buf, const char *Hex, uint32_t Len)
+{
+	unsigned int Byte;
+	uint32_t i;
+
+	for (i = 0; i < Len; i++) {
+		sscanf(&Hex[2 * i], "%2x", &Byte);
+		Buf[i] = (uint8_t)Byte;
+	}
+}
+
+static void KatCheck(int Ok, const char *Backend, const char *Test)
+{
+	if (!Ok) {
+		printf("FAIL %s: %s\n", Backend, Test);
+		KatErrors++;
+	}
+}
+
+/* Hashes Msg fed to SHA1Input in pieces of Chunk bytes, 0 for one call */
+static int KatHash(const KatBackend *Be, const uint8_t *Msg, uint32_t Len,
+	unsigned int Chunk, uint8_t Digest[SHA1HashSize])
+{
+	SHA1Context Context;
+	unsigned int Size;
+	uint32_t Offset = 0;
+	int Status;
+
+	Status = Be->Reset(&Context);
+	if (Chunk == 0) {
+		Chunk = Len;
+	}
+	while ((Status == shaSuccess) && (Offset < Len)) {
+		Size = ((Len - Offset) < Chunk) ? (Len - Offset) : Chunk;
+		Status = Be->Input(&Context, &Msg[Offset], Size);
+		Offset += Size;
+	}
+	if (Status == shaSuccess) {
+		Status = Be->Result(&Context, Digest);
+	}
+
+	return Status;
+}
+
+/*
+ * The message V is computed over: the KSV list as read from the KSV FIFO,
+ * BINFO/BSTATUS (device count, depth) and M0, little endian.
+ */
+static uint32_t KatKsvMessage(uint8_t *Msg, int DeviceCount)
+{
+	uint64_t M0 = KAT_M0;
+	uint32_t Len = (uint32_t)DeviceCount * KAT_KSV_SIZE;
+	uint32_t i;
+
+	for (i = 0; i < Len; i++) {
+		Msg[i] = (uint8_t)((i * 0x3B) + 0x5C);
+	}
+	Msg[Len++] = (uint8_t)DeviceCount;
+	Msg[Len++] = 1;
+	for (i = 0; i < 8; i++) {
+		Msg[Len++] = (uint8_t)(M0 & 0xFF);
+		M0 >>= 8;
+	}
+
+	return Len;
+}
+
+static void KatSha(const KatBackend *Be)
+{
+	uint8_t Digest[SHA1HashSize], Out[SHA1HashSize];
+	char Test[80];
+	uint8_t *Msg;
+	uint32_t MsgLen;
+	uint32_t Len;
+	uint32_t i;
+	size_t v, c;
+
+	for (v = 0; v < sizeof(KatShaVectors) / sizeof(KatShaVectors[0]); v++) {
+		Len = (uint32_t)strlen(KatShaVectors[v].Msg);
+		MsgLen = Len * KatShaVectors[v].Repeat;
+		Msg = malloc(MsgLen + 1);
+		if (Msg == NULL) {
+			printf("out of memory\n");
+			exit(2);
+		}
+		for (i = 0; i < KatShaVectors[v].Repeat; i++) {
+			memcpy(Msg + (i * Len), KatShaVectors[v].Msg, Len);
+		}
+
+		KatHex(Digest, KatShaVectors[v].Digest, SHA1HashSize);
+		KatCheck((KatHash(Be, Msg, MsgLen, 0, Out) == shaSuccess) &&
+			(memcmp(Out, Digest, SHA1HashSize) == 0), Be->Name,
+			KatShaVectors[v].Name);
+		for (c = 0; c < sizeof(KatChunks) / sizeof(KatChunks[0]); c++) {
+			snprintf(Test, sizeof(Test), "%s, %u byte chunks",
+				KatShaVectors[v].Name, KatChunks[c]);
+			KatCheck((KatHash(Be, Msg, MsgLen, KatChunks[c],
+				Out) == shaSuccess) &&
+				(memcmp(Out, Digest, SHA1HashSize) == 0),
+				Be->Name, Test);
+		}
+		free(Msg);
+	}
+}
+
+/*
+ * The single pass used by XHdcp1x_TxValidateKsvList, the list in one call
+ * followed by BINFO/BSTATUS and M0, must give the known V. So must the
+ * earlier per FIFO read feeding and the per KSV feeding of
+ * XHdcp1x_RxCalculateSHA1Value.
+ */
+static void KatKsv(const KatBackend *Be)
+{
+	uint8_t Msg[(KAT_KSV_MAX * KAT_KSV_SIZE) + 10];
+	uint8_t Digest[SHA1HashSize], Out[SHA1HashSize];
+	static const unsigned int Chunks[] = { 0, KAT_KSV_FIFO_SIZE,
+		KAT_KSV_SIZE, 1 };
+	SHA1Context Context;
+	char Test[80];
+	unsigned int Chunk;
+	unsigned int Size;
+	uint32_t ListLen;
+	uint32_t Offset;
+	uint32_t Len;
+	size_t v, c;
+	int Ok;
+
+	for (v = 0; v < sizeof(KatKsvVectors) / sizeof(KatKsvVectors[0]); v++) {
+		Len = KatKsvMessage(Msg, KatKsvVectors[v].DeviceCount);
+		ListLen = Len - 10;
+		KatHex(Digest, KatKsvVectors[v].Digest, SHA1HashSize);
+
+		for (c = 0; c < sizeof(Chunks) / sizeof(Chunks[0]); c++) {
+			Ok = (Be->Reset(&Context) == shaSuccess);
+			Chunk = (Chunks[c] == 0) ? ListLen : Chunks[c];
+			for (Offset = 0; Offset < ListLen; Offset += Size) {
+				Size = ((ListLen - Offset) < Chunk) ?
+					(ListLen - Offset) : Chunk;
+				Ok &= (Be->Input(&Context, &Msg[Offset], Size) ==
+					shaSuccess);
+			}
+			Ok &= (Be->Input(&Context, &Msg[ListLen], 2) ==
+				shaSuccess);
+			Ok &= (Be->Input(&Context, &Msg[ListLen + 2], 8) ==
+				shaSuccess);
+			Ok &= (Be->Result(&Context, Out) == shaSuccess);
+			snprintf(Test, sizeof(Test),
+				"V of %d KSVs, list in %u byte pieces",
+				KatKsvVectors[v].DeviceCount, Chunk);
+			KatCheck(Ok && (memcmp(Out, Digest, SHA1HashSize) == 0),
+				Be->Name, Test);
+		}
+	}
+}
+
+/* The CE backend must match the generic one on any input */
+static void KatCompare(const KatBackend *Ref, const KatBackend *Be)
+{
+	uint8_t Msg[(KAT_KSV_MAX * KAT_KSV_SIZE) + 10];
+	uint8_t Digest[SHA1HashSize], RefDigest[SHA1HashSize];
+	char Test[80];
+	unsigned int Chunk;
+	uint32_t Len;
+	int DeviceCount;
+
+	/* Every length up to KAT_SHA_MAX_LEN covers the padding cases */
+	for (Len = 0; Len < KAT_SHA_MAX_LEN; Len++) {
+		KatRandom(Msg, Len);
+		Chunk = 1 + (KatRand() % 100);
+		KatHash(Ref, Msg, Len, 0, RefDigest);
+		KatHash(Be, Msg, Len, Chunk, Digest);
+		snprintf(Test, sizeof(Test),
+			"random %u bytes in %u byte chunks",
+			(unsigned int)Len, Chunk);
+		KatCheck(memcmp(Digest, RefDigest, SHA1HashSize) == 0,
+			Be->Name, Test);
+	}
+
+	for (DeviceCount = 0; DeviceCount <= KAT_KSV_MAX; DeviceCount++) {
+		Len = KatKsvMessage(Msg, DeviceCount);
+		KatHash(Ref, Msg, Len, 1, RefDigest);
+		KatHash(Be, Msg, Len, 0, Digest);
+		snprintf(Test, sizeof(Test), "V of %d KSVs", DeviceCount);
+		KatCheck(memcmp(Digest, RefDigest, SHA1HashSize) == 0,
+			Be->Name, Test);
+	}
+}
+
+int main(void)
+{
+	size_t b;
+
+	for (b = 0; b < sizeof(KatBackends) / sizeof(KatBackends[0]); b++) {
+		KatSha(&KatBackends[b]);
+		KatKsv(&KatBackends[b]);
+		KatCompare(&KatBackends[0], &KatBackends[b]);
+	}
+
+	if (KatErrors != 0) {
+		printf("sha1_kat: %d checks failed\n", KatErrors);
+		return 1;
+	}
+
+	printf("sha1_kat: SHA-1 and KSV list checks passed, "
+		"generic and " SHA1_KAT_CE_BUILD " ARMv8 CE backends\n");
+	return 0;
+}
@@ -31,15 +31,33 @@
 
 #include "sha1.h"
 
+/*
+ *  Use the ARMv8 SHA1 instructions when the compiler targets the
+ *  cryptographic extension (for example -march=armv8-a+crypto)
+ */
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+#define SHA1_USE_ARMV8_CE
+#include <arm_neon.h>
+#endif
+
 /*
  *  Define the SHA1 circular left shift macro
  */
 #define SHA1CircularShift(bits,word) \
                 (((word) << (bits)) | ((word) >> (32-(bits))))
 
+/*
+ *  Define the SHA1 big endian word load macro
+ */
+#define SHA1LoadWord(p) \
+                (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | \
+                 ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3])
+
 /* Local Function Prototyptes */
 void SHA1PadMessage(SHA1Context *);
 void SHA1ProcessMessageBlock(SHA1Context *);
+static void SHA1ProcessBlock(uint32_t Intermediate_Hash[SHA1HashSize/4],
+                             const uint8_t *block);
 
 /*
  *  SHA1Reset
@@ -183,28 +201,63 @@ int SHA1Input(    SHA1Context    *context,
     {
          return context->Corrupted;
     }
-    while(length-- && !context->Corrupted)
-    {
-    context->Message_Block[context->Message_Block_Index++] =
-                    (*message_array & 0xFF);
 
-    context->Length_Low += 8;
-    if (context->Length_Low == 0)
+    /*
+     *  Update the message length in bits
+     */
+    context->Length_Low += (uint32_t)length << 3;
+    if (context->Length_Low < ((uint32_t)length << 3))
     {
         context->Length_High++;
-        if (context->Length_High == 0)
+    }
+    context->Length_High += (uint32_t)length >> 29;
+    if (context->Length_High < ((uint32_t)length >> 29))
+    {
+        /* Message is too long */
+        context->Corrupted = shaInputTooLong;
+        return context->Corrupted;
+    }
+
+    /*
+     *  Complete a partially filled message block first
+     */
+    if (context->Message_Block_Index > 0)
+    {
+        unsigned fill = 64 - context->Message_Block_Index;
+
+        if (fill > length)
         {
-            /* Message is too long */
-            context->Corrupted = 1;
+            fill = length;
+        }
+        memcpy(&context->Message_Block[context->Message_Block_Index],
+               message_array, fill);
+        context->Message_Block_Index += fill;
+        message_array += fill;
+        length -= fill;
+
+        if (context->Message_Block_Index == 64)
+        {
+            SHA1ProcessMessageBlock(context);
         }
     }
 
-    if (context->Message_Block_Index == 64)
+    /*
+     *  Process whole blocks directly from the caller's buffer
+     */
+    while (length >= 64)
     {
-        SHA1ProcessMessageBlock(context);
+        SHA1ProcessBlock(context->Intermediate_Hash, message_array);
+        message_array += 64;
+        length -= 64;
     }
 
-    message_array++;
+    /*
+     *  Keep the remainder for the next call
+     */
+    if (length)
+    {
+        memcpy(context->Message_Block, message_array, length);
+        context->Message_Block_Index = length;
     }
 
     return shaSuccess;
@@ -232,6 +285,95 @@ int SHA1Input(    SHA1Context    *context,
  *
  */
 void SHA1ProcessMessageBlock(SHA1Context *context)
+{
+    SHA1ProcessBlock(context->Intermediate_Hash, context->Message_Block);
+
+    context->Message_Block_Index = 0;
+}
+
+/*
+ *  SHA1ProcessBlock
+ *
+ *  Description:
+ *      This function will process 512 bits of the message stored at
+ *      block, which need not be word aligned, and update the
+ *      intermediate hash.
+ *
+ *  Parameters:
+ *      Intermediate_Hash: [in/out]
+ *          The intermediate hash to update.
+ *      block: [in]
+ *          The 64 octet message block.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ */
+#ifdef SHA1_USE_ARMV8_CE
+static void SHA1ProcessBlock(uint32_t Intermediate_Hash[SHA1HashSize/4],
+                             const uint8_t *block)
+{
+    int           t;                 /* Loop counter                */
+    uint32_t      W[80];             /* Word sequence               */
+    uint32x4_t    ABCD;              /* Word buffers A, B, C and D  */
+    uint32x4_t    WK;                /* Four words plus constant    */
+    uint32_t      E, E_Next;         /* Word buffer E               */
+
+    for(t = 0; t < 16; t++)
+    {
+        W[t] = SHA1LoadWord(&block[t * 4]);
+    }
+
+    for(t = 16; t < 80; t++)
+    {
+       W[t] = SHA1CircularShift(1,W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16]);
+    }
+
+    ABCD = vld1q_u32(Intermediate_Hash);
+    E = Intermediate_Hash[4];
+
+    /*
+     *  Each instruction performs four rounds, E for the next four
+     *  rounds is A rotated left by 30 before the rounds
+     */
+    for(t = 0; t < 20; t += 4)
+    {
+        WK = vaddq_u32(vld1q_u32(&W[t]), vdupq_n_u32(0x5A827999));
+        E_Next = vsha1h_u32(vgetq_lane_u32(ABCD, 0));
+        ABCD = vsha1cq_u32(ABCD, E, WK);
+        E = E_Next;
+    }
+
+    for(t = 20; t < 40; t += 4)
+    {
+        WK = vaddq_u32(vld1q_u32(&W[t]), vdupq_n_u32(0x6ED9EBA1));
+        E_Next = vsha1h_u32(vgetq_lane_u32(ABCD, 0));
+        ABCD = vsha1pq_u32(ABCD, E, WK);
+        E = E_Next;
+    }
+
+    for(t = 40; t < 60; t += 4)
+    {
+        WK = vaddq_u32(vld1q_u32(&W[t]), vdupq_n_u32(0x8F1BBCDC));
+        E_Next = vsha1h_u32(vgetq_lane_u32(ABCD, 0));
+        ABCD = vsha1mq_u32(ABCD, E, WK);
+        E = E_Next;
+    }
+
+    for(t = 60; t < 80; t += 4)
+    {
+        WK = vaddq_u32(vld1q_u32(&W[t]), vdupq_n_u32(0xCA62C1D6));
+        E_Next = vsha1h_u32(vgetq_lane_u32(ABCD, 0));
+        ABCD = vsha1pq_u32(ABCD, E, WK);
+        E = E_Next;
+    }
+
+    vst1q_u32(Intermediate_Hash, vaddq_u32(vld1q_u32(Intermediate_Hash), ABCD));
+    Intermediate_Hash[4] += E;
+}
+#else
+static void SHA1ProcessBlock(uint32_t Intermediate_Hash[SHA1HashSize/4],
+                             const uint8_t *block)
 {
     const uint32_t K[] =    {       /* Constants defined in SHA-1   */
                             0x5A827999,
@@ -241,35 +383,35 @@ void SHA1ProcessMessageBlock(SHA1Context *context)
                             };
     int           t;                 /* Loop counter                */
     uint32_t      temp;              /* Temporary word value        */
-    uint32_t      W[80];             /* Word sequence               */
+    uint32_t      W[16];             /* Rolling word sequence       */
     uint32_t      A, B, C, D, E;     /* Word buffers                */
 
     /*
-     *  Initialize the first 16 words in the array W
+     *  Initialize the first 16 words in the array W, later words
+     *  are computed in place as they are needed
      */
     for(t = 0; t < 16; t++)
     {
-        W[t] = context->Message_Block[t * 4] << 24;
-        W[t] |= context->Message_Block[t * 4 + 1] << 16;
-        W[t] |= context->Message_Block[t * 4 + 2] << 8;
-        W[t] |= context->Message_Block[t * 4 + 3];
+        W[t] = SHA1LoadWord(&block[t * 4]);
     }
 
-    for(t = 16; t < 80; t++)
-    {
-       W[t] = SHA1CircularShift(1,W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16]);
-    }
+#define SHA1W(t) \
+    ((t) < 16 ? W[(t)] : \
+     (W[(t) & 15] = SHA1CircularShift(1, W[((t) + 13) & 15] ^ \
+                                         W[((t) + 8) & 15] ^ \
+                                         W[((t) + 2) & 15] ^ \
+                                         W[(t) & 15])))
 
-    A = context->Intermediate_Hash[0];
-    B = context->Intermediate_Hash[1];
-    C = context->Intermediate_Hash[2];
-    D = context->Intermediate_Hash[3];
-    E = context->Intermediate_Hash[4];
+    A = Intermediate_Hash[0];
+    B = Intermediate_Hash[1];
+    C = Intermediate_Hash[2];
+    D = Intermediate_Hash[3];
+    E = Intermediate_Hash[4];
 
     for(t = 0; t < 20; t++)
     {
         temp =  SHA1CircularShift(5,A) +
-                ((B & C) | ((~B) & D)) + E + W[t] + K[0];
+                ((B & C) | ((~B) & D)) + E + SHA1W(t) + K[0];
         E = D;
         D = C;
         C = SHA1CircularShift(30,B);
@@ -280,7 +422,7 @@ void SHA1ProcessMessageBlock(SHA1Context *context)
 
     for(t = 20; t < 40; t++)
     {
-        temp = SHA1CircularShift(5,A) + (B ^ C ^ D) + E + W[t] + K[1];
+        temp = SHA1CircularShift(5,A) + (B ^ C ^ D) + E + SHA1W(t) + K[1];
         E = D;
         D = C;
         C = SHA1CircularShift(30,B);
@@ -291,7 +433,7 @@ void SHA1ProcessMessageBlock(SHA1Context *context)
     for(t = 40; t < 60; t++)
     {
         temp = SHA1CircularShift(5,A) +
-               ((B & C) | (B & D) | (C & D)) + E + W[t] + K[2];
+               ((B & C) | (B & D) | (C & D)) + E + SHA1W(t) + K[2];
         E = D;
         D = C;
         C = SHA1CircularShift(30,B);
@@ -301,7 +443,7 @@ void SHA1ProcessMessageBlock(SHA1Context *context)
 
     for(t = 60; t < 80; t++)
     {
-        temp = SHA1CircularShift(5,A) + (B ^ C ^ D) + E + W[t] + K[3];
+        temp = SHA1CircularShift(5,A) + (B ^ C ^ D) + E + SHA1W(t) + K[3];
         E = D;
         D = C;
         C = SHA1CircularShift(30,B);
@@ -309,14 +451,15 @@ void SHA1ProcessMessageBlock(SHA1Context *context)
         A = temp;
     }
 
-    context->Intermediate_Hash[0] += A;
-    context->Intermediate_Hash[1] += B;
-    context->Intermediate_Hash[2] += C;
-    context->Intermediate_Hash[3] += D;
-    context->Intermediate_Hash[4] += E;
+#undef SHA1W
 
-    context->Message_Block_Index = 0;
+    Intermediate_Hash[0] += A;
+    Intermediate_Hash[1] += B;
+    Intermediate_Hash[2] += C;
+    Intermediate_Hash[3] += D;
+    Intermediate_Hash[4] += E;
 }
+#endif
 
 /*
  *  SHA1PadMessage
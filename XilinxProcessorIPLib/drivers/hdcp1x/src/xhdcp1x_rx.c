@@ -49,6 +49,8 @@
 *                       XHdcp1x_RxSetTopologyMaxDevsExceeded,
 *                       XHdcp1x_RxCheckEncryptionChange.
 * 4.1   yas    11/10/16 Added function XHdcp1x_RxSetHdmiMode.
+* 4.3   mb     10/16/26 Check the device count once when hashing the KSV
+*                       list in XHdcp1x_RxCalculateSHA1Value.
 * </pre>
 *
 *****************************************************************************/
@@ -1357,16 +1359,17 @@ static int XHdcp1x_RxCalculateSHA1Value(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 	 */
 	KsvCount = 0;
 
+	if ((NumToRead > 0) &&
+	    (InstancePtr->RepeaterValues.DeviceCount == 0)) {
+		IsValid = FALSE;
+		KsvCount = NumToRead;
+	}
+
 	while (KsvCount < NumToRead) {
-		if (InstancePtr->RepeaterValues.DeviceCount > 0) {
-			tempKsv = InstancePtr->RepeaterValues.KsvList[KsvCount];
-			XHDCP1X_PORT_UINT_TO_BUF(Buf , tempKsv ,
-					(XHDCP1X_PORT_SIZE_BKSV*8));
-			SHA1Input(&Sha1Context , Buf , XHDCP1X_PORT_SIZE_BKSV);
-		}
-		else {
-			IsValid = FALSE;
-		}
+		tempKsv = InstancePtr->RepeaterValues.KsvList[KsvCount];
+		XHDCP1X_PORT_UINT_TO_BUF(Buf , tempKsv ,
+				(XHDCP1X_PORT_SIZE_BKSV*8));
+		SHA1Input(&Sha1Context , Buf , XHDCP1X_PORT_SIZE_BKSV);
 		KsvCount++;
 	}
 
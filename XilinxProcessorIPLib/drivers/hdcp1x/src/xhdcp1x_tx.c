@@ -53,6 +53,8 @@
 *                       it available in XHdcp1x_TxGetTopology().
 *                       Updating the XHdcp1x_TxReset() to clear the
 *                       Authentication Request flag.
+* 4.3   mb     10/16/26 Hash the KSV list in one pass from the read buffer
+*                       in XHdcp1x_TxValidateKsvList.
 * </pre>
 *
 *****************************************************************************/
@@ -1952,32 +1954,21 @@ static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 		 * structure to be read later by RX */
 
 		u64 Value = 0;
-		u32 Index;
 		while (ByteCount < NumToRead) {
-			if((ByteCount + 1) % 5 == 0) {
-
-				Index = (((ByteCount+1) / XHDCP1X_PORT_SIZE_BKSV) - 1) * XHDCP1X_PORT_SIZE_BKSV;
-
-				XHDCP1X_PORT_BUF_TO_UINT(Value ,
-						(ksvListHolder + ( (((ByteCount+1)
-						/ XHDCP1X_PORT_SIZE_BKSV) - 1)
-						* XHDCP1X_PORT_SIZE_BKSV)),
+			XHDCP1X_PORT_BUF_TO_UINT(Value ,
+					(ksvListHolder + ByteCount),
 					XHDCP1X_PORT_SIZE_BKSV * 8);
-				if (!(Value)) {
-					XHdcp1x_TxDebugLog(InstancePtr ,
-						"Error: Null KSV read "
-						"from downstream KSV List");
-				}
-				InstancePtr->RepeaterValues.KsvList[KsvCount++] =
-					(Value & 0xFFFFFFFFFFul);
-				Value = 0;
+			if (!(Value)) {
+				XHdcp1x_TxDebugLog(InstancePtr ,
+					"Error: Null KSV read "
+					"from downstream KSV List");
 			}
+			InstancePtr->RepeaterValues.KsvList[KsvCount++] =
+				(Value & 0xFFFFFFFFFFul);
+			Value = 0;
 
-			ByteCount++;
-
+			ByteCount += XHDCP1X_PORT_SIZE_BKSV;
 		}
-
-		UNUSED(Index);
 	}
 	else {
 		/* Update the statistics */
@@ -2008,20 +1999,10 @@ static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 			NumOfKsvsThisTime = NumOfKsvsToRead;
 		}
 
-		/* Read the next chunk of the list */
+		/* Read the next chunk of the list straight into the list */
 		if (XHdcp1x_PortRead(InstancePtr, XHDCP1X_PORT_OFFSET_KSVFIFO,
-				Buf, NumThisTime) > 0) {
-
-			/* Update the calculation of V */
-			SHA1Input(&Sha1Context, Buf, NumThisTime);
-
-			/* Duplicate the buffer */
-			int BufReadKsvCount=0;
-			while(BufReadKsvCount < NumThisTime) {
-				ksvListHolder[ksvListByteCount++] = Buf[BufReadKsvCount];
-				BufReadKsvCount++;
-			}
-
+				&ksvListHolder[ksvListByteCount], NumThisTime) > 0) {
+			ksvListByteCount += NumThisTime;
 		}
 		else {
 			/* Update the statistics */
@@ -2037,6 +2018,11 @@ static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 
 	} while ((NumToRead > 0) && (IsValid));
 
+	/* Update the calculation of V over the whole list in one pass */
+	if (IsValid) {
+		SHA1Input(&Sha1Context, ksvListHolder, ksvListByteCount);
+	}
+
 #endif
 
 	/* Check for success */
@@ -0,0 +1,208 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file crypto_bench.c
+*
+* Host benchmark of the hdcp22_common AES-128 and SHA-256 backends. An
+* AES-128 block is timed in both directions, as XHdcp22Cmn_Aes128Encrypt is
+* called once per 16 byte block with its key. SHA-256 is timed on message
+* sizes of the HDCP 2.2 protocol, from one block up to the 522 byte
+* receiver certificate and a 1 KB message.
+*
+* The time per call is reported in ns. When the clock of the CPU is given
+* in MHz, the cycles per byte are reported too, as time * clock; the host
+* must then run at a fixed clock for them to be meaningful.
+*
+* The ARMv8 CE build of aes.c and sha2.c is timed only when it runs on the
+* AES and SHA256 instructions, not on the C model of the intrinsics.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  mb   10/16/26 First Release
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define BENCH_AES_BLOCK		16
+#define BENCH_SHA_MAX		1024
+#define BENCH_SHA_DIGEST	32
+#define BENCH_ITERATIONS	4000000 /* Bytes processed per measurement */
+
+/**************************** Type Definitions *******************************/
+/** One build of aes.c and sha2.c */
+typedef struct {
+	const char *Name;
+	void (*Encrypt)(const u8 *Data, const u8 *Key, u8 *Output);
+	void (*Decrypt)(const u8 *Data, const u8 *Key, u8 *Output);
+	void (*Hash)(const u8 *Data, u32 DataSize, u8 *HashedData);
+} BenchBackend;
+
+/************************** Function Prototypes ******************************/
+/* The builds of aes.c and sha2.c, renamed by the Makefile */
+void XHdcp22Cmn_Aes128EncryptGeneric(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Aes128DecryptGeneric(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Sha256HashGeneric(const u8 *Data, u32 DataSize, u8 *HashedData);
+void XHdcp22Cmn_Aes128EncryptCe(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Aes128DecryptCe(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Sha256HashCe(const u8 *Data, u32 DataSize, u8 *HashedData);
+
+/************************** Variable Definitions *****************************/
+static const BenchBackend BenchBackends[] = {
+	{ "generic", XHdcp22Cmn_Aes128EncryptGeneric,
+	  XHdcp22Cmn_Aes128DecryptGeneric, XHdcp22Cmn_Sha256HashGeneric },
+#ifdef CRYPTO_BENCH_CE
+	{ "ARMv8 CE", XHdcp22Cmn_Aes128EncryptCe,
+	  XHdcp22Cmn_Aes128DecryptCe, XHdcp22Cmn_Sha256HashCe },
+#endif
+};
+
+/* Message sizes: a short and the longest one block message, two blocks,
+ * the receiver certificate and 1 KB */
+static const u32 BenchShaSizes[] = { 16, 55, 64, 522, BENCH_SHA_MAX };
+
+static u8 BenchMsg[BENCH_SHA_MAX];
+static double BenchMhz;
+
+/************************** Function Definitions *****************************/
+
+static double BenchNow(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (double)Ts.tv_sec + ((double)Ts.tv_nsec * 1e-9);
+}
+
+static void BenchPrint(const char *Backend, const char *Op, u32 Bytes,
+	double Ns)
+{
+	printf("%-10s %-12s %6u %10.1f %9.1f", Backend, Op, Bytes, Ns,
+		(double)Bytes * 1e3 / Ns);
+	if (BenchMhz > 0.0) {
+		printf(" %10.1f\n", Ns * BenchMhz * 1e-3 / (double)Bytes);
+	}
+	else {
+		printf(" %10s\n", "-");
+	}
+}
+
+/* Time per AES-128 block in ns, the output chained into the next input */
+static double BenchAes(void (*Aes)(const u8 *Data, const u8 *Key,
+	u8 *Output), int Iterations)
+{
+	static const u8 Key[BENCH_AES_BLOCK] = { 0x2b, 0x7e, 0x15, 0x16,
+		0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf,
+		0x4f, 0x3c };
+	u8 Block[BENCH_AES_BLOCK];
+	u8 Out[BENCH_AES_BLOCK];
+	double Start;
+	int i;
+
+	memcpy(Block, BenchMsg, sizeof(Block));
+	Start = BenchNow();
+	for (i = 0; i < Iterations; i++) {
+		Aes(Block, Key, Out);
+		memcpy(Block, Out, sizeof(Block));
+	}
+
+	return (BenchNow() - Start) * 1e9 / Iterations;
+}
+
+/* Time per SHA-256 of Size bytes in ns */
+static double BenchSha(const BenchBackend *Be, u32 Size, int Iterations)
+{
+	u8 Digest[BENCH_SHA_DIGEST];
+	u8 Check[BENCH_SHA_DIGEST];
+	double Start;
+	int i;
+
+	/* Every backend must give the digest of the generic one */
+	Be->Hash(BenchMsg, Size, Digest);
+	BenchBackends[0].Hash(BenchMsg, Size, Check);
+	if (memcmp(Digest, Check, sizeof(Digest)) != 0) {
+		printf("FAIL %s: SHA-256 of %u bytes\n", Be->Name, Size);
+		exit(1);
+	}
+
+	Start = BenchNow();
+	for (i = 0; i < Iterations; i++) {
+		Be->Hash(BenchMsg, Size, Digest);
+	}
+
+	return (BenchNow() - Start) * 1e9 / Iterations;
+}
+
+static void BenchRun(const BenchBackend *Be, int Scale)
+{
+	static const u8 Key[BENCH_AES_BLOCK] = { 0 };
+	u8 Cipher[BENCH_AES_BLOCK];
+	u8 Plain[BENCH_AES_BLOCK];
+	int Iterations = (BENCH_ITERATIONS / BENCH_AES_BLOCK) * Scale;
+	size_t s;
+
+	/* Decrypt must undo Encrypt */
+	Be->Encrypt(BenchMsg, Key, Cipher);
+	Be->Decrypt(Cipher, Key, Plain);
+	if (memcmp(Plain, BenchMsg, sizeof(Plain)) != 0) {
+		printf("FAIL %s: AES-128 round trip\n", Be->Name);
+		exit(1);
+	}
+
+	BenchPrint(Be->Name, "aes encrypt", BENCH_AES_BLOCK,
+		BenchAes(Be->Encrypt, Iterations));
+	BenchPrint(Be->Name, "aes decrypt", BENCH_AES_BLOCK,
+		BenchAes(Be->Decrypt, Iterations));
+
+	for (s = 0; s < sizeof(BenchShaSizes) / sizeof(BenchShaSizes[0]);
+			s++) {
+		BenchPrint(Be->Name, "sha256", BenchShaSizes[s],
+			BenchSha(Be, BenchShaSizes[s],
+				(int)(BENCH_ITERATIONS / BenchShaSizes[s]) * Scale));
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	int Scale = 1;
+	size_t b;
+	unsigned int i;
+
+	if (argc > 1) {
+		Scale = atoi(argv[1]);
+	}
+	if (argc > 2) {
+		BenchMhz = atof(argv[2]);
+	}
+	if ((Scale <= 0) || (BenchMhz < 0.0) || (argc > 3)) {
+		fprintf(stderr, "usage: %s [scale [MHz]]\n", argv[0]);
+		return 2;
+	}
+
+	for (i = 0; i < sizeof(BenchMsg); i++) {
+		BenchMsg[i] = (u8)((i * 0x3B) + 0x5C);
+	}
+
+	printf("%-10s %-12s %6s %10s %9s %10s\n", "backend", "operation",
+		"bytes", "ns/call", "MB/s", "cycles/B");
+	for (b = 0; b < sizeof(BenchBackends) / sizeof(BenchBackends[0]);
+			b++) {
+		BenchRun(&BenchBackends[b], Scale);
+	}
+
+	return 0;
+}
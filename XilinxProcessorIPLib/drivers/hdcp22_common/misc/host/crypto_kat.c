@@ -0,0 +1,257 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file crypto_kat.c
+*
+* Host known answer tests of the hdcp22_common AES-128 and SHA-256 backends.
+* aes.c and sha2.c are built twice, with the portable table code and with
+* the ARMv8 cryptographic extension code, and the public functions of each
+* build are renamed with a Generic or Ce suffix. Both backends are checked
+* against the FIPS-197 and FIPS-180 example vectors and then against each
+* other on pseudo random inputs, including every SHA-256 message length
+* around the padding boundaries.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  mb   10/16/26 First Release
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define KAT_RANDOM_CASES	1000
+#define KAT_SHA_MAX_LEN		300
+#define KAT_SHA_MILLION		1000000
+
+/**************************** Type Definitions *******************************/
+/** One build of aes.c and sha2.c */
+typedef struct {
+	const char *Name;
+	void (*Encrypt)(const u8 *Data, const u8 *Key, u8 *Output);
+	void (*Decrypt)(const u8 *Data, const u8 *Key, u8 *Output);
+	void (*Hash)(const u8 *Data, u32 DataSize, u8 *HashedData);
+} KatBackend;
+
+/** AES-128 example vector */
+typedef struct {
+	const char *Name;
+	const char *Key;
+	const char *Plain;
+	const char *Cipher;
+} KatAesVector;
+
+/** SHA-256 example vector, Repeat copies of Msg */
+typedef struct {
+	const char *Name;
+	const char *Msg;
+	u32 Repeat;
+	const char *Digest;
+} KatShaVector;
+
+/************************** Function Prototypes ******************************/
+/* The builds of aes.c and sha2.c, renamed by the Makefile */
+void XHdcp22Cmn_Aes128EncryptGeneric(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Aes128DecryptGeneric(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Sha256HashGeneric(const u8 *Data, u32 DataSize, u8 *HashedData);
+void XHdcp22Cmn_Aes128EncryptCe(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Aes128DecryptCe(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Sha256HashCe(const u8 *Data, u32 DataSize, u8 *HashedData);
+
+/************************** Variable Definitions *****************************/
+static const KatBackend KatBackends[] = {
+	{ "generic", XHdcp22Cmn_Aes128EncryptGeneric,
+	  XHdcp22Cmn_Aes128DecryptGeneric, XHdcp22Cmn_Sha256HashGeneric },
+	{ "ARMv8 CE", XHdcp22Cmn_Aes128EncryptCe,
+	  XHdcp22Cmn_Aes128DecryptCe, XHdcp22Cmn_Sha256HashCe },
+};
+
+/* FIPS-197 Appendix B and Appendix C.1 */
+static const KatAesVector KatAesVectors[] = {
+	{ "FIPS-197 B",
+	  "2b7e151628aed2a6abf7158809cf4f3c",
+	  "3243f6a8885a308d313198a2e0370734",
+	  "3925841d02dc09fbdc118597196a0b32" },
+	{ "FIPS-197 C.1",
+	  "000102030405060708090a0b0c0d0e0f",
+	  "00112233445566778899aabbccddeeff",
+	  "69c4e0d86a7b0430d8cdb78070b4c55a" },
+};
+
+/* FIPS-180 examples of SHA-256, and the empty message */
+static const KatShaVector KatShaVectors[] = {
+	{ "empty", "", 1,
+	  "e3b0c44298fc1c149afbf4c8996fb924"
+	  "27ae41e4649b934ca495991b7852b855" },
+	{ "one block", "abc", 1,
+	  "ba7816bf8f01cfea414140de5dae2223"
+	  "b00361a396177a9cb410ff61f20015ad" },
+	{ "two blocks",
+	  "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+	  "248d6a61d20638b8e5c026930c3e6039"
+	  "a33ce45964ff2167f6ecedd419db06c1" },
+	{ "896 bits",
+	  "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+	  "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 1,
+	  "cf5b16a778af8380036ce59e7b049237"
+	  "0b249b11e8f07a51afac45037afee9d1" },
+	{ "million a", "a", KAT_SHA_MILLION,
+	  "cdc76e5c9914fb9281a1c7e284d73e67"
+	  "f1809a48a497200e046d39ccc7112cd0" },
+};
+
+static u32 KatSeed = 0x9E3779B9;
+static int KatErrors;
+
+/************************** Function Definitions *****************************/
+
+static u32 KatRand(void)
+{
+	KatSeed ^= KatSeed << 13;
+	KatSeed ^= KatSeed >> 17;
+	KatSeed ^= KatSeed << 5;
+	return KatSeed;
+}
+
+static void KatRandom(u8 *Buf, u32 Len)
+{
+	u32 i;
+
+	for (i = 0; i < Len; i++) {
+		Buf[i] = (u8)KatRand();
+	}
+}
+
+static void KatHex(u8 *Buf, const char *Hex, u32 Len)
+{
+	unsigned int Byte;
+	u32 i;
+
+	for (i = 0; i < Len; i++) {
+		sscanf(&Hex[2 * i], "%2x", &Byte);
+		Buf[i] = (u8)Byte;
+	}
+}
+
+static void KatCheck(int Ok, const char *Backend, const char *Test)
+{
+	if (!Ok) {
+		printf("FAIL %s: %s\n", Backend, Test);
+		KatErrors++;
+	}
+}
+
+static void KatAes(const KatBackend *Be)
+{
+	u8 Key[16], Plain[16], Cipher[16], Out[16];
+	size_t v;
+
+	for (v = 0; v < sizeof(KatAesVectors) / sizeof(KatAesVectors[0]); v++) {
+		KatHex(Key, KatAesVectors[v].Key, 16);
+		KatHex(Plain, KatAesVectors[v].Plain, 16);
+		KatHex(Cipher, KatAesVectors[v].Cipher, 16);
+
+		Be->Encrypt(Plain, Key, Out);
+		KatCheck(memcmp(Out, Cipher, 16) == 0, Be->Name,
+			KatAesVectors[v].Name);
+		Be->Decrypt(Cipher, Key, Out);
+		KatCheck(memcmp(Out, Plain, 16) == 0, Be->Name,
+			KatAesVectors[v].Name);
+	}
+}
+
+static void KatSha(const KatBackend *Be)
+{
+	u8 Digest[32], Out[32];
+	u8 *Msg;
+	u32 MsgLen;
+	u32 Len;
+	u32 i;
+	size_t v;
+
+	for (v = 0; v < sizeof(KatShaVectors) / sizeof(KatShaVectors[0]); v++) {
+		Len = (u32)strlen(KatShaVectors[v].Msg);
+		MsgLen = Len * KatShaVectors[v].Repeat;
+		Msg = malloc(MsgLen + 1);
+		if (Msg == NULL) {
+			printf("out of memory\n");
+			exit(2);
+		}
+		for (i = 0; i < KatShaVectors[v].Repeat; i++) {
+			memcpy(Msg + (i * Len), KatShaVectors[v].Msg, Len);
+		}
+
+		KatHex(Digest, KatShaVectors[v].Digest, 32);
+		Be->Hash(Msg, MsgLen, Out);
+		KatCheck(memcmp(Out, Digest, 32) == 0, Be->Name,
+			KatShaVectors[v].Name);
+		free(Msg);
+	}
+}
+
+/* The CE backend must match the generic one on any input */
+static void KatCompare(const KatBackend *Ref, const KatBackend *Be)
+{
+	u8 Key[16], Plain[16], Out[16], RefOut[16], Back[16];
+	u8 Msg[KAT_SHA_MAX_LEN];
+	u8 Digest[32], RefDigest[32];
+	char Test[64];
+	u32 Len;
+	int i;
+
+	for (i = 0; i < KAT_RANDOM_CASES; i++) {
+		KatRandom(Key, sizeof(Key));
+		KatRandom(Plain, sizeof(Plain));
+		Ref->Encrypt(Plain, Key, RefOut);
+		Be->Encrypt(Plain, Key, Out);
+		KatCheck(memcmp(Out, RefOut, 16) == 0, Be->Name,
+			"AES encrypt, random");
+		Be->Decrypt(Out, Key, Back);
+		KatCheck(memcmp(Back, Plain, 16) == 0, Be->Name,
+			"AES decrypt, random");
+	}
+
+	/* Every length up to KAT_SHA_MAX_LEN covers the padding cases */
+	for (Len = 0; Len < KAT_SHA_MAX_LEN; Len++) {
+		KatRandom(Msg, Len);
+		Ref->Hash(Msg, Len, RefDigest);
+		Be->Hash(Msg, Len, Digest);
+		snprintf(Test, sizeof(Test), "SHA-256, random %u bytes",
+			(unsigned int)Len);
+		KatCheck(memcmp(Digest, RefDigest, 32) == 0, Be->Name, Test);
+	}
+}
+
+int main(void)
+{
+	size_t b;
+
+	for (b = 0; b < sizeof(KatBackends) / sizeof(KatBackends[0]); b++) {
+		KatAes(&KatBackends[b]);
+		KatSha(&KatBackends[b]);
+		if (b > 0) {
+			KatCompare(&KatBackends[0], &KatBackends[b]);
+		}
+	}
+
+	if (KatErrors != 0) {
+		printf("crypto_kat: %d checks failed\n", KatErrors);
+		return 1;
+	}
+
+	printf("crypto_kat: AES-128 and SHA-256 checks passed, "
+		"generic and " CRYPTO_KAT_CE_BUILD " ARMv8 CE backends\n");
+	return 0;
+}
@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/* BSP functions used by the hdcp22_common sources, mapped to the C library */
+#include <stdarg.h>
+#include <stdio.h>
+#include "xil_printf.h"
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	(void)vprintf(ctrl1, Args);
+	va_end(Args);
+}
@@ -0,0 +1,9 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/* BSP configuration of the host build, nothing is configured */
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#endif /* BSPCONFIG_H */
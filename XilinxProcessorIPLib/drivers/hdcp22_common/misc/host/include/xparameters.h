@@ -0,0 +1,9 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/* Hardware parameters of the host build, there is no hardware */
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#endif /* XPARAMETERS_H */
@@ -0,0 +1,380 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file montexp_bench.c
+*
+* Host check and microbenchmark of the hdcp22_common modular exponentiation.
+* XHdcp22Cmn_MontExp and XHdcp22Cmn_MontExpConstTime are compared with a
+* square and multiply reference for the HDCP 2.2 key sizes, with the software
+* Montgomery multiplication and with a multiplication handler standing in
+* for the MMULT core. The handler also counts the multiplications, which
+* must not depend on the exponent for XHdcp22Cmn_MontExpConstTime.
+* Then the time per exponentiation is measured for the TX public key
+* operations and the RX private key CRT halves, against the bigdigits
+* mpModExp used before. mpModExp is limited to 2048 bit moduli by the
+* MAX_FIXED_DIGITS temporaries of mpModMult, so the reference is built on
+* mpMultiply and mpDivide instead.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  mb   10/16/26 First Release
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions *****************************/
+#define BENCH_MAX_DIGITS	XHDCP22_CMN_MONT_MAX_DIGITS
+#define BENCH_RANDOM_CASES	20
+/** Largest precision mpModExp supports */
+#define BENCH_MODEXP_MAX_DIGITS	(MAX_FIXED_DIGITS / 2)
+
+/**************************** Type Definitions *******************************/
+/** Exponentiation function under test */
+typedef int (*BenchModExp)(u32 *C, const u32 *A, int ADigits, const u32 *E,
+	u32 *N, int NDigits, XHdcp22Cmn_MontMultHandler MontMult,
+	void *CallbackRef);
+
+/** Reference Montgomery multiplication, in place of the MMULT core */
+typedef struct {
+	u32 N[BENCH_MAX_DIGITS];	/**< Modulus */
+	u32 RInv[BENCH_MAX_DIGITS];	/**< R^(-1) mod N */
+	u32 Count;			/**< Number of multiplications */
+} BenchMontRef;
+
+/************************** Variable Definitions *****************************/
+static u32 BenchSeed = 0x2545F491;
+static int BenchErrors;
+
+/************************** Function Definitions *****************************/
+
+static u32 BenchRand(void)
+{
+	BenchSeed ^= BenchSeed << 13;
+	BenchSeed ^= BenchSeed >> 17;
+	BenchSeed ^= BenchSeed << 5;
+	return BenchSeed;
+}
+
+static void BenchRandom(u32 *A, int NDigits)
+{
+	int i;
+
+	for (i = 0; i < NDigits; i++) {
+		A[i] = BenchRand();
+	}
+}
+
+/* Random odd modulus with the top bit set */
+static void BenchModulus(u32 *N, int NDigits)
+{
+	BenchRandom(N, NDigits);
+	N[0] |= 0x1;
+	N[NDigits - 1] |= 0x80000000;
+}
+
+static double BenchNow(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (double)Ts.tv_sec + ((double)Ts.tv_nsec * 1e-9);
+}
+
+/* U = A*B mod N, U may be the same as A or B */
+static void BenchModMult(u32 *U, const u32 *A, const u32 *B, u32 *N,
+	int NDigits)
+{
+	u32 P[2 * BENCH_MAX_DIGITS];
+	u32 Q[2 * BENCH_MAX_DIGITS];
+	u32 R[2 * BENCH_MAX_DIGITS];
+
+	mpMultiply(P, A, B, NDigits);
+	mpDivide(Q, R, P, 2 * NDigits, N, NDigits);
+	memcpy(U, R, sizeof(u32) * NDigits);
+}
+
+/* C = A^E mod N by left-to-right square and multiply, A < N */
+static void BenchModExpRef(u32 *C, const u32 *A, const u32 *E, u32 *N,
+	int NDigits)
+{
+	u32 X[BENCH_MAX_DIGITS];
+	u32 One[BENCH_MAX_DIGITS];
+	int i;
+
+	mpSetDigit(One, 1, NDigits);
+	mpModulo(X, One, NDigits, N, NDigits);
+	for (i = (32 * NDigits) - 1; i >= 0; i--) {
+		BenchModMult(X, X, X, N, NDigits);
+		if (mpGetBit((u32 *)E, NDigits, i)) {
+			BenchModMult(X, X, A, N, NDigits);
+		}
+	}
+	memcpy(C, X, sizeof(u32) * NDigits);
+}
+
+/* U = A*B*R^(-1) mod N with bigdigits, R = 2^(32*NDigits) */
+static void BenchMontMultRef(void *CallbackRef, u32 *U, const u32 *A,
+	const u32 *B, int NDigits)
+{
+	BenchMontRef *Ref = (BenchMontRef *)CallbackRef;
+
+	BenchModMult(U, A, B, Ref->N, NDigits);
+	BenchModMult(U, U, Ref->RInv, Ref->N, NDigits);
+	Ref->Count++;
+}
+
+static void BenchMontRefInit(BenchMontRef *Ref, const u32 *N, int NDigits)
+{
+	u32 R[BENCH_MAX_DIGITS + 1];
+	u32 RModN[BENCH_MAX_DIGITS];
+
+	memset(R, 0, sizeof(R));
+	R[NDigits] = 1;
+	memcpy(Ref->N, N, sizeof(u32) * NDigits);
+	mpModulo(RModN, R, NDigits + 1, Ref->N, NDigits);
+	mpModInv(Ref->RInv, RModN, Ref->N, NDigits);
+	Ref->Count = 0;
+}
+
+/*
+ * Checks C = A^E mod N of Func against the reference, with the software
+ * multiplication and with the reference handler. Returns the number of
+ * handler multiplications.
+ */
+static u32 BenchCheck(const char *Name, BenchModExp Func, const u32 *A,
+	int ADigits, const u32 *E, u32 *N, int NDigits)
+{
+	u32 Ared[BENCH_MAX_DIGITS];
+	u32 Expect[BENCH_MAX_DIGITS];
+	u32 C[BENCH_MAX_DIGITS];
+	BenchMontRef Ref;
+
+	mpModulo(Ared, A, ADigits, N, NDigits);
+	BenchModExpRef(Expect, Ared, E, N, NDigits);
+
+	if ((Func(C, A, ADigits, E, N, NDigits, NULL, NULL) != XST_SUCCESS) ||
+	    (mpEqual(C, Expect, NDigits) == 0)) {
+		printf("FAIL %s, %d bits, software multiplication\n", Name,
+			32 * NDigits);
+		BenchErrors++;
+	}
+
+	BenchMontRefInit(&Ref, N, NDigits);
+	if ((Func(C, A, ADigits, E, N, NDigits, BenchMontMultRef, &Ref) !=
+	     XST_SUCCESS) || (mpEqual(C, Expect, NDigits) == 0)) {
+		printf("FAIL %s, %d bits, multiplication handler\n", Name,
+			32 * NDigits);
+		BenchErrors++;
+	}
+
+	return Ref.Count;
+}
+
+static void BenchCheckAll(void)
+{
+	static const int Sizes[] = { 16, 32, 96 };
+	static const int Cases[] = { BENCH_RANDOM_CASES, 8, 2 };
+	u32 A[2 * BENCH_MAX_DIGITS];
+	u32 E[BENCH_MAX_DIGITS];
+	u32 N[BENCH_MAX_DIGITS];
+	u32 Count;
+	u32 CountRef;
+	int NDigits;
+	int s, i;
+
+	for (s = 0; s < (int)(sizeof(Sizes) / sizeof(Sizes[0])); s++) {
+		NDigits = Sizes[s];
+		for (i = 0; i < Cases[s]; i++) {
+			BenchModulus(N, NDigits);
+			BenchRandom(A, NDigits);
+			mpSetZero(E, NDigits);
+
+			/* Public exponent e = 65537 */
+			E[0] = 65537;
+			BenchCheck("MontExp e=65537", XHdcp22Cmn_MontExp, A,
+				NDigits, E, N, NDigits);
+
+			/* Full size exponent, E = 0, E = 1 */
+			BenchRandom(E, NDigits);
+			BenchCheck("MontExp", XHdcp22Cmn_MontExp, A, NDigits, E,
+				N, NDigits);
+			CountRef = BenchCheck("MontExpConstTime",
+				XHdcp22Cmn_MontExpConstTime, A, NDigits, E, N,
+				NDigits);
+
+			mpSetZero(E, NDigits);
+			BenchCheck("MontExp E=0", XHdcp22Cmn_MontExp, A, NDigits,
+				E, N, NDigits);
+			Count = BenchCheck("MontExpConstTime E=0",
+				XHdcp22Cmn_MontExpConstTime, A, NDigits, E, N,
+				NDigits);
+			if (Count != CountRef) {
+				printf("FAIL MontExpConstTime, %d bits, %u "
+					"multiplications for E=0, %u for "
+					"random E\n", 32 * NDigits, Count,
+					CountRef);
+				BenchErrors++;
+			}
+
+			E[0] = 1;
+			BenchCheck("MontExpConstTime E=1",
+				XHdcp22Cmn_MontExpConstTime, A, NDigits, E, N,
+				NDigits);
+			memset(E, 0xFF, sizeof(u32) * NDigits);
+			Count = BenchCheck("MontExpConstTime E=2^k-1",
+				XHdcp22Cmn_MontExpConstTime, A, NDigits, E, N,
+				NDigits);
+			if (Count != CountRef) {
+				printf("FAIL MontExpConstTime, %d bits, %u "
+					"multiplications for E=2^k-1, %u for "
+					"random E\n", 32 * NDigits, Count,
+					CountRef);
+				BenchErrors++;
+			}
+		}
+	}
+
+	/* RX CRT half, 1024 bit base and 512 bit modulus */
+	for (i = 0; i < BENCH_RANDOM_CASES; i++) {
+		BenchModulus(N, 16);
+		BenchRandom(A, 32);
+		BenchRandom(E, 16);
+		BenchCheck("MontExpConstTime RX", XHdcp22Cmn_MontExpConstTime,
+			A, 32, E, N, 16);
+	}
+
+	/* Even modulus and unsupported sizes are rejected */
+	BenchModulus(N, 16);
+	N[0] &= ~0x1;
+	if ((XHdcp22Cmn_MontExp(A, A, 16, E, N, 16, NULL, NULL) !=
+	     XST_FAILURE) ||
+	    (XHdcp22Cmn_MontExpConstTime(A, A, 16, E, N, 16, NULL, NULL) !=
+	     XST_FAILURE) ||
+	    (XHdcp22Cmn_MontExp(A, A, 16, E, N, BENCH_MAX_DIGITS + 1, NULL,
+	     NULL) != XST_FAILURE)) {
+		printf("FAIL invalid arguments accepted\n");
+		BenchErrors++;
+	}
+}
+
+/* Time per exponentiation in us, the ModExp result is not checked */
+static double BenchTime(BenchModExp Func, const u32 *A, int ADigits,
+	const u32 *E, u32 *N, int NDigits, int Iterations)
+{
+	u32 C[BENCH_MAX_DIGITS];
+	double Start;
+	int i;
+
+	Start = BenchNow();
+	for (i = 0; i < Iterations; i++) {
+		if (Func == NULL) {
+			mpModExp(C, A, E, N, NDigits);
+		} else {
+			(void)Func(C, A, ADigits, E, N, NDigits, NULL, NULL);
+		}
+	}
+
+	return (BenchNow() - Start) * 1e6 / Iterations;
+}
+
+/* Prints a time in us and its speedup over Ref, or - if not measured */
+static void BenchPrint(double Time, double Ref)
+{
+	if (Time <= 0) {
+		printf(" %10s %8s", "-", "-");
+	} else if (Ref <= 0) {
+		printf(" %10.1f %8s", Time, "-");
+	} else {
+		printf(" %10.1f %7.1fx", Time, Ref / Time);
+	}
+}
+
+/*
+ * Times one key size. XHdcp22Cmn_MontExpConstTime is timed for private
+ * exponents only, it always processes all bits of the exponent.
+ */
+static void BenchRun(const char *Name, int NDigits, int Private,
+	int Iterations)
+{
+	u32 A[BENCH_MAX_DIGITS];
+	u32 E[BENCH_MAX_DIGITS];
+	u32 N[BENCH_MAX_DIGITS];
+	double Ref = 0;
+	double Mont;
+	double ConstTime = 0;
+
+	BenchModulus(N, NDigits);
+	BenchRandom(A, NDigits);
+	mpModulo(A, A, NDigits, N, NDigits);
+	mpSetZero(E, NDigits);
+	if (Private) {
+		BenchRandom(E, NDigits);
+	} else {
+		E[0] = 65537;
+	}
+
+	if (NDigits <= BENCH_MODEXP_MAX_DIGITS) {
+		Ref = BenchTime(NULL, A, NDigits, E, N, NDigits, Iterations);
+	}
+	Mont = BenchTime(XHdcp22Cmn_MontExp, A, NDigits, E, N, NDigits,
+		Iterations);
+	if (Private) {
+		ConstTime = BenchTime(XHdcp22Cmn_MontExpConstTime, A, NDigits,
+			E, N, NDigits, Iterations);
+	}
+
+	if (Ref <= 0) {
+		printf("%-22s %10s", Name, "-");
+	} else {
+		printf("%-22s %10.1f", Name, Ref);
+	}
+	BenchPrint(Mont, Ref);
+	BenchPrint(ConstTime, Ref);
+	printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+	int Scale = 1;
+
+	if (argc > 1) {
+		Scale = atoi(argv[1]);
+		if (Scale <= 0) {
+			fprintf(stderr, "usage: %s [scale]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	BenchCheckAll();
+	if (BenchErrors != 0) {
+		printf("montexp: %d checks failed\n", BenchErrors);
+		return 1;
+	}
+	printf("montexp: all checks passed\n\n");
+
+	printf("%-22s %10s %10s %8s %10s %8s\n", "us per exponentiation",
+		"mpModExp", "MontExp", "speedup", "ConstTime", "speedup");
+	BenchRun("TX 1024 bit e=65537", 32, 0, 2000 * Scale);
+	BenchRun("TX 2048 bit e=65537", 64, 0, 500 * Scale);
+	BenchRun("TX 3072 bit e=65537", 96, 0, 200 * Scale);
+	BenchRun("RX 512 bit CRT half", 16, 1, 200 * Scale);
+	BenchRun("1024 bit private", 32, 1, 20 * Scale);
+
+	return 0;
+}
@@ -0,0 +1,311 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file arm_neon.h
+*
+* Portable C model of the ARMv8 NEON and cryptographic extension intrinsics
+* used by aes.c and sha2.c. It lets the ARMv8 CE backends of hdcp22_common be
+* built and checked on a host which is not aarch64. The instructions follow
+* the pseudocode of the Arm Architecture Reference Manual for A-profile:
+* AESE, AESD, AESMC, AESIMC, SHA256H, SHA256H2, SHA256SU0 and SHA256SU1.
+*
+* Vector lane i is the i-th element in memory order, as on a little endian
+* aarch64 target.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  mb   10/16/26 First Release
+*</pre>
+*
+*****************************************************************************/
+#ifndef ARM_NEON_H
+#define ARM_NEON_H
+
+#include <stdint.h>
+#include <string.h>
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	uint8_t Lane[16];
+} uint8x16_t;
+
+typedef struct {
+	uint32_t Lane[4];
+} uint32x4_t;
+
+/************************** Function Definitions *****************************/
+
+static inline uint8x16_t vld1q_u8(const uint8_t *Ptr)
+{
+	uint8x16_t V;
+
+	memcpy(V.Lane, Ptr, sizeof(V.Lane));
+	return V;
+}
+
+static inline void vst1q_u8(uint8_t *Ptr, uint8x16_t V)
+{
+	memcpy(Ptr, V.Lane, sizeof(V.Lane));
+}
+
+static inline uint32x4_t vld1q_u32(const uint32_t *Ptr)
+{
+	uint32x4_t V;
+
+	memcpy(V.Lane, Ptr, sizeof(V.Lane));
+	return V;
+}
+
+static inline void vst1q_u32(uint32_t *Ptr, uint32x4_t V)
+{
+	memcpy(Ptr, V.Lane, sizeof(V.Lane));
+}
+
+/* The models assume a little endian host, as the aarch64 targets are */
+static inline uint8x16_t vreinterpretq_u8_u32(uint32x4_t V)
+{
+	uint8x16_t R;
+
+	memcpy(R.Lane, V.Lane, sizeof(R.Lane));
+	return R;
+}
+
+static inline uint32x4_t vreinterpretq_u32_u8(uint8x16_t V)
+{
+	uint32x4_t R;
+
+	memcpy(R.Lane, V.Lane, sizeof(R.Lane));
+	return R;
+}
+
+static inline uint8x16_t vrev32q_u8(uint8x16_t V)
+{
+	uint8x16_t R;
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		R.Lane[i] = V.Lane[(i & ~3) + (3 - (i & 3))];
+	}
+	return R;
+}
+
+static inline uint8x16_t veorq_u8(uint8x16_t A, uint8x16_t B)
+{
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		A.Lane[i] ^= B.Lane[i];
+	}
+	return A;
+}
+
+static inline uint32x4_t vaddq_u32(uint32x4_t A, uint32x4_t B)
+{
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		A.Lane[i] += B.Lane[i];
+	}
+	return A;
+}
+
+/* AES ----------------------------------------------------------------------*/
+
+static inline uint8_t NeonEmuGfMul(uint8_t A, uint8_t B)
+{
+	uint8_t P = 0;
+
+	while (B != 0) {
+		if (B & 1) {
+			P ^= A;
+		}
+		A = (uint8_t)((A << 1) ^ ((A & 0x80) ? 0x1B : 0x00));
+		B >>= 1;
+	}
+	return P;
+}
+
+static inline uint8_t NeonEmuSbox(uint8_t X, int Inverse)
+{
+	uint8_t Inv;
+	uint8_t S;
+	int i;
+
+	if (Inverse) {
+		/* Inverse affine transform, then the field inverse */
+		S = (uint8_t)(((X << 1) | (X >> 7)) ^ ((X << 3) | (X >> 5)) ^
+			((X << 6) | (X >> 2)) ^ 0x05);
+		X = S;
+	}
+
+	/* Field inverse X^254, 0 maps to 0 */
+	Inv = X;
+	for (i = 0; i < 6; i++) {
+		Inv = NeonEmuGfMul(NeonEmuGfMul(Inv, Inv), X);
+	}
+	Inv = NeonEmuGfMul(Inv, Inv);
+	if (Inverse) {
+		return Inv;
+	}
+
+	return (uint8_t)(Inv ^ ((Inv << 1) | (Inv >> 7)) ^
+		((Inv << 2) | (Inv >> 6)) ^ ((Inv << 3) | (Inv >> 5)) ^
+		((Inv << 4) | (Inv >> 4)) ^ 0x63);
+}
+
+/* Byte r + 4c of the vector is row r, column c of the AES state */
+static inline uint8x16_t vaeseq_u8(uint8x16_t Data, uint8x16_t Key)
+{
+	uint8x16_t R;
+	int Row, Col;
+
+	Data = veorq_u8(Data, Key);
+	for (Row = 0; Row < 4; Row++) {
+		for (Col = 0; Col < 4; Col++) {
+			R.Lane[Row + (4 * Col)] = NeonEmuSbox(
+				Data.Lane[Row + (4 * ((Col + Row) & 3))], 0);
+		}
+	}
+	return R;
+}
+
+static inline uint8x16_t vaesdq_u8(uint8x16_t Data, uint8x16_t Key)
+{
+	uint8x16_t R;
+	int Row, Col;
+
+	Data = veorq_u8(Data, Key);
+	for (Row = 0; Row < 4; Row++) {
+		for (Col = 0; Col < 4; Col++) {
+			R.Lane[Row + (4 * Col)] = NeonEmuSbox(
+				Data.Lane[Row + (4 * ((Col - Row) & 3))], 1);
+		}
+	}
+	return R;
+}
+
+static inline uint8x16_t NeonEmuMixColumns(uint8x16_t Data,
+	const uint8_t Coef[4])
+{
+	uint8x16_t R;
+	int Row, Col, k;
+
+	for (Col = 0; Col < 4; Col++) {
+		for (Row = 0; Row < 4; Row++) {
+			R.Lane[Row + (4 * Col)] = 0;
+			for (k = 0; k < 4; k++) {
+				R.Lane[Row + (4 * Col)] ^= NeonEmuGfMul(
+					Coef[(k - Row) & 3],
+					Data.Lane[k + (4 * Col)]);
+			}
+		}
+	}
+	return R;
+}
+
+static inline uint8x16_t vaesmcq_u8(uint8x16_t Data)
+{
+	static const uint8_t Coef[4] = { 2, 3, 1, 1 };
+
+	return NeonEmuMixColumns(Data, Coef);
+}
+
+static inline uint8x16_t vaesimcq_u8(uint8x16_t Data)
+{
+	static const uint8_t Coef[4] = { 14, 11, 13, 9 };
+
+	return NeonEmuMixColumns(Data, Coef);
+}
+
+/* SHA256 -------------------------------------------------------------------*/
+
+#define NEON_EMU_ROR(X, N)	(((X) >> (N)) | ((X) << (32 - (N))))
+
+/* SHA256hash() of the pseudocode, returns X for SHA256H, Y for SHA256H2 */
+static inline uint32x4_t NeonEmuSha256Hash(uint32x4_t X, uint32x4_t Y,
+	uint32x4_t W, int Part1)
+{
+	uint32_t Chs, Maj, T;
+	int e;
+
+	for (e = 0; e < 4; e++) {
+		Chs = (Y.Lane[0] & Y.Lane[1]) ^ (~Y.Lane[0] & Y.Lane[2]);
+		Maj = (X.Lane[0] & X.Lane[1]) ^ (X.Lane[0] & X.Lane[2]) ^
+			(X.Lane[1] & X.Lane[2]);
+		T = Y.Lane[3] + (NEON_EMU_ROR(Y.Lane[0], 6) ^
+			NEON_EMU_ROR(Y.Lane[0], 11) ^ NEON_EMU_ROR(Y.Lane[0], 25)) +
+			Chs + W.Lane[e];
+		X.Lane[3] = T + X.Lane[3];
+		Y.Lane[3] = T + (NEON_EMU_ROR(X.Lane[0], 2) ^
+			NEON_EMU_ROR(X.Lane[0], 13) ^ NEON_EMU_ROR(X.Lane[0], 22)) +
+			Maj;
+
+		/* (Y:X) = ROL(Y:X, 32) */
+		T = Y.Lane[3];
+		Y.Lane[3] = Y.Lane[2];
+		Y.Lane[2] = Y.Lane[1];
+		Y.Lane[1] = Y.Lane[0];
+		Y.Lane[0] = X.Lane[3];
+		X.Lane[3] = X.Lane[2];
+		X.Lane[2] = X.Lane[1];
+		X.Lane[1] = X.Lane[0];
+		X.Lane[0] = T;
+	}
+	return Part1 ? X : Y;
+}
+
+static inline uint32x4_t vsha256hq_u32(uint32x4_t HashAbcd,
+	uint32x4_t HashEfgh, uint32x4_t Wk)
+{
+	return NeonEmuSha256Hash(HashAbcd, HashEfgh, Wk, 1);
+}
+
+static inline uint32x4_t vsha256h2q_u32(uint32x4_t HashEfgh,
+	uint32x4_t HashAbcd, uint32x4_t Wk)
+{
+	return NeonEmuSha256Hash(HashAbcd, HashEfgh, Wk, 0);
+}
+
+static inline uint32x4_t vsha256su0q_u32(uint32x4_t W0_3, uint32x4_t W4_7)
+{
+	uint32x4_t R;
+	uint32_t Elt;
+	int e;
+
+	for (e = 0; e < 4; e++) {
+		Elt = (e < 3) ? W0_3.Lane[e + 1] : W4_7.Lane[0];
+		Elt = NEON_EMU_ROR(Elt, 7) ^ NEON_EMU_ROR(Elt, 18) ^ (Elt >> 3);
+		R.Lane[e] = Elt + W0_3.Lane[e];
+	}
+	return R;
+}
+
+static inline uint32x4_t vsha256su1q_u32(uint32x4_t Tw0_3, uint32x4_t W8_11,
+	uint32x4_t W12_15)
+{
+	uint32x4_t R;
+	uint32_t T0[4];
+	uint32_t Elt;
+	int e;
+
+	T0[0] = W8_11.Lane[1];
+	T0[1] = W8_11.Lane[2];
+	T0[2] = W8_11.Lane[3];
+	T0[3] = W12_15.Lane[0];
+
+	for (e = 0; e < 4; e++) {
+		Elt = (e < 2) ? W12_15.Lane[e + 2] : R.Lane[e - 2];
+		Elt = NEON_EMU_ROR(Elt, 17) ^ NEON_EMU_ROR(Elt, 19) ^ (Elt >> 10);
+		R.Lane[e] = Elt + Tw0_3.Lane[e] + T0[e];
+	}
+	return R;
+}
+
+#endif /* ARM_NEON_H */
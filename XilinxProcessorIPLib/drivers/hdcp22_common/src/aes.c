@@ -25,6 +25,7 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.01  MH   01/28/17 Fixed warnings and errors.
+* 1.02  mb   10/16/26 Added ARMv8 Cryptographic Extension backend.
 *</pre>
 *
 *****************************************************************************/
@@ -34,6 +35,13 @@
 #include "stdlib.h"
 #include "xil_types.h"
 
+/* Use the ARMv8 AES instructions when the compiler targets the
+   cryptographic extension (for example -march=armv8-a+crypto) */
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+#define AES_USE_ARMV8_CE
+#include <arm_neon.h>
+#endif
+
 /************************** Constant Definitions *****************************/
 /* This is the specified AES SBox. To look up a substitution value, put the first
    nibble in the first index (row) and the second nibble in the second index (column). */
@@ -56,6 +64,7 @@ static const u8 Aes_Sbox[16][16] = {
 	{0x8C,0xA1,0x89,0x0D,0xBF,0xE6,0x42,0x68,0x41,0x99,0x2D,0x0F,0xB0,0x54,0xBB,0x16}
 };
 
+#ifndef AES_USE_ARMV8_CE
 static const u8 Aes_Invsbox[16][16] = {
 	{0x52,0x09,0x6A,0xD5,0x30,0x36,0xA5,0x38,0xBF,0x40,0xA3,0x9E,0x81,0xF3,0xD7,0xFB},
 	{0x7C,0xE3,0x39,0x82,0x9B,0x2F,0xFF,0x87,0x34,0x8E,0x43,0x44,0xC4,0xDE,0xE9,0xCB},
@@ -211,6 +220,7 @@ static const u8 Aes_GfMul[256][6] = {
 	{0xe3,0x1f,0x5d,0xbe,0x80,0x9f},{0xe1,0x1c,0x54,0xb5,0x8d,0x91},
 	{0xe7,0x19,0x4f,0xa8,0x9a,0x83},{0xe5,0x1a,0x46,0xa3,0x97,0x8d}
 };
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 // The least significant byte of the word is rotated to the end.
@@ -222,6 +232,9 @@ static const u8 Aes_GfMul[256][6] = {
 /************************** Function Prototypes ******************************/
 static u32  AesSubWord(u32 Word);
 static void AesKeySetup(const u8 Key[], u32 W[], int KeySizeBits);
+#ifdef AES_USE_ARMV8_CE
+static void AesCeLoadRoundKeys(const u32 W[], uint8x16_t RoundKey[], int Nr);
+#else
 static void AesAddRoundKey(u8 State[][4], const u32 W[]);
 static void AesSubBytes(u8 State[][4]);
 static void AesInvSubBytes(u8 State[][4]);
@@ -229,6 +242,7 @@ static void AesShiftRows(u8 State[][4]);
 static void AesInvShiftRows(u8 State[][4]);
 static void AesMixColumns(u8 State[][4]);
 static void AesInvMixColumns(u8 State[][4]);
+#endif
 static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
 static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
 #ifdef AES_CIPHER_CTR_MODE
@@ -385,6 +399,7 @@ static void AesKeySetup(const u8 Key[], u32 W[], int KeySizeBits)
 	}
 }
 
+#ifndef AES_USE_ARMV8_CE
 /*****************************************************************************/
 /**
 *
@@ -792,6 +807,7 @@ static void AesInvMixColumns(u8 State[][4])
 	State[3][3] ^= Aes_GfMul[Col[2]][2];
 	State[3][3] ^= Aes_GfMul[Col[3]][5];
 }
+#endif
 
 #ifdef AES_CIPHER_CTR_MODE
 /*****************************************************************************/
@@ -821,6 +837,105 @@ static void AesIncrementIv(u8 Iv[], int CounterSize)
 }
 #endif
 
+#ifdef AES_USE_ARMV8_CE
+/*****************************************************************************/
+/**
+*
+* This function loads the round keys from the key schedule into vector
+* registers. The key schedule holds big-endian words, the AES instructions
+* take the round keys as byte strings.
+*
+* @param	W is the key schedule from the key setup
+* @param	RoundKey are the Nr + 1 round keys
+* @param	Nr is the number of rounds
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void AesCeLoadRoundKeys(const u32 W[], uint8x16_t RoundKey[], int Nr)
+{
+	int Round;
+
+	for (Round = 0; Round <= Nr; Round++) {
+		RoundKey[Round] = vrev32q_u8(vreinterpretq_u8_u32(vld1q_u32(&W[4 * Round])));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function encrypts using the ARMv8 AES instructions.
+*
+* @param	In is 16 bytes of plaintext
+* @param	Out is 16 bytes of ciphertext
+* @param	Key is from the key setup
+* @param	KeySize is the bit length of the key, 128, 192, or 256
+*
+* @return	None.
+*
+* @note		Key setup must be done before any AES en/de-cryption functions
+* 			can be used.
+*
+******************************************************************************/
+static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
+{
+	uint8x16_t RoundKey[15];
+	uint8x16_t State;
+	int Nr = (KeySize / 32) + 6;
+	int Round;
+
+	AesCeLoadRoundKeys(Key, RoundKey, Nr);
+
+	State = vld1q_u8(In);
+	for (Round = 0; Round < Nr - 1; Round++) {
+		/* AESE does AddRoundKey, SubBytes and ShiftRows */
+		State = vaesmcq_u8(vaeseq_u8(State, RoundKey[Round]));
+	}
+	/* The final round has no MixColumns */
+	State = vaeseq_u8(State, RoundKey[Nr - 1]);
+	State = veorq_u8(State, RoundKey[Nr]);
+	vst1q_u8(Out, State);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function decrypts using the ARMv8 AES instructions.
+*
+* @param	In is 16 bytes of ciphertext
+* @param	Out is 16 bytes of plaintext
+* @param	Key is from the key setup
+* @param	KeySize is the bit length of the key, 128, 192, or 256
+*
+* @return	None.
+*
+* @note		Key setup must be done before any AES en/de-cryption functions
+* 			can be used.
+*
+******************************************************************************/
+static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
+{
+	uint8x16_t RoundKey[15];
+	uint8x16_t State;
+	int Nr = (KeySize / 32) + 6;
+	int Round;
+
+	AesCeLoadRoundKeys(Key, RoundKey, Nr);
+
+	/* AESD does AddRoundKey, InvShiftRows and InvSubBytes */
+	State = vld1q_u8(In);
+	State = vaesdq_u8(State, RoundKey[Nr]);
+	for (Round = Nr - 1; Round > 0; Round--) {
+		/* InvMixColumns is linear, so it is applied to the state and
+		   the round key ahead of AddRoundKey */
+		State = vaesdq_u8(vaesimcq_u8(State), vaesimcq_u8(RoundKey[Round]));
+	}
+	State = veorq_u8(State, RoundKey[0]);
+	vst1q_u8(Out, State);
+}
+#else
 /*****************************************************************************/
 /**
 *
@@ -1024,7 +1139,7 @@ static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 	Out[14] = State[2][3];
 	Out[15] = State[3][3];
 }
-
+#endif
 
 #ifdef AES_CIPHER_CTR_MODE
 /*****************************************************************************/
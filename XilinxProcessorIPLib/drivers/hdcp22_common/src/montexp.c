@@ -0,0 +1,514 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file montexp.c
+*
+* This file contains the implementation of the Montgomery modular
+* exponentiation shared by the HDCP22 transmitter and receiver drivers.
+* XHdcp22Cmn_MontExp uses a left-to-right sliding window over the exponent
+* and is meant for public exponents. XHdcp22Cmn_MontExpConstTime uses a fixed
+* window and reads the whole table for every window, so that its sequence of
+* operations and memory accesses does not depend on a private exponent.
+* Montgomery multiplications are done in software using the Coarsely
+* Integrated Operand Scanning (CIOS) method, or by a caller supplied
+* handler, for example one driving the HDCP22 MMULT core.
+*
+* Reference:
+* Analyzing and Comparing Montgomery Multiplication Algorithms
+* IEEE Micro, 16(3):26-33,June 1996
+* By: Cetin Koc, Tolga Acar, and Burton Kaliski
+*
+* Handbook of Applied Cryptography, Algorithm 14.85
+* By: Alfred Menezes, Paul van Oorschot, and Scott Vanstone
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  mb   10/16/26 First Release
+*       mb   10/16/26 Added the fixed window exponentiation for private
+*                     exponents and moved the work buffers off the stack.
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xstatus.h"
+#include "string.h"
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions *****************************/
+/** Maximum sliding window size in bits */
+#define XHDCP22_CMN_MONT_MAX_WINDOW		5
+/** Fixed window size in bits of the private exponent exponentiation */
+#define XHDCP22_CMN_MONT_FIXED_WINDOW	4
+/** Size in words of the table of precomputed powers */
+#define XHDCP22_CMN_MONT_TABLE_WORDS	256
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/** Get bit Index of the multiple precision integer X */
+#define XHdcp22Cmn_MontGetBit(X, Index) \
+	(((X)[(Index) / 32] >> ((Index) % 32)) & 0x1)
+
+/**************************** Type Definitions *******************************/
+/**
+* This typedef contains the software Montgomery multiplication parameters.
+*/
+typedef struct {
+	const u32 *N;	/**< Modulus */
+	u32 NPrime0;	/**< Single word constant -N^(-1) mod 2^32 */
+} XHdcp22Cmn_MontCios;
+
+/**
+* This typedef contains the work buffers of the exponentiation. They are
+* kept off the stack, which is small on the HDCP processors.
+*/
+typedef struct {
+	u32 Table[XHDCP22_CMN_MONT_TABLE_WORDS];	/**< Precomputed powers */
+	u32 Tmp[2 * XHDCP22_CMN_MONT_MAX_DIGITS];	/**< Reduction input */
+	u32 Rem[2 * XHDCP22_CMN_MONT_MAX_DIGITS];	/**< Reduction remainder */
+	u32 Xbar[XHDCP22_CMN_MONT_MAX_DIGITS];		/**< Accumulator */
+	u32 A2bar[XHDCP22_CMN_MONT_MAX_DIGITS];		/**< Multiplier */
+	u32 T[XHDCP22_CMN_MONT_MAX_DIGITS + 2];		/**< CIOS product */
+	u32 Sub[XHDCP22_CMN_MONT_MAX_DIGITS];		/**< CIOS T-N */
+} XHdcp22Cmn_MontWork;
+
+/************************** Function Prototypes ******************************/
+static u32  XHdcp22Cmn_MontNPrime0(u32 N0);
+static void XHdcp22Cmn_MontMultCios(void *CallbackRef, u32 *U, const u32 *A,
+	            const u32 *B, int NDigits);
+static int  XHdcp22Cmn_MontWindowSize(int NBits, int NDigits);
+static int  XHdcp22Cmn_MontExpSetup(XHdcp22Cmn_MontCios *Cios, const u32 *A,
+	            int ADigits, u32 *N, int NDigits,
+	            XHdcp22Cmn_MontMultHandler *MontMult, void **CallbackRef);
+
+/************************** Variable Definitions *****************************/
+/** Work buffers, XHdcp22Cmn_MontExp and XHdcp22Cmn_MontExpConstTime are not
+ *  reentrant */
+static XHdcp22Cmn_MontWork XHdcp22Cmn_MontWorkBuf;
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function calculates the single word Montgomery constant
+* NPrime0 = -N0^(-1) mod 2^32 using Newton iteration. Each iteration
+* doubles the number of correct low order bits, starting from the
+* three bits given by N0 itself.
+*
+* @param	N0 is the least significant word of the modulus, must be odd.
+*
+* @return	NPrime0.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XHdcp22Cmn_MontNPrime0(u32 N0)
+{
+	u32 X = N0;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		X *= 2 - (N0 * X);
+	}
+
+	return (u32)0 - X;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function implements the Montgomery Modular Multiplication using
+* the Coarsely Integrated Operand Scanning (CIOS) method.
+*
+* U = MontMult(A,B,N) = A*B*R^(-1) mod N
+*
+* @param	CallbackRef is a pointer to the XHdcp22Cmn_MontCios parameters.
+* @param	U is the MMM result. U may be the same as A or B.
+* @param	A is the n-residue input, A' = A*R mod N
+* @param	B is the n-residue input, B' = B*R mod N
+* @param	NDigits is the integer precision of the arguments (U,A,B,N)
+*
+* @return	None.
+*
+* @note		The final subtraction is done with a mask so that the execution
+*		time does not depend on the operands.
+*
+******************************************************************************/
+static void XHdcp22Cmn_MontMultCios(void *CallbackRef, u32 *U, const u32 *A,
+	const u32 *B, int NDigits)
+{
+	const XHdcp22Cmn_MontCios *Cios = (const XHdcp22Cmn_MontCios *)CallbackRef;
+	const u32 *N = Cios->N;
+	u32 *T = XHdcp22Cmn_MontWorkBuf.T;
+	u32 *Sub = XHdcp22Cmn_MontWorkBuf.Sub;
+	u64 Sum;
+	u32 Carry;
+	u32 Mask;
+	u32 M;
+	int i, j;
+
+	memset(T, 0, sizeof(u32) * (NDigits + 2));
+
+	for (i = 0; i < NDigits; i++) {
+		/* T = T + A*B[i] */
+		Carry = 0;
+		for (j = 0; j < NDigits; j++) {
+			Sum = (u64)T[j] + ((u64)A[j] * B[i]) + Carry;
+			T[j] = (u32)Sum;
+			Carry = (u32)(Sum >> 32);
+		}
+		Sum = (u64)T[NDigits] + Carry;
+		T[NDigits] = (u32)Sum;
+		T[NDigits + 1] = (u32)(Sum >> 32);
+
+		/* T = (T + M*N) / 2^32 */
+		M = T[0] * Cios->NPrime0;
+		Sum = (u64)T[0] + ((u64)M * N[0]);
+		Carry = (u32)(Sum >> 32);
+		for (j = 1; j < NDigits; j++) {
+			Sum = (u64)T[j] + ((u64)M * N[j]) + Carry;
+			T[j - 1] = (u32)Sum;
+			Carry = (u32)(Sum >> 32);
+		}
+		Sum = (u64)T[NDigits] + Carry;
+		T[NDigits - 1] = (u32)Sum;
+		T[NDigits] = T[NDigits + 1] + (u32)(Sum >> 32);
+	}
+
+	/* if(T>=N) return T-N else return T, T is less than 2N */
+	Carry = 0;
+	for (j = 0; j < NDigits; j++) {
+		Sum = (u64)T[j] - N[j] - Carry;
+		Sub[j] = (u32)Sum;
+		Carry = (u32)(Sum >> 32) & 0x1;
+	}
+	Mask = (u32)0 - (T[NDigits] | (Carry ^ 0x1));
+	for (j = 0; j < NDigits; j++) {
+		U[j] = (Sub[j] & Mask) | (T[j] & ~Mask);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function selects the sliding window size for the exponent length.
+* The window is limited so that the table of odd powers fits in
+* XHDCP22_CMN_MONT_TABLE_WORDS words.
+*
+* @param	NBits is the number of significant bits in the exponent.
+* @param	NDigits is the integer precision of the modulus.
+*
+* @return	Window size in bits.
+*
+* @note		None.
+*
+******************************************************************************/
+static int XHdcp22Cmn_MontWindowSize(int NBits, int NDigits)
+{
+	int Window;
+
+	if (NBits <= 24) {
+		Window = 1;
+	} else if (NBits <= 80) {
+		Window = 3;
+	} else if (NBits <= 240) {
+		Window = 4;
+	} else {
+		Window = XHDCP22_CMN_MONT_MAX_WINDOW;
+	}
+
+	while ((Window > 1) &&
+	       (((1 << (Window - 1)) * NDigits) > XHDCP22_CMN_MONT_TABLE_WORDS)) {
+		Window--;
+	}
+
+	return Window;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the arguments of the exponentiation, selects the
+* Montgomery multiplication and calculates Abar = A*R mod(N) into the
+* first NDigits words of the Rem work buffer.
+*
+* @param	Cios is the software Montgomery multiplication parameters.
+* @param	A is the base, ADigits in size.
+* @param	ADigits is the integer precision of A.
+* @param	N is the modulus, must be odd.
+* @param	NDigits is the integer precision of N.
+* @param	MontMult is a pointer to the Montgomery multiplication handler.
+*			A NULL handler is replaced by the software multiplication.
+* @param	CallbackRef is a pointer to the reference passed to MontMult.
+*
+* @return	- XST_SUCCESS if the arguments are supported.
+*			- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int XHdcp22Cmn_MontExpSetup(XHdcp22Cmn_MontCios *Cios, const u32 *A,
+	int ADigits, u32 *N, int NDigits, XHdcp22Cmn_MontMultHandler *MontMult,
+	void **CallbackRef)
+{
+	XHdcp22Cmn_MontWork *Work = &XHdcp22Cmn_MontWorkBuf;
+
+	if ((NDigits <= 0) || (NDigits > XHDCP22_CMN_MONT_MAX_DIGITS) ||
+	    (ADigits <= 0) || (ADigits > XHDCP22_CMN_MONT_MAX_DIGITS) ||
+	    ((N[0] & 0x1) == 0)) {
+		return XST_FAILURE;
+	}
+
+	if (*MontMult == NULL) {
+		Cios->N = N;
+		Cios->NPrime0 = XHdcp22Cmn_MontNPrime0(N[0]);
+		*MontMult = XHdcp22Cmn_MontMultCios;
+		*CallbackRef = Cios;
+	}
+
+	/* Abar = A*R mod(N), Table is the quotient scratch */
+	memset(Work->Tmp, 0, sizeof(Work->Tmp));
+	memcpy(Work->Tmp + NDigits, A, sizeof(u32) * ADigits);
+	mpDivide(Work->Table, Work->Rem, Work->Tmp, NDigits + ADigits, N,
+		NDigits);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function performs the modular exponentiation C = A^E mod N using
+* Montgomery multiplication and left-to-right sliding window
+* exponentiation.
+*
+* When MontMult is NULL the Montgomery multiplications are done in
+* software. Otherwise every Montgomery multiplication is passed to
+* MontMult, which must compute U = A*B*R^(-1) mod N with R = 2^(32*NDigits),
+* for example using the HDCP22 MMULT core. The caller is responsible for
+* loading N and NPrime into the MMULT core before calling this function.
+*
+* @param	C is the result of the modular exponentiation, NDigits in size.
+* @param	A is the base, ADigits in size.
+* @param	ADigits is the integer precision of A.
+* @param	E is the exponent, NDigits in size.
+* @param	N is the modulus, must be odd. N is changed in-situ during the
+*			initial reduction and then restored.
+* @param	NDigits is the integer precision of the arguments (C,E,N).
+* 			Maximum integer precision is XHDCP22_CMN_MONT_MAX_DIGITS.
+* @param	MontMult is the Montgomery multiplication handler or NULL.
+* @param	CallbackRef is the reference passed to MontMult.
+*
+* @return	- XST_SUCCESS if the exponentiation is done.
+*			- XST_FAILURE if the arguments are not supported.
+*
+* @note		The execution time and the table accesses depend on the
+*		exponent. Use this function for public exponents only and
+*		XHdcp22Cmn_MontExpConstTime for private exponents.
+*
+******************************************************************************/
+int XHdcp22Cmn_MontExp(u32 *C, const u32 *A, int ADigits, const u32 *E,
+	u32 *N, int NDigits, XHdcp22Cmn_MontMultHandler MontMult,
+	void *CallbackRef)
+{
+	XHdcp22Cmn_MontWork *Work = &XHdcp22Cmn_MontWorkBuf;
+	u32 *Table = Work->Table;
+	u32 *Xbar = Work->Xbar;
+	u32 *A2bar = Work->A2bar;
+	XHdcp22Cmn_MontCios Cios;
+	u32 *Mult;
+	u32 Value;
+	int NBits;
+	int Window;
+	int IsOne;
+	int Index;
+	int Low;
+	int i;
+
+	/* Step 1: Abar = A*R mod(N) */
+	if (XHdcp22Cmn_MontExpSetup(&Cios, A, ADigits, N, NDigits, &MontMult,
+	    &CallbackRef) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	NBits = (int)mpBitLength(E, NDigits);
+	Window = XHdcp22Cmn_MontWindowSize(NBits, NDigits);
+
+	/* Step 2: Table[i] = Abar^(2i+1) */
+	memcpy(Table, Work->Rem, sizeof(u32) * NDigits);
+	if (Window > 1) {
+		MontMult(CallbackRef, A2bar, Table, Table, NDigits);
+		for (i = 1; i < (1 << (Window - 1)); i++) {
+			MontMult(CallbackRef, Table + (i * NDigits),
+				Table + ((i - 1) * NDigits), A2bar, NDigits);
+		}
+	}
+
+	/* Step 3: Sliding window square and multiply */
+	IsOne = TRUE;
+	Index = NBits - 1;
+	while (Index >= 0) {
+		if (XHdcp22Cmn_MontGetBit(E, Index) == 0) {
+			if (IsOne == FALSE) {
+				MontMult(CallbackRef, Xbar, Xbar, Xbar, NDigits);
+			}
+			Index--;
+			continue;
+		}
+
+		/* Find the longest window of at most Window bits ending in a 1 */
+		Low = Index - Window + 1;
+		if (Low < 0) {
+			Low = 0;
+		}
+		while (XHdcp22Cmn_MontGetBit(E, Low) == 0) {
+			Low++;
+		}
+		Value = 0;
+		for (i = Index; i >= Low; i--) {
+			Value = (Value << 1) | XHdcp22Cmn_MontGetBit(E, i);
+		}
+		Mult = Table + ((Value >> 1) * NDigits);
+
+		if (IsOne == TRUE) {
+			memcpy(Xbar, Mult, sizeof(u32) * NDigits);
+			IsOne = FALSE;
+		} else {
+			for (i = Index; i >= Low; i--) {
+				MontMult(CallbackRef, Xbar, Xbar, Xbar, NDigits);
+			}
+			MontMult(CallbackRef, Xbar, Xbar, Mult, NDigits);
+		}
+		Index = Low - 1;
+	}
+
+	/* Catch E==0 => A^0=1 */
+	if (IsOne == TRUE) {
+		memset(C, 0, sizeof(u32) * NDigits);
+		C[0] = (mpShortCmp(N, 1, NDigits) == 0) ? 0 : 1;
+		return XST_SUCCESS;
+	}
+
+	/* Step 4: C = MontMult(Xbar,1) */
+	memset(A2bar, 0, sizeof(u32) * NDigits);
+	A2bar[0] = 1;
+	MontMult(CallbackRef, C, Xbar, A2bar, NDigits);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function performs the modular exponentiation C = A^E mod N for a
+* private exponent E using Montgomery multiplication and left-to-right fixed
+* window exponentiation.
+*
+* All 32*NDigits bits of E are processed in windows of
+* XHDCP22_CMN_MONT_FIXED_WINDOW bits, smaller for large moduli. Every window
+* takes the same number of squarings and one multiplication, and the
+* multiplier is selected by reading every table entry with a mask. The
+* sequence of operations and memory accesses thus does not depend on E.
+*
+* @param	C is the result of the modular exponentiation, NDigits in size.
+* @param	A is the base, ADigits in size.
+* @param	ADigits is the integer precision of A.
+* @param	E is the exponent, NDigits in size.
+* @param	N is the modulus, must be odd. N is changed in-situ during the
+*			initial reduction and then restored.
+* @param	NDigits is the integer precision of the arguments (C,E,N).
+* 			Maximum integer precision is XHDCP22_CMN_MONT_MAX_DIGITS.
+* @param	MontMult is the Montgomery multiplication handler or NULL,
+*			see XHdcp22Cmn_MontExp.
+* @param	CallbackRef is the reference passed to MontMult.
+*
+* @return	- XST_SUCCESS if the exponentiation is done.
+*			- XST_FAILURE if the arguments are not supported.
+*
+* @note		None.
+*
+******************************************************************************/
+int XHdcp22Cmn_MontExpConstTime(u32 *C, const u32 *A, int ADigits,
+	const u32 *E, u32 *N, int NDigits, XHdcp22Cmn_MontMultHandler MontMult,
+	void *CallbackRef)
+{
+	XHdcp22Cmn_MontWork *Work = &XHdcp22Cmn_MontWorkBuf;
+	u32 *Table = Work->Table;
+	u32 *Xbar = Work->Xbar;
+	u32 *A2bar = Work->A2bar;
+	XHdcp22Cmn_MontCios Cios;
+	u32 Value;
+	u32 Diff;
+	u32 Mask;
+	int NBits;
+	int Window;
+	int Entries;
+	int Index;
+	int i, j;
+
+	/* Step 1: Table[1] = Abar = A*R mod(N), Table[0] = R mod(N) */
+	if (XHdcp22Cmn_MontExpSetup(&Cios, A, ADigits, N, NDigits, &MontMult,
+	    &CallbackRef) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Window = XHDCP22_CMN_MONT_FIXED_WINDOW;
+	while ((Window > 1) &&
+	       (((1 << Window) * NDigits) > XHDCP22_CMN_MONT_TABLE_WORDS)) {
+		Window--;
+	}
+	Entries = 1 << Window;
+
+	memcpy(Table + NDigits, Work->Rem, sizeof(u32) * NDigits);
+	memset(Work->Tmp, 0, sizeof(u32) * (NDigits + 1));
+	Work->Tmp[NDigits] = 1;
+	mpDivide(Work->T, Work->Rem, Work->Tmp, NDigits + 1, N, NDigits);
+	memcpy(Table, Work->Rem, sizeof(u32) * NDigits);
+
+	/* Step 2: Table[i] = Abar^i */
+	for (i = 2; i < Entries; i++) {
+		MontMult(CallbackRef, Table + (i * NDigits),
+			Table + ((i - 1) * NDigits), Table + NDigits, NDigits);
+	}
+
+	/* Step 3: Fixed window square and multiply, starting from Xbar = 1 */
+	memcpy(Xbar, Table, sizeof(u32) * NDigits);
+	NBits = 32 * NDigits;
+	for (Index = (((NBits + Window - 1) / Window) * Window) - 1;
+	     Index >= 0; Index -= Window) {
+		Value = 0;
+		for (i = Index; i > (Index - Window); i--) {
+			MontMult(CallbackRef, Xbar, Xbar, Xbar, NDigits);
+			Value <<= 1;
+			if (i < NBits) {
+				Value |= XHdcp22Cmn_MontGetBit(E, i);
+			}
+		}
+
+		/* A2bar = Table[Value], reading every entry */
+		memset(A2bar, 0, sizeof(u32) * NDigits);
+		for (i = 0; i < Entries; i++) {
+			Diff = (u32)i ^ Value;
+			Mask = ((Diff | ((u32)0 - Diff)) >> 31) - 1;
+			for (j = 0; j < NDigits; j++) {
+				A2bar[j] |= Table[(i * NDigits) + j] & Mask;
+			}
+		}
+		MontMult(CallbackRef, Xbar, Xbar, A2bar, NDigits);
+	}
+
+	/* Step 4: C = MontMult(Xbar,1) */
+	memset(A2bar, 0, sizeof(u32) * NDigits);
+	A2bar[0] = 1;
+	MontMult(CallbackRef, C, Xbar, A2bar, NDigits);
+
+	return XST_SUCCESS;
+}
@@ -16,6 +16,8 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.10  GM   10/14/19 Added "volatile" attribute to all "i" variables
+* 1.20  mb   10/16/26 Added ARMv8 Cryptographic Extension backend and
+*                     hash whole blocks directly from the input data.
 *</pre>
 *
 *****************************************************************************/
@@ -24,6 +26,13 @@
 #include "string.h"
 #include "xil_types.h"
 
+/* Use the ARMv8 SHA256 instructions when the compiler targets the
+   cryptographic extension (for example -march=armv8-a+crypto) */
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO)
+#define SHA256_USE_ARMV8_CE
+#include <arm_neon.h>
+#endif
+
 /**************************** Type Definitions ******************************/
 typedef struct {
    u8 data[64];
@@ -60,7 +69,7 @@ static const u32 k[64] = {
 /************************** Function Prototypes *****************************/
 
 /* SHA-256 Hashing */
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data);
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data);
 static void Sha256Init(Sha256Type *Ctx);
 static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len);
 static void Sha256Final(Sha256Type *Ctx, u8 *Hash);
@@ -103,7 +112,37 @@ void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData)
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
+#ifdef SHA256_USE_ARMV8_CE
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data)
+{
+   volatile u32 i;
+   uint32x4_t abcd, efgh, abcd_save, efgh_save, tmp, wk, m[4];
+
+   // Load the message block as big endian words.
+   for (i = 0; i < 4; ++i)
+      m[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&Data[i * 16])));
+
+   abcd = vld1q_u32(&Ctx->state[0]);
+   efgh = vld1q_u32(&Ctx->state[4]);
+   abcd_save = abcd;
+   efgh_save = efgh;
+
+   // Four rounds per iteration, extending the message schedule in place.
+   for (i = 0; i < 16; ++i) {
+      wk = vaddq_u32(m[i & 3], vld1q_u32(&k[i * 4]));
+      if (i < 12)
+         m[i & 3] = vsha256su1q_u32(vsha256su0q_u32(m[i & 3], m[(i + 1) & 3]),
+                                    m[(i + 2) & 3], m[(i + 3) & 3]);
+      tmp = abcd;
+      abcd = vsha256hq_u32(abcd, efgh, wk);
+      efgh = vsha256h2q_u32(efgh, tmp, wk);
+   }
+
+   vst1q_u32(&Ctx->state[0], vaddq_u32(abcd, abcd_save));
+   vst1q_u32(&Ctx->state[4], vaddq_u32(efgh, efgh_save));
+}
+#else
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data)
 {
   volatile u32 i;
   u32 a,b,c,d,e,f,g,h,j,t1,t2,m[64];
@@ -144,6 +183,7 @@ static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
    Ctx->state[6] += g;
    Ctx->state[7] += h;
 }
+#endif
 
 /*****************************************************************************/
 /**
@@ -190,6 +230,14 @@ static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len)
    volatile u32 i;
 
    for (i=0; i < Len; ++i) {
+      // Transform whole blocks straight from the input data.
+      while ((Ctx->datalen == 0) && ((Len - i) >= 64)) {
+         Sha256Transform(Ctx,&Data[i]);
+         DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
+         i += 64;
+      }
+      if (i == Len)
+         break;
       Ctx->data[Ctx->datalen] = Data[i];
       Ctx->datalen++;
       if (Ctx->datalen == 64) {
@@ -17,6 +17,8 @@
 * 1.00  MH   10/30/15 First Release.
 * 1.01  MH   01/15/16 Added prefix to function names.
 * 2.00  MH   06/21/17 Changed DIGIT_T type to u32 for ARM support.
+* 2.01  mb   10/16/26 Added Montgomery modular exponentiation.
+*       mb   10/16/26 Added constant time Montgomery modular exponentiation.
 *</pre>
 *
 *****************************************************************************/
@@ -32,8 +34,16 @@ extern "C" {
 #include "bigdigits.h"
 
 /************************** Constant Definitions ****************************/
+/** Maximum integer precision in 32-bit digits of XHdcp22Cmn_MontExp */
+#define XHDCP22_CMN_MONT_MAX_DIGITS	(3072/32)
 
 /**************************** Type Definitions ******************************/
+/**
+* Callback type for a Montgomery multiplication U = A*B*R^(-1) mod N, where
+* R = 2^(32*NDigits). U may be the same as A or B.
+*/
+typedef void (*XHdcp22Cmn_MontMultHandler)(void *CallbackRef, u32 *U,
+	const u32 *A, const u32 *B, int NDigits);
 
 /***************** Macros (Inline Functions) Definitions ********************/
 
@@ -44,6 +54,12 @@ void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData);
 int  XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int KeySize, u8  *HashedData);
 void XHdcp22Cmn_Aes128Encrypt(const u8 *Data, const u8 *Key, u8 *Output);
 void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output);
+int  XHdcp22Cmn_MontExp(u32 *C, const u32 *A, int ADigits, const u32 *E,
+	u32 *N, int NDigits, XHdcp22Cmn_MontMultHandler MontMult,
+	void *CallbackRef);
+int  XHdcp22Cmn_MontExpConstTime(u32 *C, const u32 *A, int ADigits,
+	const u32 *E, u32 *N, int NDigits, XHdcp22Cmn_MontMultHandler MontMult,
+	void *CallbackRef);
 
 #ifdef __cplusplus
 }
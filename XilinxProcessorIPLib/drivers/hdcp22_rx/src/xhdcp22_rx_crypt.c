@@ -23,6 +23,10 @@
 * 1.00  MH   10/30/15 First Release
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.20  MH   06/21/17 Updated for 64 bit support.
+* 2.21  mb   10/16/26 Use the shared Montgomery sliding window
+*                     exponentiation for RSA decryption.
+*       mb   10/16/26 Use the constant time fixed window exponentiation
+*                     for the private key.
 *</pre>
 *
 *****************************************************************************/
@@ -58,12 +62,8 @@ static int  XHdcp22Rx_Pkcs1EmeOaepDecode(u8 *EncodedMessage, u8 *Message, int *M
 static void XHdcp22Rx_Pkcs1MontMultFiosInit(XHdcp22_Rx *InstancePtr, u32 *N,
 	            const u32 *NPrime, int NDigits);
 #ifndef _XHDCP22_RX_SW_MMULT_
-static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U, u32 *A,
-	            u32 *B, int NDigits);
-#else
-static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B, u32 *N,
-	            const u32 *NPrime, int NDigits);
-static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits);
+static void XHdcp22Rx_Pkcs1MontMultFios(void *CallbackRef, u32 *U, const u32 *A,
+	            const u32 *B, int NDigits);
 #endif
 static int  XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A, u32 *E,
 	            u32 *N, const u32 *NPrime, int NDigits);
@@ -643,153 +643,6 @@ static int XHdcp22Rx_Pkcs1EmeOaepDecode(u8 *EncodedMessage, u8 *Message, int *Me
 	return XST_SUCCESS;
 }
 
-#ifdef _XHDCP22_RX_SW_MMULT_
-/****************************************************************************/
-/**
-* This function performs a carry propagation adding C to the input
-* array A of size NDigits, given by the first argument starting from
-* the first element SDigit, and propagates it until no further carry
-* is generated.
-*
-* ADD(A[i],C)
-*
-* Reference:
-* Analyzing and Comparing Montgomery Multiplication Algorithms
-* IEEE Micro, 16(3):26-33,June 1996
-* By: Cetin Koc, Tolga Acar, and Burton Kaliski
-*
-* @param	A is an input array of size NDigits
-* @param	C is the value being added to the input A
-* @param	SDigit is the start digit
-* @param	NDigits is the integer precision of the arguments (A)
-*
-* @return	None.
-*
-* @note		None.
-*****************************************************************************/
-static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits)
-{
-	/* Verify arguments */
-	Xil_AssertVoid(A != NULL);
-	Xil_AssertVoid(SDigit <= NDigits);
-
-	int i;
-
-	for(i=SDigit; i<NDigits; i++)
-	{
-		C = mpAdd(A+i, A+i, &C, 1);
-
-		if(C == 0)
-		{
-			return;
-		}
-	}
-}
-#endif
-
-#ifdef _XHDCP22_RX_SW_MMULT_
-/****************************************************************************/
-/**
-* This function implements the Montgomery Modular Multiplication (MMM)
-* Finely Integrated Operand Scanning (FIOS) algorithm. The FIOS method
-* interleaves multiplication and reduction operations. Requires NDigits+3
-* words of temporary storage.
-*
-* U = MontMult(A,B,N)
-*
-* Reference:
-* Analyzing and Comparing Montgomery Multiplication Algorithms
-* IEEE Micro, 16(3):26-33,June 1996
-* By: Cetin Koc, Tolga Acar, and Burton Kaliski
-*
-* @param	U is the MMM result
-* @param	A is the n-residue input, A' = A*R mod N
-* @param	B is the n-residue input, B' = B*R mod N
-* @param	N is the modulus
-* @param	NPrime is a pre-computed constant, NPrime = (1-R*Rbar)/N
-* @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime)
-*
-* @return	None.
-*
-* @note		None.
-*****************************************************************************/
-static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B,
-	u32 *N, const u32 *NPrime, int NDigits)
-{
-	/* Verify arguments */
-	Xil_AssertVoid(U != NULL);
-	Xil_AssertVoid(A != NULL);
-	Xil_AssertVoid(B != NULL);
-	Xil_AssertVoid(N != NULL);
-	Xil_AssertVoid(NPrime != NULL);
-	Xil_AssertVoid(NDigits == 16);
-
-	int i, j;
-	u32 S, C, C1, C2, M[2], X[2];
-	u32 T[XHDCP22_RX_N_SIZE];
-
-	memset(T, 0, 4*(NDigits+3));
-
-	for(i=0; i<NDigits; i++)
-	{
-		// (C,S) = t[0] + a[0]*b[i], worst case 2 words
-		spMultiply(X, A[0], B[i]);	// X[Upper,Lower] = a[0]*b[i]
-		C = mpAdd(&S, T+0, X+0, 1);	// [C,S] = t[0] + X[Lower]
-		mpAdd(&C, &C, X+1, 1);		// [~,C] = C + X[Upper], No carry
-
-		// ADD(t[1],C)
-		XHdcp22Rx_Pkcs1MontMultAdd(T, C, 1, NDigits+3);
-
-		// m = S*n'[0] mod W, where W=2^32
-		// Note: X[Upper,Lower] = S*n'[0], m=X[Lower]
-		spMultiply(M, S, NPrime[0]);
-
-		// (C,S) = S + m*n[0], worst case 2 words
-		spMultiply(X, M[0], N[0]);	// X[Upper,Lower] = m*n[0]
-		C = mpAdd(&S, &S, X+0, 1);	// [C,S] = S + X[Lower]
-		mpAdd(&C, &C, X+1, 1);		// [~,C] = C + X[Upper]
-
-		for(j=1; j<NDigits; j++)
-		{
-			// (C,S) = t[j] + a[j]*b[i] + C, worst case 2 words
-			spMultiply(X, A[j], B[i]);	 	// X[Upper,Lower] = a[j]*b[i], double precision
-			C1 = mpAdd(&S, T+j, &C, 1);		// (C1,S) = t[j] + C
-			C2 = mpAdd(&S, &S, X+0, 1); 	// (C2,S) = S + X[Lower]
-			mpAdd(&C, &C1, X+1, 1);			// (~,C)  = C1 + X[Upper], doesn't produce carry
-			mpAdd(&C, &C, &C2, 1); 			// (~,C)  = C + C2, doesn't produce carry
-
-			// ADD(t[j+1],C)
-			XHdcp22Rx_Pkcs1MontMultAdd(T, C, j+1, NDigits+3);
-
-			// (C,S) = S + m*n[j]
-			spMultiply(X, M[0], N[j]);	// X[Upper,Lower] = m*n[j]
-			C = mpAdd(&S, &S, X+0, 1);	// [C,S] = S + X[Lower]
-			mpAdd(&C, &C, X+1, 1);		// [~,C] = C + X[Upper]
-
-			// t[j-1] = S
-			T[j-1] = S;
-		}
-
-		// (C,S) = t[s] + C
-		C = mpAdd(&S, T+NDigits, &C, 1);
-		// t[s-1] = S
-		T[NDigits-1] = S;
-		// t[s] = t[s+1] + C
-		mpAdd(T+NDigits, T+NDigits+1, &C, 1);
-		// t[s+1] = 0
-		T[NDigits+1] = 0;
-	}
-
-	/* Step 3: if(u>=n) return u-n else return u */
-	if(mpCompare(T, N, NDigits+3) >= 0)
-	{
-		mpSubtract(T, T, N, NDigits+3);
-	}
-
-	memcpy(U, T, 4*NDigits);
-}
-#endif
-
 /****************************************************************************/
 /**
 * This function initializes the Montgomery Multiplier (MMULT) hardware
@@ -838,7 +691,7 @@ static void XHdcp22Rx_Pkcs1MontMultFiosInit(XHdcp22_Rx *InstancePtr, u32 *N,
 *
 * U = MontMult(A,B,N)
 *
-* @param	InstancePtr is a pointer to the MMULT instance.
+* @param	CallbackRef is a pointer to the XHdcp22_Rx instance.
 * @param	U is the MMM result
 * @param	A is the n-residue input, A' = A*R mod N
 * @param	B is the n-residue input, B' = B*R mod N
@@ -846,11 +699,13 @@ static void XHdcp22Rx_Pkcs1MontMultFiosInit(XHdcp22_Rx *InstancePtr, u32 *N,
 *
 * @return	None.
 *
-* @note		None.
+* @note		This function is the XHdcp22Cmn_MontExp multiplication handler.
 *****************************************************************************/
-static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
-	u32 *A, u32 *B, int NDigits)
+static void XHdcp22Rx_Pkcs1MontMultFios(void *CallbackRef, u32 *U,
+	const u32 *A, const u32 *B, int NDigits)
 {
+	XHdcp22_Rx *InstancePtr = (XHdcp22_Rx *)CallbackRef;
+
 	/* Verify arguments */
 	Xil_AssertVoid(InstancePtr != NULL);
 	Xil_AssertVoid(U != NULL);
@@ -880,79 +735,38 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
 
 /****************************************************************************/
 /**
-* This function performs the modular exponentation operation using the
-* binary square and multiply method.
+* This function performs the modular exponentation operation using
+* Montgomery multiplication and fixed window exponentiation, whose timing
+* does not depend on the private exponent. The Montgomery multiplications
+* are done by the MMULT hardware, or in software when _XHDCP22_RX_SW_MMULT_
+* is defined.
 *
 * C = ModExp(A, E, N) = A^E*mod(N)
 *
 * @param	C is result of the modular exponentiation
-* @param	A is the base
+* @param	A is the base, 2*NDigits in size
 * @param	E is the exponent
 * @param	N is the modulus
 * @param	NPrime is a constant
-* @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime).
+* @param	NDigits is the integer precision of the arguments (C,E,N,NPrime).
 * 			Maximum integer precision is 16.
 *
-* @return	None.
+* @return	XST_SUCCESS or XST_FAILURE.
 *
 * @note		None.
 *****************************************************************************/
 static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	u32 *E, u32 *N, const u32 *NPrime, int NDigits)
 {
-	int Offset;
-	u32 R[XHDCP22_RX_N_SIZE/4];
-	u32 Abar[XHDCP22_RX_N_SIZE/4];
-	u32 Xbar[XHDCP22_RX_N_SIZE/4];
-
-	memset(R, 0, sizeof(R));
-	memset(Abar, 0, sizeof(Abar));
-	memset(Xbar, 0, sizeof(Xbar));
-
 #ifndef _XHDCP22_RX_SW_MMULT_
 	XHdcp22Rx_Pkcs1MontMultFiosInit(InstancePtr, N, NPrime, NDigits);
-#endif
-
-	/* Step 0: R = 2^(NDigits*32) */
-	R[0] = 1;
-	mpShiftLeft(R, R, NDigits*32, XHDCP22_RX_N_SIZE/4);
 
-	/* Step 1: Xbar = 1*R*mod(N) */
-	mpModulo(Xbar, R, XHDCP22_RX_N_SIZE/4, N, NDigits); // Optimization
-
-	/* Step 2: Abar = A*R*mod(N) */
-	mpModMult(Abar, A, Xbar, N, 2*NDigits);
-
-	/* Step 3: Binary square and multiply */
-	for(Offset=32*NDigits-1; Offset>=0; Offset--)
-	{
-#ifndef _XHDCP22_RX_SW_MMULT_
-		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Xbar, NDigits);
+	return XHdcp22Cmn_MontExpConstTime(C, A, 2*NDigits, E, N, NDigits,
+		XHdcp22Rx_Pkcs1MontMultFios, InstancePtr);
 #else
-		XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Xbar, N, NPrime, NDigits);
+	return XHdcp22Cmn_MontExpConstTime(C, A, 2*NDigits, E, N, NDigits,
+		NULL, NULL);
 #endif
-
-		if(mpGetBit(E, NDigits, Offset) == TRUE)
-		{
-#ifndef _XHDCP22_RX_SW_MMULT_
-			XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Abar, NDigits);
-#else
-			XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Abar, N, NPrime, NDigits);
-#endif
-		}
-	}
-
-	/* Step 4: C=MonPro(Xbar,1) */
-	memset(R, 0, sizeof(R));
-	R[0] = 1;
-
-#ifndef _XHDCP22_RX_SW_MMULT_
-	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, C, Xbar, R, NDigits);
-#else
-	XHdcp22Rx_Pkcs1MontMultFiosStub(C, Xbar, R, N, NPrime, NDigits);
-#endif
-
-	return XST_SUCCESS;
 }
 
 /****************************************************************************/
@@ -28,6 +28,8 @@
 *                       Signature verification has been updated to
 *                       check entire encoded message EM including
 *                       padding PS.
+* 2.41  mb     10/16/26 Use Montgomery exponentiation in
+*                       XHdcp22Tx_RsaEncryptMsg.
 * </pre>
 *
 ******************************************************************************/
@@ -246,7 +248,10 @@ static int XHdcp22Tx_RsaEncryptMsg(const u8 *KeyPubNPtr, int KeyPubNSize,
 	mpConvFromOctets(e, ModSize, KeyPubEPtr, KeyPubESize);
 
 	mpConvFromOctets(m, ModSize, MsgPtr, MsgSize);
-	mpModExp(s, m, e, n, ModSize);
+	if (XHdcp22Cmn_MontExp(s, m, ModSize, e, n, ModSize, NULL, NULL) !=
+	    XST_SUCCESS) {
+		return XST_FAILURE;
+	}
 	mpConvToOctets(s, ModSize, EncryptedMsgPtr, MsgSize);
 
 	return XST_SUCCESS;
@@ -63,6 +63,10 @@
 *   BDs back to the free pool:
 *      - XMcdma_BdChainFree(...)
 *
+* To share the hardware fairly between channels, transfers can instead be
+* queued per channel and submitted by the weighted round robin or deficit
+* round robin scheduler of xmcdma_sched.h.
+*
 * The driver also provides API functions to get the status of a completed
 * BD, along with get functions for other fields in the BD.
 *
@@ -124,6 +128,8 @@
 * 			 the gcc warning in mcdma integration test suite.
 * 1.7   sa      08/12/22 Updated the examples to use latest MIG cannoical define
 * 		         i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+* 1.12  mb      10/16/26 Added the software submission scheduler, see
+* 			 xmcdma_sched.h.
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
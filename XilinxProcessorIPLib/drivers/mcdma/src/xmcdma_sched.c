@@ -0,0 +1,540 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_sched.c
+* @addtogroup mcdma Overview
+* @{
+*
+* This file implements the software submission scheduler of the MCDMA driver,
+* please see xmcdma_sched.h for more details.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.12  mb      10/16/26 Initial version.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xmcdma_sched.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XMCDMA_SCHED_NO_LIMIT		0xFFFFFFFFU
+
+/************************** Function Prototypes ******************************/
+
+static u32 XMcdma_SchedCanSubmit(const XMcdma_SchedChan *SchedChan,
+				 u32 BdLimit);
+static u32 XMcdma_SchedSubmitReq(XMcdma_SchedChan *SchedChan);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Checks whether the oldest waiting request of a channel can be submitted.
+*
+* @param	SchedChan is the scheduled channel to be worked on.
+* @param	BdLimit is the number of BDs the request may use at most.
+*
+* @return	TRUE if the request fits the BD budget, the free BDs of the
+*		chain and BdLimit, FALSE otherwise.
+*
+*****************************************************************************/
+static u32 XMcdma_SchedCanSubmit(const XMcdma_SchedChan *SchedChan,
+				 u32 BdLimit)
+{
+	const XMcdma_SchedReq *Req;
+
+	if ((SchedChan->Chan == NULL) ||
+	    (SchedChan->Count == SchedChan->InFlight)) {
+		return FALSE;
+	}
+
+	Req = &SchedChan->Queue[(SchedChan->Head + SchedChan->InFlight) %
+				SchedChan->QueueDepth];
+
+	if ((SchedChan->BdsInFlight >= SchedChan->BdBudget) ||
+	    (Req->BdCount > (SchedChan->BdBudget - SchedChan->BdsInFlight)) ||
+	    (Req->BdCount > SchedChan->Chan->BdCnt) ||
+	    (Req->BdCount > BdLimit)) {
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/*****************************************************************************/
+/**
+* Moves the oldest waiting request of a channel into its BD chain. For MM2S
+* channels the request is marked as one packet with SOF and EOF.
+*
+* @param	SchedChan is the scheduled channel to be worked on.
+*
+* @return
+*		- XST_SUCCESS if the request was submitted
+*		- XST_FAILURE if XMcDma_ChanSubmit() failed
+*
+*****************************************************************************/
+static u32 XMcdma_SchedSubmitReq(XMcdma_SchedChan *SchedChan)
+{
+	XMcdma_ChanCtrl *Chan = SchedChan->Chan;
+	XMcdma_SchedReq *Req;
+	XMcdma_Bd *FirstBd;
+	u32 Status;
+
+	Req = &SchedChan->Queue[(SchedChan->Head + SchedChan->InFlight) %
+				SchedChan->QueueDepth];
+	FirstBd = XMcdma_GetChanCurBd(Chan);
+
+	Status = XMcDma_ChanSubmit(Chan, Req->BufAddr, Req->Len);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (!Chan->IsRxChan) {
+		if (FirstBd == Chan->BdTail) {
+			XMcDma_BdSetCtrl(FirstBd, XMCDMA_BD_CTRL_SOF_MASK |
+					 XMCDMA_BD_CTRL_EOF_MASK);
+		} else {
+			XMcDma_BdSetCtrl(FirstBd, XMCDMA_BD_CTRL_SOF_MASK);
+			XMcDma_BdSetCtrl(Chan->BdTail, XMCDMA_BD_CTRL_EOF_MASK);
+			XMCDMA_CACHE_FLUSH((UINTPTR)(Chan->BdTail));
+		}
+		XMCDMA_CACHE_FLUSH((UINTPTR)(FirstBd));
+	}
+
+	SchedChan->InFlight++;
+	SchedChan->BdsInFlight += Req->BdCount;
+	SchedChan->Stats.Submitted++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Initializes a scheduler with no channels.
+*
+* @param	SchedPtr is the scheduler to be worked on.
+* @param	Policy is XMCDMA_SCHED_RR or XMCDMA_SCHED_DRR.
+* @param	Quantum is the number of bytes a XMCDMA_SCHED_DRR channel earns
+*		per round and unit of weight. Unused for XMCDMA_SCHED_RR.
+* @param	BatchBds is the maximum number of BDs submitted by one
+*		XMcdma_SchedDispatch() call, 0 for no limit.
+* @param	TimeFn returns the time stamps of the latency statistics,
+*		NULL to not collect latencies.
+* @param	TimeRef is passed to TimeFn.
+*
+* @return	None
+*
+*****************************************************************************/
+void XMcdma_SchedInit(XMcdma_Sched *SchedPtr, XMcdma_SchedPolicy Policy,
+		      u32 Quantum, u32 BatchBds, XMcdma_SchedTimeFn TimeFn,
+		      void *TimeRef)
+{
+	Xil_AssertVoid(SchedPtr != NULL);
+	Xil_AssertVoid((Policy == XMCDMA_SCHED_RR) ||
+		       (Policy == XMCDMA_SCHED_DRR));
+	Xil_AssertVoid((Policy == XMCDMA_SCHED_RR) || (Quantum > 0U));
+
+	(void)memset(SchedPtr, 0, sizeof(XMcdma_Sched));
+
+	SchedPtr->Policy = Policy;
+	SchedPtr->Quantum = Quantum;
+	SchedPtr->BatchBds = BatchBds;
+	SchedPtr->TimeFn = TimeFn;
+	SchedPtr->TimeRef = TimeRef;
+}
+
+/*****************************************************************************/
+/**
+* Adds a channel to the scheduler. The BD chain of the channel must have been
+* created with XMcDma_ChanBdCreate(), and from now on transfers of the
+* channel must only be submitted through the scheduler.
+*
+* @param	SchedPtr is the scheduler to be worked on.
+* @param	Chan is the MCDMA channel to be scheduled.
+* @param	QueuePtr is the storage of the request queue of the channel.
+* @param	Depth is the number of entries of QueuePtr.
+* @param	Weight is the scheduling weight, at least 1.
+* @param	BdBudget is the maximum number of BDs the channel may have in
+*		hardware, at least 1.
+*
+* @return
+*		- XST_SUCCESS if the channel was added
+*		- XST_INVALID_PARAM if the channel direction differs from the
+*		  channels already added
+*
+*****************************************************************************/
+u32 XMcdma_SchedAddChan(XMcdma_Sched *SchedPtr, XMcdma_ChanCtrl *Chan,
+			XMcdma_SchedReq *QueuePtr, u32 Depth, u32 Weight,
+			u32 BdBudget)
+{
+	XMcdma_SchedChan *SchedChan;
+	u32 Index;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(Chan != NULL);
+	Xil_AssertNonvoid((Chan->Chan_id > 0U) &&
+			  (Chan->Chan_id <= XMCDMA_SCHED_MAX_CHAN));
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Depth > 0U);
+	Xil_AssertNonvoid(Weight > 0U);
+	Xil_AssertNonvoid(BdBudget > 0U);
+
+	for (Index = 0U; Index < XMCDMA_SCHED_MAX_CHAN; Index++) {
+		if ((SchedPtr->Chans[Index].Chan != NULL) &&
+		    (SchedPtr->Chans[Index].Chan->IsRxChan != Chan->IsRxChan)) {
+			xil_printf("Scheduler channels must have one direction\n\r");
+
+			return XST_INVALID_PARAM;
+		}
+	}
+
+	SchedChan = &SchedPtr->Chans[Chan->Chan_id - 1U];
+	(void)memset(SchedChan, 0, sizeof(XMcdma_SchedChan));
+
+	SchedChan->Queue = QueuePtr;
+	SchedChan->QueueDepth = Depth;
+	SchedChan->Weight = Weight;
+	SchedChan->BdBudget = BdBudget;
+	SchedChan->Stats.LatencyMin = ~0ULL;
+	SchedChan->Chan = Chan;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Changes the weight and BD budget of a scheduled channel. Requests already
+* in hardware are not affected.
+*
+* @param	SchedPtr is the scheduler to be worked on.
+* @param	ChanId is the channel number, 1 based.
+* @param	Weight is the scheduling weight, at least 1.
+* @param	BdBudget is the maximum number of BDs the channel may have in
+*		hardware, at least 1.
+*
+* @return
+*		- XST_SUCCESS if the parameters were updated
+*		- XST_INVALID_PARAM if the channel is not scheduled
+*
+*****************************************************************************/
+u32 XMcdma_SchedSetWeight(XMcdma_Sched *SchedPtr, u32 ChanId, u32 Weight,
+			  u32 BdBudget)
+{
+	XMcdma_SchedChan *SchedChan;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid((ChanId > 0U) && (ChanId <= XMCDMA_SCHED_MAX_CHAN));
+	Xil_AssertNonvoid(Weight > 0U);
+	Xil_AssertNonvoid(BdBudget > 0U);
+
+	SchedChan = &SchedPtr->Chans[ChanId - 1U];
+	if (SchedChan->Chan == NULL) {
+		return XST_INVALID_PARAM;
+	}
+
+	SchedChan->Weight = Weight;
+	SchedChan->BdBudget = BdBudget;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Queues a transfer on a channel. The transfer is given to hardware by a
+* later XMcdma_SchedDispatch().
+*
+* @param	SchedPtr is the scheduler to be worked on.
+* @param	ChanId is the channel number, 1 based.
+* @param	BufAddr is the buffer address to which data should send/recv.
+* @param	Len is the amount of data to send/recv, one packet on MM2S.
+*
+* @return
+*		- XST_SUCCESS if the request was queued
+*		- XST_DEVICE_BUSY if the request queue of the channel is full
+*		- XST_INVALID_PARAM if the channel is not scheduled, or Len
+*		  needs more BDs than the BD budget of the channel
+*
+*****************************************************************************/
+u32 XMcdma_SchedEnqueue(XMcdma_Sched *SchedPtr, u32 ChanId, UINTPTR BufAddr,
+			u32 Len)
+{
+	XMcdma_SchedChan *SchedChan;
+	XMcdma_SchedReq *Req;
+	u32 BdCount;
+	u32 Backlog;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid((ChanId > 0U) && (ChanId <= XMCDMA_SCHED_MAX_CHAN));
+	Xil_AssertNonvoid(Len > 0U);
+
+	SchedChan = &SchedPtr->Chans[ChanId - 1U];
+	if (SchedChan->Chan == NULL) {
+		return XST_INVALID_PARAM;
+	}
+
+	BdCount = (Len + (SchedChan->Chan->MaxTransferLen - 1U)) /
+		  SchedChan->Chan->MaxTransferLen;
+	if (BdCount > SchedChan->BdBudget) {
+		xil_printf("Transfer needs %x BDs, budget is %x\n\r", BdCount,
+			   SchedChan->BdBudget);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if (SchedChan->Count == SchedChan->QueueDepth) {
+		SchedChan->Stats.Rejected++;
+
+		return XST_DEVICE_BUSY;
+	}
+
+	Req = &SchedChan->Queue[(SchedChan->Head + SchedChan->Count) %
+				SchedChan->QueueDepth];
+	Req->BufAddr = BufAddr;
+	Req->Len = Len;
+	Req->BdCount = BdCount;
+	Req->Stamp = (SchedPtr->TimeFn != NULL) ?
+		     SchedPtr->TimeFn(SchedPtr->TimeRef) : 0U;
+
+	SchedChan->Count++;
+	SchedChan->Stats.Enqueued++;
+
+	Backlog = SchedChan->Count - SchedChan->InFlight;
+	if (Backlog > SchedChan->Stats.MaxBacklog) {
+		SchedChan->Stats.MaxBacklog = Backlog;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Moves queued requests into the BD chains and starts them. Channels are
+* visited in rounds according to the scheduling policy, until no channel
+* can submit any more or the dispatch batch is full. Every channel that got
+* new BDs is then handed to hardware with one XMcDma_ChanToHw().
+*
+* When the batch limit cuts a dispatch short, the next call starts its rounds
+* at the channel after the last one served, so that the others are not
+* starved.
+*
+* @param	SchedPtr is the scheduler to be worked on.
+* @param	BdCountPtr returns the number of BDs submitted, may be NULL.
+*
+* @return
+*		- XST_SUCCESS if all channels were started
+*		- XST_FAILURE if a channel could not be started
+*
+*****************************************************************************/
+u32 XMcdma_SchedDispatch(XMcdma_Sched *SchedPtr, u32 *BdCountPtr)
+{
+	XMcdma_SchedChan *SchedChan;
+	XMcdma_SchedReq *Req;
+	u32 BdsLeft;
+	u32 BdLimit;
+	u32 BdCount = 0U;
+	u32 Touched = 0U;
+	u32 Progress;
+	u32 Sent;
+	u32 Index;
+	u32 Round;
+	u32 Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+
+	BdsLeft = (SchedPtr->BatchBds != 0U) ? SchedPtr->BatchBds :
+		  XMCDMA_SCHED_NO_LIMIT;
+	Index = SchedPtr->Next;
+
+	do {
+		Progress = FALSE;
+
+		for (Round = 0U; Round < XMCDMA_SCHED_MAX_CHAN; Round++) {
+			Index = (SchedPtr->Next + Round) % XMCDMA_SCHED_MAX_CHAN;
+			SchedChan = &SchedPtr->Chans[Index];
+
+			/* A request larger than the batch is only allowed
+			 * to start a dispatch, so that it is not starved
+			 */
+			BdLimit = (BdCount == 0U) ? XMCDMA_SCHED_NO_LIMIT : BdsLeft;
+			if (XMcdma_SchedCanSubmit(SchedChan, BdLimit) == FALSE) {
+				if (SchedChan->Count == SchedChan->InFlight) {
+					SchedChan->Deficit = 0U;
+				}
+				continue;
+			}
+
+			Progress = TRUE;
+			Sent = 0U;
+			if (SchedPtr->Policy == XMCDMA_SCHED_DRR) {
+				SchedChan->Deficit += SchedChan->Weight *
+						      SchedPtr->Quantum;
+			}
+
+			while (XMcdma_SchedCanSubmit(SchedChan, BdLimit) == TRUE) {
+				Req = &SchedChan->Queue[(SchedChan->Head +
+							 SchedChan->InFlight) %
+							SchedChan->QueueDepth];
+				if (SchedPtr->Policy == XMCDMA_SCHED_DRR) {
+					if (Req->Len > SchedChan->Deficit) {
+						break;
+					}
+				} else if (Sent == SchedChan->Weight) {
+					break;
+				}
+
+				if (XMcdma_SchedSubmitReq(SchedChan) != XST_SUCCESS) {
+					break;
+				}
+
+				if (SchedPtr->Policy == XMCDMA_SCHED_DRR) {
+					SchedChan->Deficit -= Req->Len;
+				}
+				BdsLeft = (Req->BdCount < BdsLeft) ?
+					  (BdsLeft - Req->BdCount) : 0U;
+				BdCount += Req->BdCount;
+				Touched |= (1U << Index);
+				Sent++;
+				BdLimit = BdsLeft;
+			}
+
+			if (SchedChan->Count == SchedChan->InFlight) {
+				SchedChan->Deficit = 0U;
+			}
+
+			if (BdsLeft == 0U) {
+				break;
+			}
+		}
+	} while ((Progress == TRUE) && (BdsLeft != 0U));
+
+	SchedPtr->Next = (Index + 1U) % XMCDMA_SCHED_MAX_CHAN;
+
+	for (Index = 0U; Index < XMCDMA_SCHED_MAX_CHAN; Index++) {
+		if ((Touched & (1U << Index)) == 0U) {
+			continue;
+		}
+		if (XMcDma_ChanToHw(SchedPtr->Chans[Index].Chan) != XST_SUCCESS) {
+			Status = XST_FAILURE;
+		}
+	}
+
+	if (BdCountPtr != NULL) {
+		*BdCountPtr = BdCount;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Reports BDs of a channel that were retrieved with XMcdma_BdChainFromHW().
+* Requests all of whose BDs have completed are retired, which returns their
+* BDs to the budget of the channel and updates the statistics.
+*
+* @param	SchedPtr is the scheduler to be worked on.
+* @param	ChanId is the channel number, 1 based.
+* @param	BdCount is the number of BDs returned by XMcdma_BdChainFromHW().
+*
+* @return	Number of requests retired.
+*
+*****************************************************************************/
+u32 XMcdma_SchedComplete(XMcdma_Sched *SchedPtr, u32 ChanId, u32 BdCount)
+{
+	XMcdma_SchedChan *SchedChan;
+	XMcdma_SchedReq *Req;
+	u64 Now = 0U;
+	u64 Latency;
+	u32 Retired = 0U;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid((ChanId > 0U) && (ChanId <= XMCDMA_SCHED_MAX_CHAN));
+
+	SchedChan = &SchedPtr->Chans[ChanId - 1U];
+	if (SchedChan->Chan == NULL) {
+		return 0U;
+	}
+
+	SchedChan->DoneBds += BdCount;
+	if (SchedPtr->TimeFn != NULL) {
+		Now = SchedPtr->TimeFn(SchedPtr->TimeRef);
+	}
+
+	while (SchedChan->InFlight > 0U) {
+		Req = &SchedChan->Queue[SchedChan->Head];
+		if (Req->BdCount > SchedChan->DoneBds) {
+			break;
+		}
+
+		SchedChan->DoneBds -= Req->BdCount;
+		SchedChan->BdsInFlight -= Req->BdCount;
+
+		if (SchedPtr->TimeFn != NULL) {
+			Latency = Now - Req->Stamp;
+			SchedChan->Stats.LatencySum += Latency;
+			if (Latency < SchedChan->Stats.LatencyMin) {
+				SchedChan->Stats.LatencyMin = Latency;
+			}
+			if (Latency > SchedChan->Stats.LatencyMax) {
+				SchedChan->Stats.LatencyMax = Latency;
+			}
+		}
+
+		SchedChan->Head = (SchedChan->Head + 1U) % SchedChan->QueueDepth;
+		SchedChan->InFlight--;
+		SchedChan->Count--;
+		SchedChan->Stats.Completed++;
+		Retired++;
+	}
+
+	return Retired;
+}
+
+/*****************************************************************************/
+/**
+* Gets the statistics of a scheduled channel. Backlog and InFlightBds are
+* the current values; LatencyMin is 0 while no request has completed. The
+* mean latency is LatencySum / Completed in the unit of the time function.
+*
+* @param	SchedPtr is the scheduler to be worked on.
+* @param	ChanId is the channel number, 1 based.
+* @param	StatsPtr returns the statistics.
+* @param	Reset clears the counters after they are read when non zero.
+*
+* @return	None
+*
+*****************************************************************************/
+void XMcdma_SchedGetStats(XMcdma_Sched *SchedPtr, u32 ChanId,
+			  XMcdma_SchedStats *StatsPtr, u32 Reset)
+{
+	XMcdma_SchedChan *SchedChan;
+
+	Xil_AssertVoid(SchedPtr != NULL);
+	Xil_AssertVoid((ChanId > 0U) && (ChanId <= XMCDMA_SCHED_MAX_CHAN));
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	SchedChan = &SchedPtr->Chans[ChanId - 1U];
+
+	*StatsPtr = SchedChan->Stats;
+	StatsPtr->Backlog = SchedChan->Count - SchedChan->InFlight;
+	StatsPtr->InFlightBds = SchedChan->BdsInFlight;
+	if (StatsPtr->Completed == 0U) {
+		StatsPtr->LatencyMin = 0U;
+	}
+
+	if (Reset != 0U) {
+		(void)memset(&SchedChan->Stats, 0, sizeof(XMcdma_SchedStats));
+		SchedChan->Stats.LatencyMin = ~0ULL;
+	}
+}
+/** @} */
@@ -0,0 +1,162 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_sched.h
+* @addtogroup mcdma Overview
+* @{
+*
+* The software scheduler arbitrates the submission of transfers between the
+* channels of one direction of an MCDMA core. Instead of calling
+* XMcDma_ChanSubmit() directly, the application queues requests per channel
+* with XMcdma_SchedEnqueue() and calls XMcdma_SchedDispatch(), which moves
+* queued requests into the BD chains and hands each channel its batch with a
+* single XMcDma_ChanToHw().
+*
+* - XMCDMA_SCHED_RR submits up to Weight requests per channel per round.
+* - XMCDMA_SCHED_DRR is deficit round robin: every round a channel earns
+*   Weight times the quantum in bytes, so that bandwidth is shared by weight
+*   regardless of the request sizes.
+*
+* Each channel also has a BD budget, the maximum number of BDs it may have
+* in hardware at a time, so that a busy channel cannot use up the BD chain
+* space and hardware queue ahead of the others.
+*
+* Completed BDs are retrieved by the application as before with
+* XMcdma_BdChainFromHW() and XMcdma_BdChainFree(); their number is then
+* reported with XMcdma_SchedComplete(), which retires the requests and
+* updates the latency statistics.
+*
+* One scheduler instance handles the channels of one direction. It is not
+* thread safe; the application must serialize the calls.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.12  mb      10/16/26 Initial version.
+*
+******************************************************************************/
+#ifndef XMCDMA_SCHED_H_
+#define XMCDMA_SCHED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XMCDMA_SCHED_MAX_CHAN		16	/**< Channels per direction */
+
+/**************************** Type Definitions *******************************/
+
+typedef enum {
+	XMCDMA_SCHED_RR,	/**< Weighted round robin on requests */
+	XMCDMA_SCHED_DRR,	/**< Deficit round robin on bytes */
+} XMcdma_SchedPolicy;
+
+/**
+ * Returns the current time in any unit, used for latency statistics.
+ */
+typedef u64 (*XMcdma_SchedTimeFn) (void *TimeRef);
+
+/**
+ * Queued request, storage is provided by the application per channel.
+ */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer to transfer */
+	u32 Len;		/**< Length of the transfer in bytes */
+	u32 BdCount;		/**< BDs used by the transfer */
+	u64 Stamp;		/**< Time of XMcdma_SchedEnqueue() */
+} XMcdma_SchedReq;
+
+/**
+ * Per channel statistics.
+ */
+typedef struct {
+	u32 Enqueued;		/**< Requests accepted */
+	u32 Rejected;		/**< Requests refused, queue full */
+	u32 Submitted;		/**< Requests given to hardware */
+	u32 Completed;		/**< Requests completed */
+	u32 Backlog;		/**< Requests waiting for submission */
+	u32 MaxBacklog;		/**< Highest backlog seen */
+	u32 InFlightBds;	/**< BDs currently in hardware */
+	u64 LatencySum;		/**< Sum of enqueue to completion times */
+	u64 LatencyMin;		/**< Shortest enqueue to completion time */
+	u64 LatencyMax;		/**< Longest enqueue to completion time */
+} XMcdma_SchedStats;
+
+typedef struct {
+	XMcdma_ChanCtrl *Chan;	/**< Channel, NULL if not scheduled */
+	XMcdma_SchedReq *Queue;	/**< Request queue storage */
+	u32 QueueDepth;		/**< Number of entries in Queue */
+	u32 Head;		/**< Oldest request in flight */
+	u32 InFlight;		/**< Requests submitted, not completed */
+	u32 Count;		/**< Requests in flight and waiting */
+	u32 Weight;		/**< Scheduling weight */
+	u32 BdBudget;		/**< Max BDs in hardware */
+	u32 BdsInFlight;	/**< BDs in hardware */
+	u32 DoneBds;		/**< Completed BDs not yet retired */
+	u32 Deficit;		/**< DRR credit in bytes */
+	XMcdma_SchedStats Stats;
+} XMcdma_SchedChan;
+
+typedef struct {
+	XMcdma_SchedPolicy Policy;
+	u32 Quantum;		/**< DRR bytes per unit of weight */
+	u32 BatchBds;		/**< Max BDs per dispatch, 0 for no limit */
+	u32 Next;		/**< Channel index the next round starts at */
+	XMcdma_SchedTimeFn TimeFn;
+	void *TimeRef;
+	XMcdma_SchedChan Chans[XMCDMA_SCHED_MAX_CHAN];
+} XMcdma_Sched;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* Gets the number of requests of a channel waiting for submission.
+*
+* @param	SchedPtr is the scheduler to be worked on.
+* @param	ChanId is the channel number, 1 based.
+*
+* @return	Number of requests waiting.
+*
+* @note		C-style signature:
+* 		u32 XMcdma_SchedGetBacklog(XMcdma_Sched *SchedPtr, u32 ChanId)
+*****************************************************************************/
+#define XMcdma_SchedGetBacklog(SchedPtr, ChanId) \
+	((SchedPtr)->Chans[(ChanId) - 1].Count - \
+	 (SchedPtr)->Chans[(ChanId) - 1].InFlight)
+
+/************************ Prototypes of functions **************************/
+
+void XMcdma_SchedInit(XMcdma_Sched *SchedPtr, XMcdma_SchedPolicy Policy,
+		      u32 Quantum, u32 BatchBds, XMcdma_SchedTimeFn TimeFn,
+		      void *TimeRef);
+u32 XMcdma_SchedAddChan(XMcdma_Sched *SchedPtr, XMcdma_ChanCtrl *Chan,
+			XMcdma_SchedReq *QueuePtr, u32 Depth, u32 Weight,
+			u32 BdBudget);
+u32 XMcdma_SchedSetWeight(XMcdma_Sched *SchedPtr, u32 ChanId, u32 Weight,
+			  u32 BdBudget);
+u32 XMcdma_SchedEnqueue(XMcdma_Sched *SchedPtr, u32 ChanId, UINTPTR BufAddr,
+			u32 Len);
+u32 XMcdma_SchedDispatch(XMcdma_Sched *SchedPtr, u32 *BdCountPtr);
+u32 XMcdma_SchedComplete(XMcdma_Sched *SchedPtr, u32 ChanId, u32 BdCount);
+void XMcdma_SchedGetStats(XMcdma_Sched *SchedPtr, u32 ChanId,
+			  XMcdma_SchedStats *StatsPtr, u32 Reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XMCDMA_SCHED_H_ */
+/** @} */
@@ -95,6 +95,11 @@
 * 1.13  akm    02/13/24    Ensure buffer cache sync.
 * 1.13  akm    02/13/24    Avoid loop counter reset.
 * 1.13  akm    02/13/24    Always wrap page to device size.
+* 1.14  mb     10/16/26    Use ONFI read cache sequential commands for
+*                          multi page reads within a block.
+* 1.14  mb     10/16/26    Make cache reads opt-in, do not use them with
+*                          controller ECC and program the packet size of
+*                          the read cache start operation.
 *
 * </pre>
 *
@@ -182,6 +187,13 @@ static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 			     u32 Col, u8 *Buf);
 
+static s32 XNandPsu_ReadPageCmd(XNandPsu *InstancePtr, u32 Target, u32 Page,
+				u32 Col, u8 *Buf, u8 Cmd1, u8 Cmd2,
+				u8 AddrCycles, u32 ProgMask);
+
+static s32 XNandPsu_ReadCache(XNandPsu *InstancePtr, u32 Target, u32 Page,
+			      u32 NumPages, u8 *Buf);
+
 static s32 XNandPsu_CheckOnDie(XNandPsu *InstancePtr);
 
 static void XNandPsu_SetEccAddrSize(XNandPsu *InstancePtr);
@@ -249,6 +261,8 @@ s32 XNandPsu_CfgInitialize(XNandPsu *InstancePtr, XNandPsu_Config *ConfigPtr,
 	InstancePtr->Mode = XNANDPSU_POLLING;
 	/* Enable MDMA mode by default */
 	InstancePtr->DmaMode = XNANDPSU_MDMA;
+	/* Read cache commands are disabled by default */
+	InstancePtr->CacheReadMode = 0U;
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
 	/* Initialize the NAND flash targets */
@@ -582,6 +596,8 @@ static void XNandPsu_InitFeatures(XNandPsu *InstancePtr, OnfiParamPage *Param)
 				       1U : 0U;
 	InstancePtr->Features.ExtPrmPage = ((Param->Features & (1U << 7)) != 0U) ?
 					   1U : 0U;
+	InstancePtr->Features.ReadCache = ((Param->OptionalCmds & (1U << 1)) != 0U) ?
+					  1U : 0U;
 }
 
 /*****************************************************************************/
@@ -824,6 +840,56 @@ void XNandPsu_DisableEccMode(XNandPsu *InstancePtr)
 	InstancePtr->EccMode = XNANDPSU_NONE;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function enables the use of ONFI read cache sequential commands for
+* multi page reads. The commands are used only if the flash advertises read
+* cache support in its parameter page and the ECC mode is not controller
+* ECC (XNANDPSU_HWECC). Controller ECC reads the ECC bytes from the spare
+* area with a Change Read Column command after each page, which ONFI does
+* not allow within a read cache sequence.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+*
+* @return
+*		None
+*
+* @note		None
+*
+******************************************************************************/
+void XNandPsu_EnableCacheReadMode(XNandPsu *InstancePtr)
+{
+	/* Assert the input arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->CacheReadMode = 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function disables the use of ONFI read cache commands. Every page is
+* then read with a separate Read Page command.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+*
+* @return
+*		None
+*
+* @note		None
+*
+******************************************************************************/
+void XNandPsu_DisableCacheReadMode(XNandPsu *InstancePtr)
+{
+	/* Assert the input arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->CacheReadMode = 0U;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1549,6 +1615,7 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 	u32 PartialBytes = 0U;
 	u32 RemLen;
 	u32 NumBytes;
+	u32 NumPages;
 	u8 *BufPtr;
 	u8 *DestBufPtr = (u8 *)DestBuf;
 	u64 OffsetVar = Offset;
@@ -1603,9 +1670,33 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 				   InstancePtr->Geometry.BytesPerPage :
 				   (u32)LengthVar;
 		}
-		/* Read page */
-		Status = XNandPsu_ReadPage(InstancePtr, Target, Page, 0U,
-					   BufPtr);
+		/*
+		 * Read the full pages up to the end of the block with read
+		 * cache commands, so that the array read of the next page
+		 * overlaps the data transfer of the current page.
+		 */
+		NumPages = 0U;
+		if ((PartialBytes == 0U) &&
+		    (InstancePtr->CacheReadMode != 0U) &&
+		    (InstancePtr->Features.ReadCache != 0U) &&
+		    (InstancePtr->EccMode != XNANDPSU_HWECC)) {
+			NumPages = InstancePtr->Geometry.PagesPerBlock -
+				   (Page % InstancePtr->Geometry.PagesPerBlock);
+			if (((u64)NumPages *
+			     InstancePtr->Geometry.BytesPerPage) > LengthVar) {
+				NumPages = (u32)(LengthVar /
+						 InstancePtr->Geometry.BytesPerPage);
+			}
+		}
+		if (NumPages > 1U) {
+			NumBytes = NumPages * InstancePtr->Geometry.BytesPerPage;
+			Status = XNandPsu_ReadCache(InstancePtr, Target, Page,
+						    NumPages, BufPtr);
+		} else {
+			/* Read page */
+			Status = XNandPsu_ReadPage(InstancePtr, Target, Page,
+						   0U, BufPtr);
+		}
 		if (Status != XST_SUCCESS) {
 			goto Out;
 		}
@@ -1958,13 +2049,46 @@ Out:
 ******************************************************************************/
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 			     u32 Col, u8 *Buf)
+{
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
+			 InstancePtr->Geometry.ColAddrCycles;
+
+	return XNandPsu_ReadPageCmd(InstancePtr, Target, Page, Col, Buf,
+				    ONFI_CMD_RD1, ONFI_CMD_RD2, (u8)AddrCycles,
+				    XNANDPSU_PROG_RD_MASK);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends a page read command to flash and transfers the page
+* data, checking the ECC status when hardware ECC is enabled.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the page address value to read.
+* @param	Col is the column address value to read.
+* @param	Buf is the data buffer to fill in.
+* @param	Cmd1 is the first command cycle.
+* @param	Cmd2 is the second command cycle.
+* @param	AddrCycles is the number of address cycles.
+* @param	ProgMask is the Program Register operation mask.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_ReadPageCmd(XNandPsu *InstancePtr, u32 Target, u32 Page,
+				u32 Col, u8 *Buf, u8 Cmd1, u8 Cmd2,
+				u8 AddrCycles, u32 ProgMask)
 {
 	u32 PktSize;
 	u32 PktCount;
 	s32 Status = XST_FAILURE;
 	u32 RegVal;
-	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
-			 InstancePtr->Geometry.ColAddrCycles;
 
 	if (InstancePtr->EccCfg.CodeWordSize > 9U) {
 		PktSize = 1024U;
@@ -1973,8 +2097,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage / PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
-			     1U, 1U, (u8)AddrCycles);
+	XNandPsu_Prepare_Cmd(InstancePtr, Cmd1, Cmd2, 1U, 1U, AddrCycles);
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
 		RegVal = XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK |
@@ -2011,7 +2134,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 
 	/* Set Read command in Program Register */
 	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
-			  XNANDPSU_PROG_OFFSET, XNANDPSU_PROG_RD_MASK);
+			  XNANDPSU_PROG_OFFSET, ProgMask);
 
 	Status = XNandPsu_Data_ReadWrite(InstancePtr, Buf, PktCount, PktSize, 0, 1);
 
@@ -2064,6 +2187,103 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function reads consecutive pages of a block using the ONFI read cache
+* commands. The Read Cache Sequential command moves the next page from the
+* array to the data register while the current page is transferred from the
+* cache register, which hides the array read time of all but the first page.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the first page address value to read.
+* @param	NumPages is the number of pages to read. All pages must be
+*		in the same block.
+* @param	Buf is the data buffer to fill in.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		Must not be used with controller ECC (XNANDPSU_HWECC), whose
+*		spare area reads are not allowed within a read cache sequence.
+*
+******************************************************************************/
+static s32 XNandPsu_ReadCache(XNandPsu *InstancePtr, u32 Target, u32 Page,
+			      u32 NumPages, u8 *Buf)
+{
+	s32 Status = XST_FAILURE;
+	u32 Index;
+	u32 ProgMask;
+	u32 PktSize;
+	u32 PktCount;
+	u8 Cmd;
+	u8 *BufPtr = Buf;
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
+			 InstancePtr->Geometry.ColAddrCycles;
+
+	if (InstancePtr->EccCfg.CodeWordSize > 9U) {
+		PktSize = 1024U;
+	} else {
+		PktSize = 512U;
+	}
+	PktCount = InstancePtr->Geometry.BytesPerPage / PktSize;
+
+	/*
+	 * Enable Transfer Complete Interrupt in Interrupt Status Enable
+	 * Register
+	 */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			  XNANDPSU_INTR_STS_EN_OFFSET,
+			  XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK);
+
+	/* Load the first page into the data register */
+	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
+			     0U, 0U, (u8)AddrCycles);
+	/* Program Page Size */
+	XNandPsu_SetPageSize(InstancePtr);
+	/* Program Column, Page, Block address */
+	XNandPsu_SetPageColAddr(InstancePtr, Page, 0U);
+	/* Program Packet Size and Packet Count */
+	XNandPsu_SetPktSzCnt(InstancePtr, PktSize, PktCount);
+	/* Program Memory Address Register2 for chip select */
+	XNandPsu_SelectChip(InstancePtr, Target);
+	/* Set Read Cache Start in Program Register */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			  XNANDPSU_PROG_OFFSET, XNANDPSU_PROG_RD_CACHE_START_MASK);
+	/* Poll for Transfer Complete event */
+	Status = XNandPsu_WaitFor_Transfer_Complete(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		goto Out;
+	}
+
+	for (Index = 0U; Index < NumPages; Index++) {
+		/* The last page ends the cache read sequence */
+		if (Index == (NumPages - 1U)) {
+			Cmd = ONFI_CMD_RD_CACHE_END;
+			ProgMask = XNANDPSU_PROG_RD_CACHE_END_MASK;
+		} else {
+			Cmd = ONFI_CMD_RD_CACHE_SEQ;
+			ProgMask = XNANDPSU_PROG_RD_CACHE_SEQ_MASK;
+		}
+		Status = XNandPsu_ReadPageCmd(InstancePtr, Target,
+					      Page + Index, 0U, BufPtr, Cmd,
+					      0U, 0U, ProgMask);
+		if (Status != XST_SUCCESS) {
+#ifdef XNANDPSU_DEBUG
+			xil_printf("%s: Read cache failed at page %d\r\n",
+				   __func__, Page + Index);
+#endif
+			goto Out;
+		}
+		BufPtr += InstancePtr->Geometry.BytesPerPage;
+	}
+
+Out:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
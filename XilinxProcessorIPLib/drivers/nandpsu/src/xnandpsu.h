@@ -159,6 +159,7 @@
 * 1.13  akm    02/13/24    Ensure buffer cache sync.
 * 1.13  akm    02/13/24    Avoid loop counter reset.
 * 1.13  akm    02/13/24    Always wrap page to device size.
+* 1.14  mb     10/16/26    Added read cache support and cache read mode APIs.
 *
 * </pre>
 *
@@ -348,6 +349,7 @@ typedef struct {
 	u32 EzNand;
 	u32 OnDie;
 	u32 ExtPrmPage;
+	u32 ReadCache;
 } XNandPsu_Features;
 
 /**
@@ -395,6 +397,7 @@ typedef struct {
 	XNandPsu_EccCfg EccCfg;		/**< ECC configuration */
 	XNandPsu_Geometry Geometry;	/**< Flash geometry */
 	XNandPsu_Features Features;	/**< ONFI features */
+	u32 CacheReadMode;		/**< Read cache commands enabled/disabled */
 #ifdef __ICCARM__
 	u8 PartialDataBuf[XNANDPSU_MAX_PAGE_SIZE];	/**< Partial read/write buffer */
 #pragma pack(pop)
@@ -579,6 +582,10 @@ void XNandPsu_EnableEccMode(XNandPsu *InstancePtr);
 
 void XNandPsu_DisableEccMode(XNandPsu *InstancePtr);
 
+void XNandPsu_EnableCacheReadMode(XNandPsu *InstancePtr);
+
+void XNandPsu_DisableCacheReadMode(XNandPsu *InstancePtr);
+
 void XNandPsu_Prepare_Cmd(XNandPsu *InstancePtr, u8 Cmd1, u8 Cmd2, u8 EccState,
 			  u8 DmaMode, u8 AddrCycles);
 
@@ -27,6 +27,8 @@
 * 1.8   sk   11/29/22 Added support for Indirect Non-Dma write.
 * 1.8   akm  01/03/23 Use Xil_WaitForEvent() API for register bit polling.
 * 1.9   sb   26/04/23 Updated address calculation logic in DAC read and write API's
+* 1.12  mb   10/16/26 Use Xil_MemCpyDevice for the linear and indirect AHB
+*                     windows.
 *
 * </pre>
 *
@@ -254,7 +256,7 @@ u32 XOspiPsv_Dac_Read(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
 		goto ERROR_PATH;
 	}
 
-	Xil_MemCpy(Msg->RxBfrPtr,(u32 *)Addr, InstancePtr->RxBytes);
+	Xil_MemCpyDevice(Msg->RxBfrPtr,(u32 *)Addr, InstancePtr->RxBytes);
 	InstancePtr->RxBytes = 0U;
 
 	Status = (u32)XST_SUCCESS;
@@ -285,7 +287,7 @@ u32 XOspiPsv_Dac_Write(XOspiPsv *InstancePtr, const XOspiPsv_Msg *Msg)
 		goto ERROR_PATH;
 	}
 
-	Xil_MemCpy((u32 *)Addr, Msg->TxBfrPtr, InstancePtr->TxBytes);
+	Xil_MemCpyDevice((u32 *)Addr, Msg->TxBfrPtr, InstancePtr->TxBytes);
 	InstancePtr->TxBytes = 0U;
 
 	Status = (u32)XST_SUCCESS;
@@ -464,7 +466,7 @@ u32 XOspiPsv_IDac_Write(const XOspiPsv *InstancePtr, const XOspiPsv_Msg *Msg)
 	XOspiPsv_WriteReg(InstancePtr->Config.BaseAddress,
 			XOSPIPSV_INDIRECT_WRITE_XFER_CTRL_REG, (ReadReg));
 
-	Xil_MemCpy(Addr, Msg->TxBfrPtr, Msg->ByteCount);
+	Xil_MemCpyDevice(Addr, Msg->TxBfrPtr, Msg->ByteCount);
 
 	if (Xil_WaitForEvent((InstancePtr->Config.BaseAddress + XOSPIPSV_INDIRECT_WRITE_XFER_CTRL_REG),
 				XOSPIPSV_INDIRECT_WRITE_XFER_CTRL_REG_IND_OPS_DONE_STATUS_FLD_MASK,
@@ -0,0 +1,464 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_intr_example.c
+*
+* This example tests interrupt driven read and write requests on the SD/eMMC
+* interface. Several requests are submitted back to back with
+* XSdPs_SubmitRequest, the driver starts the first one and holds the others
+* in the software request queue. Completion is reported through the request
+* handler from XSdPs_IntrHandler, which must report the requests in
+* submission order.
+*
+* On Versal Net with an eMMC that supports command queuing, the test is
+* repeated with the Command Queue Engine (CQE) enabled, so that all requests
+* are queued in the device at once. Failed CQE tasks are recovered with
+* XSdPs_CqeRecover from the wait loop.
+*
+* Please note that running this example will modify the card contents and
+* file system information will be erased in the card. Card will need to be
+* re-formatted.
+*
+* Modify SD_INTR_ID to the interrupt of the SD controller used, and the
+* offset and size macros to test different SD memory offset and size.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.4   mb     10/16/26 First release
+*
+*</pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xsdps.h"		/* SD device driver */
+#include "xil_exception.h"
+#include "xscugic.h"
+#ifdef SDT
+#include "xinterrupt_wrap.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifndef SDT
+#define SD_DEVICE_ID		XPAR_XSDPS_0_DEVICE_ID
+#define INTC_DEVICE_ID		XPAR_SCUGIC_SINGLE_DEVICE_ID
+#else
+#define SD_BASEADDR		XPAR_XSDPS_0_BASEADDR
+#define INTC_BASEADDR		XPAR_XSCUGIC_0_BASEADDR
+#endif
+#define SD_INTR_ID		XPS_SDIO0_INT_ID
+
+/* Number of requests submitted back to back */
+#define NUM_REQS		8U
+/* Number of SD blocks per request */
+#define NUM_BLOCKS		16U
+/* Sector offset to test */
+#define SECTOR_OFFSET		204800U
+/* Wait for the requests for up to 5 sec */
+#define WAIT_TIMEOUT_US		5000000U
+
+#define TEST			7U
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static int SdpsIntrTest(void);
+static int SetupInterruptSystem(XSdPs *SdInstancePtr);
+static int SdpsRunRequests(XSdPs *SdInstancePtr, u8 Dir, u32 Sector);
+static int SdpsWriteReadCompare(XSdPs *SdInstancePtr, u32 Sector, u8 Pattern);
+static void SdpsRequestHandler(void *CallBackRef, u32 Tag, s32 Status);
+static void SdpsWaitStep(XSdPs *SdInstancePtr);
+
+/************************** Variable Definitions *****************************/
+
+static XSdPs SdInstance;
+#ifndef SDT
+static XScuGic IntcInstance;
+#endif
+static XSdPs_Request ReqQueue[NUM_REQS];
+
+#ifdef VERSAL_NET
+static XSdPs_Cqe CqeState;
+#endif
+
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+u8 DestinationAddress[NUM_REQS][NUM_BLOCKS * 512U];
+#pragma data_alignment = 32
+u8 SourceAddress[NUM_REQS][NUM_BLOCKS * 512U];
+#else
+u8 DestinationAddress[NUM_REQS][NUM_BLOCKS * 512U] __attribute__ ((aligned(32)));
+u8 SourceAddress[NUM_REQS][NUM_BLOCKS * 512U] __attribute__ ((aligned(32)));
+#endif
+
+/*
+ * Shared between the request handler and the main thread
+ */
+static volatile u32 DoneCount;
+static volatile u32 FailCount;
+static volatile u32 OrderErrors;
+static volatile u32 InOrder;
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the SD interrupt example.
+*
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	xil_printf("SD Interrupt Read/ Write Test \r\n");
+
+	Status = SdpsIntrTest();
+	if (Status != XST_SUCCESS) {
+		xil_printf("SD Interrupt Read/ Write Test failed \r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran SD Interrupt Read/ Write Test \r\n");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the completion callback of every request. It counts the
+* completed and failed requests and, when InOrder is set, checks that the
+* requests complete in the order they were submitted.
+*
+* @param	CallBackRef is unused.
+* @param	Tag is the index of the completed request.
+* @param	Status is the completion status of the request.
+*
+* @return	None
+*
+******************************************************************************/
+static void SdpsRequestHandler(void *CallBackRef, u32 Tag, s32 Status)
+{
+	(void)CallBackRef;
+
+	if ((InOrder != 0U) && (Tag != DoneCount)) {
+		OrderErrors++;
+	}
+	if (Status != XST_SUCCESS) {
+		FailCount++;
+	}
+	DoneCount++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is one step of waiting for requests. With the CQE it also
+* recovers failed tasks, which then complete with XST_FAILURE.
+*
+* @param	SdInstancePtr is a pointer to the XSdPs instance.
+*
+* @return	None
+*
+******************************************************************************/
+static void SdpsWaitStep(XSdPs *SdInstancePtr)
+{
+#ifdef VERSAL_NET
+	if (SdInstancePtr->CqePtr != NULL) {
+		(void)XSdPs_CqeRecover(SdInstancePtr);
+	}
+#else
+	(void)SdInstancePtr;
+#endif
+	usleep(1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits NUM_REQS requests back to back and waits until the
+* request handler has been called for all of them.
+*
+* @param	SdInstancePtr is a pointer to the XSdPs instance.
+* @param	Dir is XSDPS_REQ_READ or XSDPS_REQ_WRITE.
+* @param	Sector is the card address of the first request.
+*
+* @return	XST_SUCCESS if all requests completed successfully,
+*		otherwise XST_FAILURE.
+*
+******************************************************************************/
+static int SdpsRunRequests(XSdPs *SdInstancePtr, u8 Dir, u32 Sector)
+{
+	XSdPs_Request Req;
+	u32 Index;
+	u32 Wait;
+	u32 Step = NUM_BLOCKS;
+	int Status;
+
+	if (!(SdInstancePtr->HCS)) {
+		Step *= XSDPS_BLK_SIZE_512_MASK;
+	}
+
+	DoneCount = 0U;
+	FailCount = 0U;
+	OrderErrors = 0U;
+
+	for (Index = 0U; Index < NUM_REQS; Index++) {
+		Req.Arg = Sector + (Index * Step);
+		Req.BlkCnt = NUM_BLOCKS;
+		Req.Buff = (Dir == XSDPS_REQ_READ) ? DestinationAddress[Index] :
+			   SourceAddress[Index];
+		Req.Dir = Dir;
+		Req.Tag = Index;
+		Req.Handler = SdpsRequestHandler;
+		Req.CallBackRef = NULL;
+
+		/* The CQE may have fewer task slots than NUM_REQS */
+		Status = XSdPs_SubmitRequest(SdInstancePtr, &Req);
+		for (Wait = 0U; (Status == XST_DEVICE_BUSY) &&
+		     (Wait < WAIT_TIMEOUT_US); Wait++) {
+			SdpsWaitStep(SdInstancePtr);
+			Status = XSdPs_SubmitRequest(SdInstancePtr, &Req);
+		}
+		if (Status != XST_SUCCESS) {
+			xil_printf("Submit of request %d failed\r\n", Index);
+			return XST_FAILURE;
+		}
+	}
+
+	for (Wait = 0U; (DoneCount < NUM_REQS) && (Wait < WAIT_TIMEOUT_US);
+	     Wait++) {
+		SdpsWaitStep(SdInstancePtr);
+	}
+
+	if ((DoneCount != NUM_REQS) || (FailCount != 0U) ||
+	    (OrderErrors != 0U) || (XSdPs_GetPendingRequests(SdInstancePtr) != 0U)) {
+		xil_printf("%d of %d requests done, %d failed, %d out of order\r\n",
+			   DoneCount, NUM_REQS, FailCount, OrderErrors);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes NUM_REQS requests, reads them back and compares the
+* data.
+*
+* @param	SdInstancePtr is a pointer to the XSdPs instance.
+* @param	Sector is the card address of the first request.
+* @param	Pattern is added to the test data, so that every pass writes
+*		different data.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+******************************************************************************/
+static int SdpsWriteReadCompare(XSdPs *SdInstancePtr, u32 Sector, u8 Pattern)
+{
+	u32 Index;
+	u32 BuffCnt;
+	int Status;
+
+	for (Index = 0U; Index < NUM_REQS; Index++) {
+		for (BuffCnt = 0U; BuffCnt < (NUM_BLOCKS * 512U); BuffCnt++) {
+			SourceAddress[Index][BuffCnt] = (u8)(TEST + Pattern +
+							     Index + BuffCnt);
+			DestinationAddress[Index][BuffCnt] = 0U;
+		}
+	}
+
+	Status = SdpsRunRequests(SdInstancePtr, XSDPS_REQ_WRITE, Sector);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = SdpsRunRequests(SdInstancePtr, XSDPS_REQ_READ, Sector);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < NUM_REQS; Index++) {
+		for (BuffCnt = 0U; BuffCnt < (NUM_BLOCKS * 512U); BuffCnt++) {
+			if (SourceAddress[Index][BuffCnt] !=
+			    DestinationAddress[Index][BuffCnt]) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function performs the SD interrupt Read/ Write Test, through the
+* software request queue and, where available, through the CQE.
+*
+* @param	None
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None
+*
+******************************************************************************/
+static int SdpsIntrTest(void)
+{
+	XSdPs_Config *SdConfig;
+	u32 Sector = SECTOR_OFFSET;
+	int Status;
+
+	/*
+	 * Initialize the host controller
+	 */
+#ifndef SDT
+	SdConfig = XSdPs_LookupConfig(SD_DEVICE_ID);
+#else
+	SdConfig = XSdPs_LookupConfig(SD_BASEADDR);
+#endif
+	if (NULL == SdConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XSdPs_CfgInitialize(&SdInstance, SdConfig,
+				     SdConfig->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XSdPs_CardInitialize(&SdInstance);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (!(SdInstance.HCS)) {
+		Sector *= XSDPS_BLK_SIZE_512_MASK;
+	}
+
+	Status = SetupInterruptSystem(&SdInstance);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Requests submitted while one is in flight wait in ReqQueue and
+	 * complete in submission order.
+	 */
+	XSdPs_SetRequestQueue(&SdInstance, ReqQueue, NUM_REQS);
+	InOrder = 1U;
+	Status = SdpsWriteReadCompare(&SdInstance, Sector, 0U);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Queued requests failed\r\n");
+		return XST_FAILURE;
+	}
+
+#ifdef VERSAL_NET
+	/*
+	 * With the CQE all requests are queued in the device, which may
+	 * complete them in any order.
+	 */
+	Status = XSdPs_CqeEnable(&SdInstance, &CqeState);
+	if (Status == XST_SUCCESS) {
+		InOrder = 0U;
+		Status = SdpsWriteReadCompare(&SdInstance, Sector, 1U);
+		if (Status != XST_SUCCESS) {
+			xil_printf("CQE requests failed\r\n");
+			(void)XSdPs_CqeDisable(&SdInstance);
+			return XST_FAILURE;
+		}
+		Status = XSdPs_CqeDisable(&SdInstance);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	} else {
+		xil_printf("CQE not available, CQE test skipped\r\n");
+	}
+#endif
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function connects XSdPs_IntrHandler to the SD interrupt.
+*
+* @param	SdInstancePtr is a pointer to the XSdPs instance.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+******************************************************************************/
+static int SetupInterruptSystem(XSdPs *SdInstancePtr)
+{
+	int Status;
+#ifndef SDT
+	XScuGic_Config *IntcConfig;
+
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_CfgInitialize(&IntcInstance, IntcConfig,
+				       IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Xil_ExceptionInit();
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+				     (Xil_ExceptionHandler)XScuGic_InterruptHandler,
+				     &IntcInstance);
+
+	Status = XScuGic_Connect(&IntcInstance, SD_INTR_ID,
+				 (Xil_ExceptionHandler)XSdPs_IntrHandler,
+				 (void *)SdInstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XScuGic_Enable(&IntcInstance, SD_INTR_ID);
+	Xil_ExceptionEnable();
+#else
+	u32 IntrId;
+
+	Status = XGetEncodedIntrId(SD_INTR_ID, XINTR_IS_LEVEL_TRIGGERED, XSPI,
+				   XINTC_TYPE_IS_SCUGIC, &IntrId);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XSetupInterruptSystem(SdInstancePtr, XSdPs_IntrHandler, IntrId,
+				       XGetEncodedIntcBaseAddr(INTC_BASEADDR,
+						       XINTC_TYPE_IS_SCUGIC),
+				       XINTERRUPT_DEFAULT_PRIORITY);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+#endif
+
+	return XST_SUCCESS;
+}
@@ -92,6 +92,7 @@
 *                       for SD/eMMC.
 * 4.2   ro     06/12/23 Added support for system device-tree flow.
 * 4.3   ap     11/29/23 Add support for Sanitize feature.
+* 4.4   mb     10/16/26 Initialize request queue and CQE state.
 *
 * </pre>
 *
@@ -187,6 +188,11 @@ s32 XSdPs_CfgInitialize(XSdPs *InstancePtr, XSdPs_Config *ConfigPtr,
 	InstancePtr->IsBusy = FALSE;
 	InstancePtr->BlkSize = 0U;
 	InstancePtr->IsTuningDone = 0U;
+	InstancePtr->ReqQueue = NULL;
+	InstancePtr->ReqQueueDepth = 0U;
+	InstancePtr->ReqHead = 0U;
+	InstancePtr->ReqCount = 0U;
+	InstancePtr->CqePtr = NULL;
 
 	/* Host Controller version is read. */
 	InstancePtr->HC_Version =
@@ -101,6 +101,10 @@
 * 4.3   ap     10/11/23 Resolved compilation errors with Microblaze RISC-V
 * 4.3   ap     11/29/23 Add support for Sanitize feature.
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
+* 4.4   mb     10/16/26 Add interrupt driven request API with optional software
+*                       queue and eMMC 5.1 Command Queue Engine support.
+* 4.4   mb     10/16/26 Add XSdPs_CqeRecover to clear failed CQE tasks from
+*                       task context.
 *
 * </pre>
 *
@@ -238,6 +242,80 @@ typedef struct {
 }  __attribute__((__packed__))XSdPs_Adma2Descriptor64;
 #endif
 
+/** @name Request direction
+ * @{
+ */
+#define XSDPS_REQ_READ		0U	/**< Card to memory */
+#define XSDPS_REQ_WRITE		1U	/**< Memory to card */
+/** @} */
+
+/**
+ * Number of CQE task slots and transfer descriptors per task. With 64KB per
+ * transfer descriptor one CQE task moves up to 512KB.
+ */
+#define XSDPS_CQE_NUM_SLOTS		32U
+#define XSDPS_CQE_DESC_PER_TASK		8U
+
+/**
+ * Request completion callback. Called from XSdPs_IntrHandler with the tag of
+ * the completed request and XST_SUCCESS or XST_FAILURE.
+ */
+typedef void (*XSdPs_ReqHandler)(void *CallBackRef, u32 Tag, s32 Status);
+
+/**
+ * Asynchronous transfer request, see XSdPs_SubmitRequest.
+ */
+typedef struct {
+	u32 Arg;		/**< Card address, as for XSdPs_ReadPolled */
+	u32 BlkCnt;		/**< Number of blocks */
+	u8 *Buff;		/**< DMA buffer */
+	u8 Dir;			/**< XSDPS_REQ_READ or XSDPS_REQ_WRITE */
+	u32 Tag;		/**< User tag passed back to the handler */
+	XSdPs_ReqHandler Handler;	/**< Completion callback, may be NULL */
+	void *CallBackRef;	/**< Callback reference for the handler */
+} XSdPs_Request;
+
+/**
+ * CQE task slot, 128-bit task descriptor followed by a 128-bit link
+ * descriptor pointing to the transfer descriptors of the slot.
+ */
+typedef struct {
+	u32 Task[4];		/**< Task descriptor */
+	u32 Link[4];		/**< Link descriptor */
+} XSdPs_CqeSlot;
+
+/**
+ * CQE 128-bit transfer descriptor.
+ */
+typedef struct {
+	u32 Attribute;		/**< Attributes and length */
+	u32 AddrLo;		/**< Lower 32 bits of the buffer address */
+	u32 AddrHi;		/**< Upper 32 bits of the buffer address */
+	u32 Reserved;		/**< Reserved */
+} XSdPs_CqeTransDesc;
+
+/**
+ * Command Queue Engine state. Allocated by the user and handed to
+ * XSdPs_CqeEnable. The descriptor memory is read by the controller, so the
+ * structure must not be placed in memory the SD DMA cannot reach.
+ */
+typedef struct {
+#ifdef __ICCARM__
+#pragma data_alignment = 1024
+	XSdPs_CqeSlot Slot[XSDPS_CQE_NUM_SLOTS];	/**< Task descriptor list */
+#pragma data_alignment = 32
+	XSdPs_CqeTransDesc TransDesc[XSDPS_CQE_NUM_SLOTS][XSDPS_CQE_DESC_PER_TASK];	/**< Transfer descriptors */
+#else
+	XSdPs_CqeSlot Slot[XSDPS_CQE_NUM_SLOTS] __attribute__ ((aligned(1024)));	/**< Task descriptor list */
+	XSdPs_CqeTransDesc TransDesc[XSDPS_CQE_NUM_SLOTS][XSDPS_CQE_DESC_PER_TASK] __attribute__ ((aligned(32)));	/**< Transfer descriptors */
+#endif
+	XSdPs_Request Req[XSDPS_CQE_NUM_SLOTS];	/**< Request of each slot */
+	u32 Depth;		/**< Usable slots, min of host and device depth */
+	u32 Pending;		/**< Bitmask of slots in flight */
+	u32 Failed;		/**< Bitmask of failed slots, cleared by
+				     XSdPs_CqeRecover */
+} XSdPs_Cqe;
+
 /**
  * The XSdPs driver instance data. The user is required to allocate a
  * variable of this type for every SD device in the system. A pointer
@@ -269,6 +347,12 @@ typedef struct {
 	u8  IsBusy;			/**< Busy Flag*/
 	u32 BlkSize;		/**< Block Size*/
 	u8  IsTuningDone;	/**< Flag to indicate HS200 tuning complete */
+	XSdPs_Request CurReq;	/**< Request in flight in interrupt mode */
+	XSdPs_Request *ReqQueue;	/**< Software queue of pending requests */
+	u32 ReqQueueDepth;	/**< Number of entries in ReqQueue */
+	u32 ReqHead;		/**< Oldest pending request in ReqQueue */
+	u32 ReqCount;		/**< Number of pending requests in ReqQueue */
+	XSdPs_Cqe *CqePtr;	/**< CQE state, NULL when CQE is not enabled */
 #ifdef __ICCARM__
 #pragma data_alignment = 32
 	XSdPs_Adma2Descriptor32 Adma2_DescrTbl32[32];		/**< ADMA descriptor table 32 Bit */
@@ -341,6 +425,16 @@ s32 XSdPs_StartWriteTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_CheckWriteTransfer(XSdPs *InstancePtr);
 s32 XSdPs_Erase(XSdPs *InstancePtr, u32 StartAddr, u32 EndAddr);
 s32 XSdPs_Sanitize(XSdPs *InstancePtr);
+void XSdPs_SetRequestQueue(XSdPs *InstancePtr, XSdPs_Request *QueuePtr,
+			   u32 Depth);
+s32 XSdPs_SubmitRequest(XSdPs *InstancePtr, const XSdPs_Request *ReqPtr);
+u32 XSdPs_GetPendingRequests(const XSdPs *InstancePtr);
+void XSdPs_IntrHandler(void *CallBackRef);
+#ifdef VERSAL_NET
+s32 XSdPs_CqeEnable(XSdPs *InstancePtr, XSdPs_Cqe *CqePtr);
+s32 XSdPs_CqeDisable(XSdPs *InstancePtr);
+s32 XSdPs_CqeRecover(XSdPs *InstancePtr);
+#endif
 
 #ifdef __cplusplus
 }
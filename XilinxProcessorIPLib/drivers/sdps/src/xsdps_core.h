@@ -28,6 +28,7 @@
 * 4.0   sk     02/25/22 Add support for eMMC5.1.
 * 4.1   sa     01/06/23 Include xil_util.h in this file.
 * 4.2   ap     08/09/23 Add XSdPs_SetTapDelay APIs.
+* 4.4   mb     10/16/26 Add CQE submit and interrupt handling APIs.
 * </pre>
 *
 ******************************************************************************/
@@ -117,6 +118,8 @@ void XSdPs_SetTapDelay_DDR50(XSdPs *InstancePtr);
 void XSdPs_SetTapDelay_SDR25(XSdPs *InstancePtr);
 #ifdef VERSAL_NET
 u32 XSdPs_Select_HS400(XSdPs *InstancePtr);
+s32 XSdPs_CqeSubmit(XSdPs *InstancePtr, const XSdPs_Request *ReqPtr);
+void XSdPs_CqeIntrHandler(XSdPs *InstancePtr);
 #endif
 
 #if defined (__aarch64__) && (EL1_NONSECURE == 1)
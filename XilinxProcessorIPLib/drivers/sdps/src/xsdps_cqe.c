@@ -0,0 +1,548 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_cqe.c
+* @addtogroup sdps_api SDPS APIs
+* @{
+*
+* The xsdps_cqe.c file contains the eMMC 5.1 Command Queue Engine (CQE)
+* support of the Versal Net eMMC controller. Once enabled, requests
+* submitted through XSdPs_SubmitRequest are placed in free task slots and
+* rung on the CQE doorbell, the controller then queues them in the device
+* and reports each completed task through XSdPs_IntrHandler. Tasks that
+* fail are not cleared from the interrupt handler, since halting the CQE has
+* to be polled. They are cleared and reported by XSdPs_CqeRecover, which
+* the user calls from task context.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.4   mb     10/16/26 First release
+*       mb     10/16/26 Discard failed tasks with CMD48 and reset the CMD and
+*                       DAT lines before resuming the CQE
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps_core.h"
+
+#ifdef VERSAL_NET
+/************************** Constant Definitions *****************************/
+#define XSDPS_CQE_HALT_TIMEOUT		1000000U	/**< Halt poll count */
+#define XSDPS_CQE_MAX_BLK_CNT		((XSDPS_CQE_DESC_PER_TASK * \
+					  XSDPS_DESC_MAX_LENGTH) / \
+					 XSDPS_BLK_SIZE_512_MASK)	/**< Max
+							blocks per task */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XSdPs_CqeReadReg(InstancePtr, RegOffset) \
+	XSdPs_ReadReg((InstancePtr)->Config.BaseAddress, \
+		      XSDPS_CQE_BASE_OFFSET + (RegOffset))
+
+#define XSdPs_CqeWriteReg(InstancePtr, RegOffset, Data) \
+	XSdPs_WriteReg((InstancePtr)->Config.BaseAddress, \
+		       XSDPS_CQE_BASE_OFFSET + (RegOffset), (Data))
+
+/************************** Function Prototypes ******************************/
+static u32 XSdPs_CqeClearTasks(XSdPs *InstancePtr, u32 TaskMask);
+
+/*****************************************************************************/
+/**
+* @brief
+* Enables the Command Queue Engine. CMDQ mode is enabled in the eMMC device,
+* the task descriptor list in CqePtr is initialized and handed to the
+* controller. From then on XSdPs_SubmitRequest uses the CQE.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	CqePtr Pointer to the CQE state, owned by the driver until
+* 		XSdPs_CqeDisable is called.
+*
+* @return
+* 		- XST_SUCCESS if CQE was enabled
+* 		- XST_NO_FEATURE if the controller has no CQE or does not
+* 		transfer in 64-bit ADMA2 mode
+* 		- XST_FAILURE if the device is not an eMMC with CMDQ support or
+* 		a transfer is in progress
+*
+******************************************************************************/
+s32 XSdPs_CqeEnable(XSdPs *InstancePtr, XSdPs_Cqe *CqePtr)
+{
+	s32 Status;
+	u32 Slot;
+	u32 DevDepth;
+	u8 DmaMode;
+	u64 Addr;
+#ifdef __ICCARM__
+#pragma data_alignment = 32
+	static u8 ExtCsd[512];
+#else
+	static u8 ExtCsd[512] __attribute__ ((aligned(32)));
+#endif
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(CqePtr != NULL);
+
+	if ((InstancePtr->CardType != XSDPS_CHIP_EMMC) ||
+	    (InstancePtr->IsBusy == TRUE) || (InstancePtr->CqePtr != NULL)) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/* A controller without CQE reads 0 from the CQ version and capabilities */
+	if ((XSdPs_CqeReadReg(InstancePtr, XSDPS_CQ_VER_OFFSET) == 0U) ||
+	    ((XSdPs_CqeReadReg(InstancePtr, XSDPS_CQ_CAP_OFFSET) &
+	      XSDPS_CQ_CAP_ITCFVAL_MASK) == 0U)) {
+		Status = XST_NO_FEATURE;
+		goto RETURN_PATH;
+	}
+
+	/* The task and transfer descriptors carry 64-bit addresses */
+	DmaMode = XSdPs_ReadReg8(InstancePtr->Config.BaseAddress,
+				 XSDPS_HOST_CTRL1_OFFSET) & XSDPS_HC_DMA_MASK;
+	if (((InstancePtr->Host_Caps & XSDPS_CAP_ADMA2_MASK) == 0U) ||
+	    ((InstancePtr->Host_Caps & XSDPS_CAP_SYS_BUS_64_MASK) == 0U) ||
+	    (DmaMode != XSDPS_HC_DMA_ADMA2_64_MASK)) {
+		Status = XST_NO_FEATURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_Get_Mmc_ExtCsd(InstancePtr, ExtCsd);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if ((ExtCsd[EXT_CSD_CMDQ_SUPPORT_BYTE] & EXT_CSD_CMDQ_SUPPORTED) == 0U) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+	DevDepth = ((u32)ExtCsd[EXT_CSD_CMDQ_DEPTH_BYTE] &
+		    EXT_CSD_CMDQ_DEPTH_MASK) + 1U;
+
+	/* Tasks are always 512 byte blocks */
+	Status = XSdPs_SetBlkSize(InstancePtr, (u16)XSDPS_BLK_SIZE_512_MASK);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_Set_Mmc_ExtCsd(InstancePtr, XSDPS_MMC_CMDQ_EN_ARG);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/* Every slot links to its own transfer descriptor list */
+	for (Slot = 0U; Slot < XSDPS_CQE_NUM_SLOTS; Slot++) {
+		Addr = (u64)(UINTPTR)&CqePtr->TransDesc[Slot][0];
+		CqePtr->Slot[Slot].Task[0] = 0U;
+		CqePtr->Slot[Slot].Task[1] = 0U;
+		CqePtr->Slot[Slot].Task[2] = 0U;
+		CqePtr->Slot[Slot].Task[3] = 0U;
+		CqePtr->Slot[Slot].Link[0] = XSDPS_CQ_DESC_VALID |
+					     XSDPS_CQ_DESC_ACT_LINK;
+		CqePtr->Slot[Slot].Link[1] = (u32)Addr;
+		CqePtr->Slot[Slot].Link[2] = (u32)(Addr >> 32U);
+		CqePtr->Slot[Slot].Link[3] = 0U;
+	}
+	CqePtr->Depth = (DevDepth < XSDPS_CQE_NUM_SLOTS) ? DevDepth :
+			XSDPS_CQE_NUM_SLOTS;
+	CqePtr->Pending = 0U;
+	CqePtr->Failed = 0U;
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)&CqePtr->Slot[0],
+				     (INTPTR)sizeof(CqePtr->Slot));
+	}
+
+	Addr = (u64)(UINTPTR)&CqePtr->Slot[0];
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_CFG_OFFSET, 0U);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_TDLBA_OFFSET, (u32)Addr);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_TDLBAU_OFFSET,
+			  (u32)(Addr >> 32U));
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_SSC2_OFFSET,
+			  InstancePtr->RelCardAddr >> XSDPS_CQ_SSC2_RCA_SHIFT);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_IS_OFFSET,
+			  XSDPS_CQ_IS_ALL_MASK);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_ISTE_OFFSET,
+			  XSDPS_CQ_IS_ALL_MASK);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_ISGE_OFFSET,
+			  XSDPS_CQ_IS_ALL_MASK);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_CFG_OFFSET,
+			  XSDPS_CQ_CFG_ENABLE_MASK | XSDPS_CQ_CFG_TDESC_128_MASK);
+
+	InstancePtr->CqePtr = CqePtr;
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Disables the Command Queue Engine and CMDQ mode of the eMMC device, so
+* that polled and legacy requests can be used again.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if CQE was disabled
+* 		- XST_FAILURE if tasks are still pending or CMDQ mode could
+* 		not be disabled in the device
+*
+******************************************************************************/
+s32 XSdPs_CqeDisable(XSdPs *InstancePtr)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((InstancePtr->CqePtr == NULL) ||
+	    (InstancePtr->CqePtr->Pending != 0U)) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_ISGE_OFFSET, 0U);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_CFG_OFFSET, 0U);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_NORM_INTR_SIG_EN_OFFSET, 0U);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_ERR_INTR_SIG_EN_OFFSET, 0U);
+	InstancePtr->CqePtr = NULL;
+
+	Status = XSdPs_Set_Mmc_ExtCsd(InstancePtr, XSDPS_MMC_CMDQ_DIS_ARG);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Places a request in a free CQE task slot and rings its doorbell.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Request to be queued.
+*
+* @return
+* 		- XST_SUCCESS if the task was queued
+* 		- XST_DEVICE_BUSY if all task slots are in use or a failed
+* 		task waits for XSdPs_CqeRecover
+* 		- XST_FAILURE if the request is larger than one task
+*
+******************************************************************************/
+s32 XSdPs_CqeSubmit(XSdPs *InstancePtr, const XSdPs_Request *ReqPtr)
+{
+	XSdPs_Cqe *CqePtr = InstancePtr->CqePtr;
+	XSdPs_CqeTransDesc *DescPtr;
+	u32 Free;
+	u32 Slot = 0U;
+	u32 Remaining;
+	u32 Len;
+	u32 Desc = 0U;
+	u64 Addr;
+	s32 Status;
+
+	if (ReqPtr->BlkCnt > XSDPS_CQE_MAX_BLK_CNT) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (CqePtr->Depth < XSDPS_CQE_NUM_SLOTS) {
+		Free = ~CqePtr->Pending & ((1U << CqePtr->Depth) - 1U);
+	} else {
+		Free = ~CqePtr->Pending;
+	}
+	if ((Free == 0U) || (CqePtr->Failed != 0U)) {
+		Status = XST_DEVICE_BUSY;
+		goto RETURN_PATH;
+	}
+	while ((Free & (1U << Slot)) == 0U) {
+		Slot++;
+	}
+
+	/* Transfer descriptors, 64KB each */
+	Addr = (u64)(UINTPTR)ReqPtr->Buff;
+	Remaining = ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+	while (Remaining > 0U) {
+		Len = (Remaining > XSDPS_DESC_MAX_LENGTH) ?
+		      XSDPS_DESC_MAX_LENGTH : Remaining;
+		Remaining -= Len;
+		DescPtr = &CqePtr->TransDesc[Slot][Desc];
+		/* A length field of 0 stands for 64KB */
+		DescPtr->Attribute = XSDPS_CQ_DESC_VALID | XSDPS_CQ_DESC_ACT_TRAN |
+				     ((Len & 0xFFFFU) << XSDPS_CQ_DESC_LEN_SHIFT);
+		if (Remaining == 0U) {
+			DescPtr->Attribute |= XSDPS_CQ_DESC_END;
+		}
+		DescPtr->AddrLo = (u32)Addr;
+		DescPtr->AddrHi = (u32)(Addr >> 32U);
+		DescPtr->Reserved = 0U;
+		Addr += Len;
+		Desc++;
+	}
+
+	CqePtr->Slot[Slot].Task[0] = XSDPS_CQ_DESC_VALID | XSDPS_CQ_DESC_END |
+				     XSDPS_CQ_DESC_INT | XSDPS_CQ_DESC_ACT_TASK |
+				     (ReqPtr->BlkCnt << XSDPS_CQ_DESC_LEN_SHIFT);
+	if (ReqPtr->Dir == XSDPS_REQ_READ) {
+		CqePtr->Slot[Slot].Task[0] |= XSDPS_CQ_DESC_DATA_DIR_READ;
+	}
+	CqePtr->Slot[Slot].Task[1] = ReqPtr->Arg;
+	CqePtr->Req[Slot] = *ReqPtr;
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		if (ReqPtr->Dir == XSDPS_REQ_READ) {
+			Xil_DCacheInvalidateRange((INTPTR)ReqPtr->Buff,
+						  (INTPTR)ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+		} else {
+			Xil_DCacheFlushRange((INTPTR)ReqPtr->Buff,
+					     (INTPTR)ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+		}
+		Xil_DCacheFlushRange((INTPTR)&CqePtr->TransDesc[Slot][0],
+				     (INTPTR)sizeof(CqePtr->TransDesc[Slot]));
+		Xil_DCacheFlushRange((INTPTR)&CqePtr->Slot[Slot],
+				     (INTPTR)sizeof(CqePtr->Slot[Slot]));
+	}
+
+	CqePtr->Pending |= (1U << Slot);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_TDBR_OFFSET, (1U << Slot));
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Recovers the given tasks with the eMMC 5.1 CQ error recovery sequence: the
+* CQE is halted, the CMD and DAT lines of the host are reset, each task is
+* discarded in the device with CMD48 and cleared in the CQE, then the queue
+* is resumed.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	TaskMask Bitmask of the task slots to be cleared.
+*
+* @return	XST_SUCCESS if the tasks were cleared, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static u32 XSdPs_CqeClearTasks(XSdPs *InstancePtr, u32 TaskMask)
+{
+	u32 Status;
+	u32 Slot;
+
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_CTL_OFFSET,
+			  XSDPS_CQ_CTL_HALT_MASK);
+	Status = Xil_WaitForEvent(InstancePtr->Config.BaseAddress +
+				  XSDPS_CQE_BASE_OFFSET + XSDPS_CQ_CTL_OFFSET,
+				  XSDPS_CQ_CTL_HALT_MASK, XSDPS_CQ_CTL_HALT_MASK,
+				  XSDPS_CQE_HALT_TIMEOUT);
+	if (Status != (u32)XST_SUCCESS) {
+		goto RESUME;
+	}
+
+	/* The failed command or transfer may have left the lines busy */
+	Status = (u32)XSdPs_Reset(InstancePtr, XSDPS_SWRST_CMD_LINE_MASK |
+				  XSDPS_SWRST_DAT_LINE_MASK);
+	if (Status != (u32)XST_SUCCESS) {
+		goto RESUME;
+	}
+
+	/* The device keeps a queued task until it is discarded */
+	for (Slot = 0U; Slot < XSDPS_CQE_NUM_SLOTS; Slot++) {
+		if ((TaskMask & (1U << Slot)) == 0U) {
+			continue;
+		}
+		Status = (u32)XSdPs_CmdTransfer(InstancePtr, CMD48,
+						(Slot << XSDPS_CMD48_TASK_ID_SHIFT) |
+						XSDPS_CMD48_DISCARD_TASK, 0U);
+		if (Status == (u32)XST_SUCCESS) {
+			Status = (u32)XSdps_CheckTransferDone(InstancePtr);
+		}
+		if (Status != (u32)XST_SUCCESS) {
+			Status = (u32)XST_FAILURE;
+			goto RESUME;
+		}
+	}
+
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_TCLR_OFFSET, TaskMask);
+
+RESUME:
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_CTL_OFFSET, 0U);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Clears the CQE tasks that failed and completes their requests with
+* XST_FAILURE. Failed tasks block new submissions until they are recovered.
+* Halting the CQE is polled, so this must be called from task context, for
+* example while waiting for XSdPs_GetPendingRequests to drop.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return
+* 		- XST_SUCCESS if there was no failed task or all failed tasks
+* 		were cleared
+* 		- XST_FAILURE if CQE is not enabled or the failed tasks could
+* 		not be discarded, they are then kept for another attempt
+*
+* @note		The request handlers of the failed tasks are invoked from
+* 		this function, not from XSdPs_IntrHandler.
+*
+******************************************************************************/
+s32 XSdPs_CqeRecover(XSdPs *InstancePtr)
+{
+	XSdPs_Cqe *CqePtr;
+	XSdPs_Request Req;
+	u32 Failed;
+	u32 Slot;
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	CqePtr = InstancePtr->CqePtr;
+	if (CqePtr == NULL) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+	if (CqePtr->Failed == 0U) {
+		Status = XST_SUCCESS;
+		goto RETURN_PATH;
+	}
+
+	/* Keep the interrupt handler out while the task state is updated */
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_NORM_INTR_SIG_EN_OFFSET, 0U);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_ERR_INTR_SIG_EN_OFFSET, 0U);
+
+	Failed = CqePtr->Failed;
+	Status = (s32)XSdPs_CqeClearTasks(InstancePtr, Failed);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		Failed = 0U;
+	}
+	CqePtr->Failed &= ~Failed;
+
+	/* Slots are freed one at a time, a handler may submit a new request */
+	for (Slot = 0U; Failed != 0U; Slot++) {
+		if ((Failed & (1U << Slot)) == 0U) {
+			continue;
+		}
+		Failed &= ~(1U << Slot);
+		Req = CqePtr->Req[Slot];
+		CqePtr->Pending &= ~(1U << Slot);
+		if (Req.Handler != NULL) {
+			Req.Handler(Req.CallBackRef, Req.Tag, XST_FAILURE);
+		}
+	}
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_NORM_INTR_SIG_EN_OFFSET,
+			 (u16)XSDPS_INTR_CQE_MASK);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_ERR_INTR_SIG_EN_OFFSET,
+			 (u16)XSDPS_ERROR_INTR_ALL_MASK);
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* CQE part of XSdPs_IntrHandler. Completes every task reported in the task
+* completion notification register. The task that caused a response or
+* data error is marked failed, it is cleared and reported by
+* XSdPs_CqeRecover.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_CqeIntrHandler(XSdPs *InstancePtr)
+{
+	XSdPs_Cqe *CqePtr = InstancePtr->CqePtr;
+	XSdPs_Request *ReqPtr;
+	u16 NormSts;
+	u32 CqIs;
+	u32 TaskErr;
+	u32 Done = 0U;
+	u32 Failed = 0U;
+	u32 Slot;
+
+	NormSts = XSdPs_ReadReg16(InstancePtr->Config.BaseAddress,
+				  XSDPS_NORM_INTR_STS_OFFSET);
+	CqIs = XSdPs_CqeReadReg(InstancePtr, XSDPS_CQ_IS_OFFSET);
+	XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_IS_OFFSET, CqIs);
+
+	if (((NormSts & XSDPS_INTR_ERR_MASK) != 0U) ||
+	    ((CqIs & XSDPS_CQ_IS_RED_MASK) != 0U)) {
+		TaskErr = XSdPs_CqeReadReg(InstancePtr, XSDPS_CQ_TERRI_OFFSET);
+		if ((TaskErr & XSDPS_CQ_TERRI_CMD_VALID_MASK) != 0U) {
+			Failed |= 1U << ((TaskErr & XSDPS_CQ_TERRI_CMD_TASK_MASK) >>
+					 XSDPS_CQ_TERRI_CMD_TASK_SHIFT);
+		}
+		if ((TaskErr & XSDPS_CQ_TERRI_DAT_VALID_MASK) != 0U) {
+			Failed |= 1U << ((TaskErr & XSDPS_CQ_TERRI_DAT_TASK_MASK) >>
+					 XSDPS_CQ_TERRI_DAT_TASK_SHIFT);
+		}
+		/* Write to clear error bits */
+		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+				 XSDPS_ERR_INTR_STS_OFFSET,
+				 XSDPS_ERROR_INTR_ALL_MASK);
+		CqePtr->Failed |= Failed & CqePtr->Pending;
+	}
+
+	if ((CqIs & XSDPS_CQ_IS_TCC_MASK) != 0U) {
+		Done = XSdPs_CqeReadReg(InstancePtr, XSDPS_CQ_TCN_OFFSET);
+		XSdPs_CqeWriteReg(InstancePtr, XSDPS_CQ_TCN_OFFSET, Done);
+	}
+
+	Done &= CqePtr->Pending & ~CqePtr->Failed;
+	CqePtr->Pending &= ~Done;
+
+	for (Slot = 0U; Done != 0U; Slot++) {
+		if ((Done & (1U << Slot)) == 0U) {
+			continue;
+		}
+		Done &= ~(1U << Slot);
+		ReqPtr = &CqePtr->Req[Slot];
+
+		if ((ReqPtr->Dir == XSDPS_REQ_READ) &&
+		    (InstancePtr->Config.IsCacheCoherent == 0U)) {
+			Xil_DCacheInvalidateRange((INTPTR)ReqPtr->Buff,
+						  (INTPTR)ReqPtr->BlkCnt * XSDPS_BLK_SIZE_512_MASK);
+		}
+		if (ReqPtr->Handler != NULL) {
+			ReqPtr->Handler(ReqPtr->CallBackRef, ReqPtr->Tag,
+					XST_SUCCESS);
+		}
+	}
+}
+#endif
+/** @} */
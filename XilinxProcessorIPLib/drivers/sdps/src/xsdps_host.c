@@ -41,6 +41,7 @@
 * 	sa     01/25/23 Use instance structure to store DMA descriptor tables.
 * 4.2   ap     08/09/23 Restructured XSdPs_FrameCmd API
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
+* 4.4   mb     10/16/26 Frame CMD48 with R1b response.
 * </pre>
 *
 ******************************************************************************/
@@ -1749,6 +1750,7 @@ u32 XSdPs_FrameCmd(XSdPs *InstancePtr, u32 Cmd)
 			break;
 		case CMD5:
 		case CMD38:
+		case CMD48:
 			RetVal |= RESP_R1B;
 			break;
 		case CMD6:
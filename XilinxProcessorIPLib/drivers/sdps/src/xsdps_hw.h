@@ -48,6 +48,9 @@
 * 4.2   ro     06/12/23 Added support for system device-tree flow.
 * 4.3   ap     11/29/23 Add support for Sanitize feature.
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
+* 4.4   mb     10/16/26 Add Command Queue Engine register map and eMMC CMDQ
+*                       EXT_CSD fields.
+*       mb     10/16/26 Add CMD48 task management command.
 *
 * </pre>
 *
@@ -281,6 +284,8 @@ extern "C" {
 							Interrupt */
 #define XSDPS_INTR_BOOT_TERM_MASK	0x00004000U /**< Boot Terminate
 							Interrupt */
+#define XSDPS_INTR_CQE_MASK		0x00004000U /**< Command Queuing
+							Event (eMMC 5.1) */
 #define XSDPS_INTR_ERR_MASK		0x00008000U /**< Error Interrupt */
 #define XSDPS_NORM_INTR_ALL_MASK	0x0000FFFFU
 
@@ -707,6 +712,7 @@ extern "C" {
 #define CMD35	 0x2300U
 #define CMD36	 0x2400U
 #define CMD38	 0x2600U
+#define CMD48	 0x3000U
 #define CMD41	 0x2900U
 #define ACMD41	 (XSDPS_APP_CMD_PREFIX + 0x2900U)
 #define ACMD42	 (XSDPS_APP_CMD_PREFIX + 0x2A00U)
@@ -902,6 +908,99 @@ extern "C" {
 #define CSD_SPEC_VER_MASK		0x3C0000U
 #define READ_BLK_LEN_MASK		0x00000F00U
 #define C_SIZE_MULT_MASK		0x00000380U
+/** @} */
+
+/** @name Command Queue Engine Register Map
+ *
+ * Register offsets of the eMMC 5.1 Command Queue Host Controller (CQHCI)
+ * from the CQE base. The CQE of the Versal Net eMMC controller is located
+ * at XSDPS_CQE_BASE_OFFSET from the SD base address.
+ * @{
+ */
+#define XSDPS_CQE_BASE_OFFSET		0x200U	/**< CQE register base */
+#define XSDPS_CQ_VER_OFFSET		0x00U	/**< CQ Version */
+#define XSDPS_CQ_CAP_OFFSET		0x04U	/**< CQ Capabilities */
+#define XSDPS_CQ_CFG_OFFSET		0x08U	/**< CQ Configuration */
+#define XSDPS_CQ_CTL_OFFSET		0x0CU	/**< CQ Control */
+#define XSDPS_CQ_IS_OFFSET		0x10U	/**< CQ Interrupt Status */
+#define XSDPS_CQ_ISTE_OFFSET		0x14U	/**< CQ Interrupt Status
+							Enable */
+#define XSDPS_CQ_ISGE_OFFSET		0x18U	/**< CQ Interrupt Signal
+							Enable */
+#define XSDPS_CQ_IC_OFFSET		0x1CU	/**< CQ Interrupt Coalescing */
+#define XSDPS_CQ_TDLBA_OFFSET		0x20U	/**< Task Descriptor List
+							Base Address */
+#define XSDPS_CQ_TDLBAU_OFFSET		0x24U	/**< Task Descriptor List
+							Base Address Upper */
+#define XSDPS_CQ_TDBR_OFFSET		0x28U	/**< Task Doorbell */
+#define XSDPS_CQ_TCN_OFFSET		0x2CU	/**< Task Completion
+							Notification */
+#define XSDPS_CQ_DQS_OFFSET		0x30U	/**< Device Queue Status */
+#define XSDPS_CQ_DPT_OFFSET		0x34U	/**< Device Pending Tasks */
+#define XSDPS_CQ_TCLR_OFFSET		0x38U	/**< Task Clear */
+#define XSDPS_CQ_SSC1_OFFSET		0x40U	/**< Send Status Config 1 */
+#define XSDPS_CQ_SSC2_OFFSET		0x44U	/**< Send Status Config 2 */
+#define XSDPS_CQ_CRDCT_OFFSET		0x48U	/**< Command Response for
+							Direct-Command Task */
+#define XSDPS_CQ_RMEM_OFFSET		0x50U	/**< Response Mode Error
+							Mask */
+#define XSDPS_CQ_TERRI_OFFSET		0x54U	/**< Task Error Information */
+#define XSDPS_CQ_CRI_OFFSET		0x58U	/**< Command Response Index */
+#define XSDPS_CQ_CRA_OFFSET		0x5CU	/**< Command Response
+							Argument */
+/** @} */
+
+/** @name Command Queue Engine Register Bits
+ * @{
+ */
+#define XSDPS_CQ_CAP_ITCFVAL_MASK	0x000003FFU /**< Internal timer clock
+							frequency value */
+#define XSDPS_CQ_CFG_ENABLE_MASK	0x00000001U /**< CQE enable */
+#define XSDPS_CQ_CFG_TDESC_128_MASK	0x00000100U /**< 128-bit task
+							descriptors */
+#define XSDPS_CQ_CFG_DCMD_MASK		0x00001000U /**< Direct command
+							slot enable */
+#define XSDPS_CQ_CTL_HALT_MASK		0x00000001U /**< Halt */
+#define XSDPS_CQ_CTL_CLR_ALL_MASK	0x00000100U /**< Clear all tasks */
+#define XSDPS_CQ_IS_HAC_MASK		0x00000001U /**< Halt complete */
+#define XSDPS_CQ_IS_TCC_MASK		0x00000002U /**< Task complete */
+#define XSDPS_CQ_IS_RED_MASK		0x00000004U /**< Response error */
+#define XSDPS_CQ_IS_TCL_MASK		0x00000008U /**< Task cleared */
+#define XSDPS_CQ_IS_ALL_MASK		0x0000000FU /**< All handled events */
+#define XSDPS_CQ_TERRI_CMD_TASK_MASK	0x00001F00U /**< Command error task */
+#define XSDPS_CQ_TERRI_CMD_TASK_SHIFT	8U
+#define XSDPS_CQ_TERRI_CMD_VALID_MASK	0x00008000U /**< Command error
+							valid */
+#define XSDPS_CQ_TERRI_DAT_TASK_MASK	0x1F000000U /**< Data error task */
+#define XSDPS_CQ_TERRI_DAT_TASK_SHIFT	24U
+#define XSDPS_CQ_TERRI_DAT_VALID_MASK	0x80000000U /**< Data error valid */
+#define XSDPS_CQ_SSC2_RCA_SHIFT		16U	/**< RCA position in the
+							stored card address */
+/** @} */
+
+/** @name Command Queue Engine Descriptor Fields
+ * @{
+ */
+#define XSDPS_CQ_DESC_VALID		0x00000001U /**< Valid */
+#define XSDPS_CQ_DESC_END		0x00000002U /**< Last descriptor */
+#define XSDPS_CQ_DESC_INT		0x00000004U /**< Interrupt on completion */
+#define XSDPS_CQ_DESC_ACT_TASK		0x00000028U /**< Task descriptor */
+#define XSDPS_CQ_DESC_ACT_TRAN		0x00000020U /**< Transfer descriptor */
+#define XSDPS_CQ_DESC_ACT_LINK		0x00000030U /**< Link descriptor */
+#define XSDPS_CQ_DESC_DATA_DIR_READ	0x00001000U /**< Device to host */
+#define XSDPS_CQ_DESC_LEN_SHIFT		16U	/**< Block count/length */
+/** @} */
+
+/** @name eMMC CMDQ Task Management (CMD48) Argument
+ * @{
+ */
+#define XSDPS_CMD48_DISCARD_TASK	0x00000002U /**< Discard one task */
+#define XSDPS_CMD48_TASK_ID_SHIFT	16U	/**< Task ID of the command */
+/** @} */
+
+/** @name CSD fields
+ * @{
+ */
 #define C_SIZE_LOWER_MASK		0xFFC00000U
 #define C_SIZE_UPPER_MASK		0x00000003U
 #define CSD_STRUCT_MASK			0x00C00000U
@@ -987,6 +1086,12 @@ extern "C" {
 #define EXT_CSD_RST_N_FUN_PERM_EN	1U	/* RST_n signal is permanently enabled */
 #define EXT_CSD_RST_N_FUN_PERM_DIS	2U	/* RST_n signal is permanently disabled */
 
+#define EXT_CSD_CMDQ_MODE_EN_BYTE	15U	/**< Command queue enable */
+#define EXT_CSD_CMDQ_DEPTH_BYTE		307U	/**< Command queue depth */
+#define EXT_CSD_CMDQ_SUPPORT_BYTE	308U	/**< Command queue support */
+#define EXT_CSD_CMDQ_DEPTH_MASK		0x1FU	/**< Queue depth minus one */
+#define EXT_CSD_CMDQ_SUPPORTED		0x1U	/**< CMDQ supported by device */
+
 #define XSDPS_EXT_CSD_CMD_SET		0U
 #define XSDPS_EXT_CSD_SET_BITS		1U
 #define XSDPS_EXT_CSD_CLR_BITS		2U
@@ -1028,6 +1133,13 @@ extern "C" {
 	| ((u32)EXT_CSD_BUS_WIDTH_BYTE << 16) \
 	| ((u32)EXT_CSD_BUS_WIDTH_8_BIT << 8))
 
+#define XSDPS_MMC_CMDQ_EN_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
+	| ((u32)EXT_CSD_CMDQ_MODE_EN_BYTE << 16) \
+	| ((u32)1U << 8))
+
+#define XSDPS_MMC_CMDQ_DIS_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
+	| ((u32)EXT_CSD_CMDQ_MODE_EN_BYTE << 16))
+
 #define XSDPS_MMC_DDR_4_BIT_BUS_ARG		(((u32)XSDPS_EXT_CSD_WRITE_BYTE << 24) \
 	| ((u32)EXT_CSD_BUS_WIDTH_BYTE << 16) \
 	| ((u32)EXT_CSD_BUS_WIDTH_DDR_4_BIT << 8))
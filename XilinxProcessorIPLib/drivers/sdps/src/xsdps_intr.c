@@ -0,0 +1,366 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_intr.c
+* @addtogroup sdps_api SDPS APIs
+* @{
+*
+* The xsdps_intr.c file contains the interrupt driven request API. A request
+* is started with XSdPs_SubmitRequest and completed from XSdPs_IntrHandler,
+* which invokes the request callback. Requests submitted while a transfer is
+* in flight are held in an optional software queue and started back to back
+* from the interrupt handler. When the eMMC Command Queue Engine is enabled
+* (XSdPs_CqeEnable) requests are handed to the CQE instead, so that several
+* tagged requests are in flight at once.
+*
+* The user must connect XSdPs_IntrHandler to the SD interrupt with the
+* instance pointer as callback reference.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.4   mb     10/16/26 First release
+*       mb     10/16/26 Reset the CMD and DAT lines after a failed transfer
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps_core.h"
+/************************** Constant Definitions *****************************/
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static s32 XSdPs_StartRequest(XSdPs *InstancePtr, const XSdPs_Request *ReqPtr);
+static void XSdPs_StartNextRequest(XSdPs *InstancePtr,
+				   const XSdPs_Request *DonePtr, s32 DoneStatus);
+static void XSdPs_SetTransferIntr(const XSdPs *InstancePtr, u8 Enable);
+
+/*****************************************************************************/
+/**
+* @brief
+* Enables or disables the transfer complete and error interrupt signals.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	Enable TRUE to enable the signals, FALSE to disable them.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_SetTransferIntr(const XSdPs *InstancePtr, u8 Enable)
+{
+	u16 NormMask = 0U;
+	u16 ErrMask = 0U;
+
+	if (Enable == (u8)TRUE) {
+		if (InstancePtr->CqePtr != NULL) {
+			NormMask = (u16)XSDPS_INTR_CQE_MASK;
+		} else {
+			NormMask = (u16)XSDPS_INTR_TC_MASK;
+		}
+		ErrMask = (u16)XSDPS_ERROR_INTR_ALL_MASK;
+	}
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_NORM_INTR_SIG_EN_OFFSET, NormMask);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_ERR_INTR_SIG_EN_OFFSET, ErrMask);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Issues the command of a request. Completion is reported by the interrupt
+* handler.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Request to be started.
+*
+* @return
+* 		- XST_SUCCESS if the transfer was started
+* 		- XST_FAILURE if the command could not be issued
+*
+******************************************************************************/
+static s32 XSdPs_StartRequest(XSdPs *InstancePtr, const XSdPs_Request *ReqPtr)
+{
+	s32 Status;
+
+	InstancePtr->CurReq = *ReqPtr;
+
+	if (ReqPtr->Dir == XSDPS_REQ_READ) {
+		Status = XSdPs_StartReadTransfer(InstancePtr, ReqPtr->Arg,
+						 ReqPtr->BlkCnt, ReqPtr->Buff);
+	} else {
+		Status = XSdPs_StartWriteTransfer(InstancePtr, ReqPtr->Arg,
+						  ReqPtr->BlkCnt, ReqPtr->Buff);
+	}
+
+	if (Status != XST_SUCCESS) {
+		InstancePtr->IsBusy = FALSE;
+		/* Bring the CMD and DAT line state machines back to idle */
+		(void)XSdPs_Reset(InstancePtr, XSDPS_SWRST_CMD_LINE_MASK |
+				  XSDPS_SWRST_DAT_LINE_MASK);
+		Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Starts the oldest queued request and reports the completed request.
+* Requests whose command cannot be issued are completed with XST_FAILURE
+* and the next one is tried. The completed request is always reported
+* first, so requests complete in submission order.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	DonePtr Request that has completed.
+* @param	DoneStatus Status to report for DonePtr.
+*
+* @return	None
+*
+* @note		A handler may submit a new request. The request is then
+* 		started once the controller is idle, the loop stops as soon
+* 		as a request is in flight.
+*
+******************************************************************************/
+static void XSdPs_StartNextRequest(XSdPs *InstancePtr,
+				   const XSdPs_Request *DonePtr, s32 DoneStatus)
+{
+	XSdPs_Request Req;
+	s32 Status;
+
+	while ((InstancePtr->IsBusy == FALSE) && (InstancePtr->ReqCount > 0U)) {
+		/* Copied, the queue entry may be reused by a handler */
+		Req = InstancePtr->ReqQueue[InstancePtr->ReqHead];
+		InstancePtr->ReqHead = (InstancePtr->ReqHead + 1U) %
+				       InstancePtr->ReqQueueDepth;
+		InstancePtr->ReqCount -= 1U;
+
+		Status = XSdPs_StartRequest(InstancePtr, &Req);
+		if (Status == XST_SUCCESS) {
+			break;
+		}
+
+		if ((DonePtr != NULL) && (DonePtr->Handler != NULL)) {
+			DonePtr->Handler(DonePtr->CallBackRef, DonePtr->Tag,
+					 DoneStatus);
+		}
+		DonePtr = NULL;
+		if (Req.Handler != NULL) {
+			Req.Handler(Req.CallBackRef, Req.Tag, XST_FAILURE);
+		}
+	}
+
+	if ((DonePtr != NULL) && (DonePtr->Handler != NULL)) {
+		DonePtr->Handler(DonePtr->CallBackRef, DonePtr->Tag, DoneStatus);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Sets the storage for the software request queue. Requests submitted while
+* a transfer is in progress are queued here instead of being rejected.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	QueuePtr Array of Depth requests, NULL to disable queueing.
+* @param	Depth Number of entries in QueuePtr.
+*
+* @return	None
+*
+* @note		Must be called while no request is pending.
+*
+******************************************************************************/
+void XSdPs_SetRequestQueue(XSdPs *InstancePtr, XSdPs_Request *QueuePtr,
+			   u32 Depth)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid((QueuePtr == NULL) || (Depth > 0U));
+
+	InstancePtr->ReqQueue = QueuePtr;
+	InstancePtr->ReqQueueDepth = (QueuePtr != NULL) ? Depth : 0U;
+	InstancePtr->ReqHead = 0U;
+	InstancePtr->ReqCount = 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Submits a read or write request without waiting for its completion. The
+* request is started right away if the controller is idle, queued otherwise.
+* The request handler is invoked from XSdPs_IntrHandler once the transfer is
+* done.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	ReqPtr Request to be submitted, copied by the driver.
+*
+* @return
+* 		- XST_SUCCESS if the request was started or queued
+* 		- XST_DEVICE_BUSY if no queue or CQE slot is free, or a failed
+* 		CQE task waits for XSdPs_CqeRecover
+* 		- XST_FAILURE if the command could not be issued
+*
+* @note		The write buffer must not be modified and the read buffer
+* 		must not be accessed until the handler is called.
+*
+******************************************************************************/
+s32 XSdPs_SubmitRequest(XSdPs *InstancePtr, const XSdPs_Request *ReqPtr)
+{
+	s32 Status;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr->Buff != NULL);
+	Xil_AssertNonvoid(ReqPtr->BlkCnt > 0U);
+
+	/* Keep the interrupt handler out while the queue is updated */
+	XSdPs_SetTransferIntr(InstancePtr, (u8)FALSE);
+
+#ifdef VERSAL_NET
+	if (InstancePtr->CqePtr != NULL) {
+		Status = XSdPs_CqeSubmit(InstancePtr, ReqPtr);
+		goto RETURN_PATH;
+	}
+#endif
+
+	if (InstancePtr->IsBusy == FALSE) {
+		Status = XSdPs_StartRequest(InstancePtr, ReqPtr);
+	} else if (InstancePtr->ReqCount < InstancePtr->ReqQueueDepth) {
+		Index = (InstancePtr->ReqHead + InstancePtr->ReqCount) %
+			InstancePtr->ReqQueueDepth;
+		InstancePtr->ReqQueue[Index] = *ReqPtr;
+		InstancePtr->ReqCount += 1U;
+		Status = XST_SUCCESS;
+	} else {
+		Status = XST_DEVICE_BUSY;
+	}
+
+#ifdef VERSAL_NET
+RETURN_PATH:
+#endif
+	if ((InstancePtr->IsBusy == TRUE) || (InstancePtr->CqePtr != NULL)) {
+		XSdPs_SetTransferIntr(InstancePtr, (u8)TRUE);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Returns the number of submitted requests that have not completed yet.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+*
+* @return	Number of requests in flight or queued.
+*
+* @note		With CQE, failed tasks stay pending until XSdPs_CqeRecover
+* 		is called.
+*
+******************************************************************************/
+u32 XSdPs_GetPendingRequests(const XSdPs *InstancePtr)
+{
+	u32 Count;
+#ifdef VERSAL_NET
+	u32 Pending;
+#endif
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+#ifdef VERSAL_NET
+	if (InstancePtr->CqePtr != NULL) {
+		Count = 0U;
+		Pending = InstancePtr->CqePtr->Pending;
+		while (Pending != 0U) {
+			Pending &= Pending - 1U;
+			Count += 1U;
+		}
+		goto RETURN_PATH;
+	}
+#endif
+
+	Count = InstancePtr->ReqCount;
+	if (InstancePtr->IsBusy == TRUE) {
+		Count += 1U;
+	}
+
+#ifdef VERSAL_NET
+RETURN_PATH:
+#endif
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Interrupt handler of the request API. Completes the request in flight,
+* starts the next queued request and then invokes the handler of the
+* completed request, so the bus is kept busy while the callback runs.
+* With CQE, failed tasks are left for XSdPs_CqeRecover.
+*
+* @param	CallBackRef Pointer to the XSdPs instance.
+*
+* @return	None
+*
+******************************************************************************/
+void XSdPs_IntrHandler(void *CallBackRef)
+{
+	XSdPs *InstancePtr = (XSdPs *)CallBackRef;
+	XSdPs_Request Done;
+	s32 Status;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+#ifdef VERSAL_NET
+	if (InstancePtr->CqePtr != NULL) {
+		XSdPs_CqeIntrHandler(InstancePtr);
+		goto RETURN_PATH;
+	}
+#endif
+
+	if (InstancePtr->IsBusy == FALSE) {
+		goto RETURN_PATH;
+	}
+
+	Status = XSdPs_CheckTransferComplete(InstancePtr);
+	if (Status == XST_DEVICE_BUSY) {
+		goto RETURN_PATH;
+	}
+	if (Status != XST_SUCCESS) {
+		InstancePtr->IsBusy = FALSE;
+		Status = XST_FAILURE;
+	}
+
+	Done = InstancePtr->CurReq;
+	if ((Status == XST_SUCCESS) && (Done.Dir == XSDPS_REQ_READ) &&
+	    (InstancePtr->Config.IsCacheCoherent == 0U)) {
+		Xil_DCacheInvalidateRange((INTPTR)Done.Buff,
+					  ((INTPTR)Done.BlkCnt * (INTPTR)InstancePtr->BlkSize));
+	}
+
+	XSdPs_SetTransferIntr(InstancePtr, (u8)FALSE);
+	XSdPs_StartNextRequest(InstancePtr, &Done, Status);
+	if (InstancePtr->IsBusy == TRUE) {
+		XSdPs_SetTransferIntr(InstancePtr, (u8)TRUE);
+	}
+
+RETURN_PATH:
+	return;
+}
+/** @} */
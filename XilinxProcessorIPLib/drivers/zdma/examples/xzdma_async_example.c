@@ -0,0 +1,291 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async_example.c
+*
+* This file contains an example using the asynchronous memcpy engine of the
+* XZDma driver in polled mode. Copies of several sizes are timed with
+* XZDma_AsyncMemCpy() on up to eight ZDMA channels and with Xil_MemCpy(),
+* and the destination of every asynchronous copy is checked.
+*
+* The time of an asynchronous copy covers the submission, including the
+* cache maintenance done by the engine, and the wait for its completion.
+* The time taken by XZDma_AsyncMemCpy() to return is printed separately, it
+* is the part of the copy the processor cannot use for other work.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.20  mb      10/16/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xzdma.h"
+#include "xzdma_async.h"
+#include "xparameters.h"
+#include "xil_mem.h"
+#include "xil_printf.h"
+#ifdef SDT
+#include "xiltimer.h"
+#else
+#include "xtime_l.h"
+#endif
+
+/************************** Constant Definitions ******************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifndef SDT
+#define ZDMA_DEVICE_ID		XPAR_XZDMA_0_DEVICE_ID /* First ZDMA channel */
+#else
+#define ZDMA_BASEADDR		XPAR_XZDMA_0_BASEADDR /* First ZDMA channel */
+#define ZDMA_CHAN_STRIDE	0x10000U /**< Register space of a channel */
+#endif
+
+#define NUM_CHANS		XZDMA_ASYNC_MAX_CHAN /**< Channels to use */
+#define MAX_SIZE		(1024U * 1024U) /**< Largest copy in bytes */
+#define ITERATIONS		16U /**< Copies timed per size */
+#define WAIT_TIMEOUT_US		1000000U /**< Timeout of one copy */
+
+/**************************** Type Definitions *******************************/
+
+/************************** Function Prototypes ******************************/
+
+#ifndef SDT
+int XZDma_AsyncExample(u16 DeviceId);
+#else
+int XZDma_AsyncExample(UINTPTR BaseAddress);
+#endif
+static u32 ElapsedUs(XTime Start, XTime End);
+
+/************************** Variable Definitions *****************************/
+
+static XZDma ZDmaChans[NUM_CHANS];	/**< Instances of the ZDMA channels */
+static XZDma_Async Engine;		/**< Instance of the async engine */
+static XZDma_AsyncReq Req;		/**< Request of the timed copy */
+
+static const u32 CopySizes[] = { 4096U, 65536U, 262144U, MAX_SIZE };
+
+#if defined(__ICCARM__)
+#pragma data_alignment = 64
+static u8 DscrMem[NUM_CHANS * XZDMA_ASYNC_BATCH * sizeof(XZDma_LlDscr)];
+#pragma data_alignment = 64
+u8 ZDmaAsyncSrcBuf[MAX_SIZE]; /**< Source buffer */
+#pragma data_alignment = 64
+u8 ZDmaAsyncDstBuf[MAX_SIZE]; /**< Destination buffer */
+#else
+static u8 DscrMem[NUM_CHANS * XZDMA_ASYNC_BATCH * sizeof(XZDma_LlDscr)]
+__attribute__ ((aligned (64))); /**< Descriptor memory of the engine */
+u8 ZDmaAsyncSrcBuf[MAX_SIZE] __attribute__ ((aligned (64))); /**< Source
+							      buffer */
+u8 ZDmaAsyncDstBuf[MAX_SIZE] __attribute__ ((aligned (64))); /**< Destination
+							      buffer */
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	/* Run the async example */
+#ifndef SDT
+	Status = XZDma_AsyncExample((u16)ZDMA_DEVICE_ID);
+#else
+	Status = XZDma_AsyncExample(ZDMA_BASEADDR);
+#endif
+	if (Status != XST_SUCCESS) {
+		xil_printf("ZDMA Async Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran ZDMA Async Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the asynchronous engine on the channels starting
+* at the given one and times copies against Xil_MemCpy().
+*
+* @param	DeviceId is the XPAR_<ZDMA Instance>_DEVICE_ID macro value of
+*		the first channel. The following device IDs are used for the
+*		other channels.
+* @param	BaseAddress is the base address of the first channel. The
+*		channels following it in the register space are used for the
+*		other channels.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+#ifndef SDT
+int XZDma_AsyncExample(u16 DeviceId)
+#else
+int XZDma_AsyncExample(UINTPTR BaseAddress)
+#endif
+{
+	int Status;
+	XZDma_Config *Config;
+	XZDma *ZDmaPtrs[NUM_CHANS];
+	XZDma_AsyncStats Stats;
+	XTime Start;
+	XTime Submitted;
+	XTime End;
+	u32 NumChans = 0U;
+	u32 SizeIdx;
+	u32 Iter;
+	u32 Index;
+	u32 Size;
+	u32 MemCpyUs;
+	u32 AsyncUs;
+	u32 SubmitUs;
+
+	/*
+	 * Initialize the channels, the engine uses as many of them as are
+	 * present
+	 */
+	for (Index = 0U; Index < NUM_CHANS; Index++) {
+#ifndef SDT
+		Config = XZDma_LookupConfig((u16)(DeviceId + Index));
+#else
+		Config = XZDma_LookupConfig(BaseAddress +
+					    (Index * ZDMA_CHAN_STRIDE));
+#endif
+		if (Config == NULL) {
+			break;
+		}
+
+		Status = XZDma_CfgInitialize(&ZDmaChans[Index], Config,
+					     Config->BaseAddress);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		ZDmaPtrs[Index] = &ZDmaChans[Index];
+		NumChans++;
+	}
+	if (NumChans == 0U) {
+		return XST_FAILURE;
+	}
+
+	Status = XZDma_AsyncInitialize(&Engine, ZDmaPtrs, NumChans,
+				       (UINTPTR)DscrMem, sizeof(DscrMem), TRUE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Filling the source buffer */
+	for (Index = 0U; Index < MAX_SIZE; Index++) {
+		ZDmaAsyncSrcBuf[Index] = (u8)(Index + (Index >> 8));
+	}
+
+	xil_printf("ZDMA async copy on %u channels against Xil_MemCpy, "
+		   "average of %u copies\r\n", NumChans, ITERATIONS);
+	xil_printf("    Size  MemCpy us  Async us  Submit us\r\n");
+
+	for (SizeIdx = 0U; SizeIdx < (sizeof(CopySizes) / sizeof(CopySizes[0]));
+	     SizeIdx++) {
+		Size = CopySizes[SizeIdx];
+		MemCpyUs = 0U;
+		AsyncUs = 0U;
+		SubmitUs = 0U;
+
+		for (Iter = 0U; Iter < ITERATIONS; Iter++) {
+			XTime_GetTime(&Start);
+			Xil_MemCpy(ZDmaAsyncDstBuf, ZDmaAsyncSrcBuf, Size);
+			XTime_GetTime(&End);
+			MemCpyUs += ElapsedUs(Start, End);
+
+			/* Clear the destination, so that the DMA copy is checked */
+			(void)memset(ZDmaAsyncDstBuf, 0, Size);
+
+			XTime_GetTime(&Start);
+			Status = XZDma_AsyncMemCpy(&Engine, &Req,
+						   (UINTPTR)ZDmaAsyncDstBuf,
+						   (UINTPTR)ZDmaAsyncSrcBuf,
+						   Size, NULL, NULL);
+			XTime_GetTime(&Submitted);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+			Status = XZDma_AsyncWait(&Engine, &Req, WAIT_TIMEOUT_US);
+			XTime_GetTime(&End);
+			if (Status != XST_SUCCESS) {
+				xil_printf("ZDMA async copy of %u bytes failed\r\n",
+					   Size);
+				return XST_FAILURE;
+			}
+			AsyncUs += ElapsedUs(Start, End);
+			SubmitUs += ElapsedUs(Start, Submitted);
+
+			/* The engine has invalidated the destination */
+			for (Index = 0U; Index < Size; Index++) {
+				if (ZDmaAsyncDstBuf[Index] !=
+				    ZDmaAsyncSrcBuf[Index]) {
+					xil_printf("Mismatch at %u of a %u byte "
+						   "copy\r\n", Index, Size);
+					return XST_FAILURE;
+				}
+			}
+		}
+
+		xil_printf("%8u  %9u  %8u  %9u\r\n", Size,
+			   MemCpyUs / ITERATIONS, AsyncUs / ITERATIONS,
+			   SubmitUs / ITERATIONS);
+	}
+
+	XZDma_AsyncGetStats(&Engine, &Stats);
+	xil_printf("Requests %u, errors %u, hardware starts %u\r\n",
+		   Stats.Requests, Stats.Errors, Stats.Runs);
+	if (Stats.Errors != 0U) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function converts a timer interval to microseconds.
+*
+* @param	Start is the timer value at the start of the interval.
+* @param	End is the timer value at the end of the interval.
+*
+* @return	Length of the interval in microseconds.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 ElapsedUs(XTime Start, XTime End)
+{
+	return (u32)(((End - Start) * 1000000U) / COUNTS_PER_SECOND);
+}
@@ -116,6 +116,8 @@
 *                        in applications directly.
 * 1.14	adk	03/15/22 Fixed syntax errors in zdma_tapp.tcl file, when stdout
 * 			 is configured as none.
+* 1.20  mb      10/16/26 Added the asynchronous memcpy/memset engine, see
+*			 xzdma_async.h.
 * </pre>
 *
 ******************************************************************************/
@@ -0,0 +1,627 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async.c
+* @addtogroup zdma Overview
+* @{
+*
+* This file contains the implementation of the asynchronous memcpy/memset
+* engine on top of the ZDMA driver. Refer to the header file xzdma_async.h for
+* more detailed information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.20  mb      10/16/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma_async.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Errors after which the channel stops, see XZDma_IntrHandler() */
+#define XZDMA_ASYNC_FATAL_MASK	(XZDMA_IXR_AXI_WR_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DST_DSCR_MASK | \
+				 XZDMA_IXR_AXI_RD_SRC_DSCR_MASK)
+
+/* Largest chunk a single descriptor can carry */
+#define XZDMA_ASYNC_MAX_CHUNK	(XZDMA_WORD2_SIZE_MASK & \
+				 ~(XZDMA_ASYNC_ALIGN - 1U))
+
+/************************** Function Prototypes ******************************/
+
+static void XZDma_AsyncDoneCallBack(void *CallBackRef);
+static void XZDma_AsyncErrorCallBack(void *CallBackRef, u32 Mask);
+static void XZDma_AsyncStartChan(XZDma_AsyncChan *ChanPtr);
+static void XZDma_AsyncRetire(XZDma_AsyncChan *ChanPtr, s32 Status);
+static s32 XZDma_AsyncSubmit(XZDma_Async *EnginePtr, XZDma_AsyncReq *ReqPtr);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the engine on a set of ZDMA channels. The
+* descriptor memory is split evenly between the channels.
+*
+* @param	EnginePtr is a pointer to the XZDma_Async instance.
+* @param	ZDmaPtrs is an array of initialized, idle ZDMA channels.
+* @param	NumChans is the number of channels, 1 to XZDMA_ASYNC_MAX_CHAN.
+* @param	DscrMemPtr is the descriptor memory, aligned to 64 bytes.
+* @param	DscrMemSize is the size of the descriptor memory. Each channel
+*		needs 64 bytes per chunk it can start at once.
+* @param	IsPolled selects polled mode (TRUE) or interrupt mode (FALSE).
+*
+* @return
+*		- XST_SUCCESS if the engine is ready.
+*		- XST_INVALID_PARAM if the descriptor memory is too small.
+*		- XST_FAILURE if a channel is not idle.
+*
+* @note		The callbacks of the channels are replaced by the engine.
+*
+******************************************************************************/
+s32 XZDma_AsyncInitialize(XZDma_Async *EnginePtr, XZDma *ZDmaPtrs[],
+			  u32 NumChans, UINTPTR DscrMemPtr, u32 DscrMemSize,
+			  u8 IsPolled)
+{
+	XZDma_AsyncChan *ChanPtr;
+	u32 ChanMemSize;
+	u32 Index;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(EnginePtr != NULL);
+	Xil_AssertNonvoid(ZDmaPtrs != NULL);
+	Xil_AssertNonvoid((NumChans > 0U) && (NumChans <= XZDMA_ASYNC_MAX_CHAN));
+	Xil_AssertNonvoid(DscrMemPtr != 0x00U);
+	Xil_AssertNonvoid((IsPolled == TRUE) || (IsPolled == FALSE));
+
+	(void)memset(EnginePtr, 0, sizeof(XZDma_Async));
+
+	ChanMemSize = (DscrMemSize / NumChans) & ~(XZDMA_ASYNC_ALIGN - 1U);
+	if (ChanMemSize < (2U * sizeof(XZDma_LlDscr))) {
+		Status = XST_INVALID_PARAM;
+		goto End;
+	}
+
+	for (Index = 0U; Index < NumChans; Index++) {
+		ChanPtr = &EnginePtr->Chans[Index];
+		ChanPtr->ZDmaPtr = ZDmaPtrs[Index];
+		ChanPtr->EnginePtr = EnginePtr;
+
+		Xil_AssertNonvoid(ChanPtr->ZDmaPtr != NULL);
+		Xil_AssertNonvoid(ChanPtr->ZDmaPtr->IsReady ==
+				  (u32)(XIL_COMPONENT_IS_READY));
+
+		Status = XZDma_SetMode(ChanPtr->ZDmaPtr, TRUE,
+				       XZDMA_NORMAL_MODE);
+		if (Status != XST_SUCCESS) {
+			goto End;
+		}
+
+		ChanPtr->DscrCount = XZDma_CreateBDList(ChanPtr->ZDmaPtr,
+							XZDMA_LINKEDLIST,
+							DscrMemPtr + (Index * ChanMemSize),
+							ChanMemSize);
+		if (ChanPtr->DscrCount > XZDMA_ASYNC_BATCH) {
+			ChanPtr->DscrCount = XZDMA_ASYNC_BATCH;
+		}
+
+		(void)XZDma_SetCallBack(ChanPtr->ZDmaPtr, XZDMA_HANDLER_DONE,
+					(void *)XZDma_AsyncDoneCallBack,
+					ChanPtr);
+		(void)XZDma_SetCallBack(ChanPtr->ZDmaPtr, XZDMA_HANDLER_ERROR,
+					(void *)XZDma_AsyncErrorCallBack,
+					ChanPtr);
+		XZDma_EnableIntr(ChanPtr->ZDmaPtr, XZDMA_IXR_DMA_DONE_MASK |
+				 XZDMA_ASYNC_FATAL_MASK);
+	}
+
+	EnginePtr->NumChans = NumChans;
+	EnginePtr->IsPolled = IsPolled;
+	EnginePtr->IsCacheCoherent = ZDmaPtrs[0]->Config.IsCacheCoherent;
+	Status = XST_SUCCESS;
+
+End:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits an asynchronous memory copy.
+*
+* @param	EnginePtr is a pointer to the XZDma_Async instance.
+* @param	ReqPtr is the request, owned by the engine until it completes.
+* @param	DstAddr is the destination address.
+* @param	SrcAddr is the source address.
+* @param	Size is the number of bytes to copy.
+* @param	Handler is called on completion, may be NULL.
+* @param	CallBackRef is passed to Handler.
+*
+* @return
+*		- XST_SUCCESS if the request was queued.
+*		- XST_DEVICE_BUSY if the channel queues are full.
+*
+* @note		Source and destination must not overlap.
+*
+******************************************************************************/
+s32 XZDma_AsyncMemCpy(XZDma_Async *EnginePtr, XZDma_AsyncReq *ReqPtr,
+		      UINTPTR DstAddr, UINTPTR SrcAddr, u32 Size,
+		      XZDma_AsyncHandler Handler, void *CallBackRef)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(EnginePtr != NULL);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+	Xil_AssertNonvoid(DstAddr != 0x00U);
+	Xil_AssertNonvoid(SrcAddr != 0x00U);
+	Xil_AssertNonvoid(Size != 0x00U);
+
+	ReqPtr->Op = XZDMA_ASYNC_COPY;
+	ReqPtr->DstAddr = DstAddr;
+	ReqPtr->SrcAddr = SrcAddr;
+	ReqPtr->Size = Size;
+	ReqPtr->Pattern = 0U;
+	ReqPtr->Handler = Handler;
+	ReqPtr->CallBackRef = CallBackRef;
+
+	return XZDma_AsyncSubmit(EnginePtr, ReqPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits an asynchronous memory fill.
+*
+* @param	EnginePtr is a pointer to the XZDma_Async instance.
+* @param	ReqPtr is the request, owned by the engine until it completes.
+* @param	DstAddr is the destination address.
+* @param	Value is the byte written to every location.
+* @param	Size is the number of bytes to fill.
+* @param	Handler is called on completion, may be NULL.
+* @param	CallBackRef is passed to Handler.
+*
+* @return
+*		- XST_SUCCESS if the request was queued.
+*		- XST_DEVICE_BUSY if the channel queues are full.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_AsyncMemSet(XZDma_Async *EnginePtr, XZDma_AsyncReq *ReqPtr,
+		      UINTPTR DstAddr, u8 Value, u32 Size,
+		      XZDma_AsyncHandler Handler, void *CallBackRef)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(EnginePtr != NULL);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+	Xil_AssertNonvoid(DstAddr != 0x00U);
+	Xil_AssertNonvoid(Size != 0x00U);
+
+	ReqPtr->Op = XZDMA_ASYNC_SET;
+	ReqPtr->DstAddr = DstAddr;
+	ReqPtr->SrcAddr = DstAddr;
+	ReqPtr->Size = Size;
+	ReqPtr->Pattern = (u32)Value * 0x01010101U;
+	ReqPtr->Handler = Handler;
+	ReqPtr->CallBackRef = CallBackRef;
+
+	return XZDma_AsyncSubmit(EnginePtr, ReqPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits for a request to complete. In polled mode it drives the
+* engine while waiting.
+*
+* @param	EnginePtr is a pointer to the XZDma_Async instance.
+* @param	ReqPtr is the request to wait for.
+* @param	TimeOutUs is the maximum time to wait in microseconds.
+*
+* @return
+*		- Status of the request once it has completed.
+*		- XST_TIMEOUT if it did not complete in time.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_AsyncWait(XZDma_Async *EnginePtr, XZDma_AsyncReq *ReqPtr,
+		    u32 TimeOutUs)
+{
+	u32 TimeOut = TimeOutUs;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(EnginePtr != NULL);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+
+	while (ReqPtr->Done == FALSE) {
+		if (EnginePtr->IsPolled == TRUE) {
+			XZDma_AsyncPoll(EnginePtr);
+			if (ReqPtr->Done == TRUE) {
+				break;
+			}
+		}
+		if (TimeOut == 0U) {
+			Status = XST_TIMEOUT;
+			goto End;
+		}
+		(void)usleep(1U);
+		TimeOut--;
+	}
+
+	Status = ReqPtr->Status;
+
+End:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function processes the completions of all channels in polled mode.
+*
+* @param	EnginePtr is a pointer to the XZDma_Async instance.
+*
+* @return	None.
+*
+* @note		Must not be used in interrupt mode.
+*
+******************************************************************************/
+void XZDma_AsyncPoll(XZDma_Async *EnginePtr)
+{
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertVoid(EnginePtr != NULL);
+
+	for (Index = 0U; Index < EnginePtr->NumChans; Index++) {
+		if (EnginePtr->Chans[Index].Active != 0U) {
+			XZDma_AsyncIntrHandler(&EnginePtr->Chans[Index]);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of a channel of the engine. It
+* completes the chunks of the finished run and starts the next queued
+* chunks.
+*
+* @param	Instance is the channel reference from XZDma_AsyncGetChanRef().
+*
+* @return	None.
+*
+* @note		The next run is started after XZDma_IntrHandler() has cleared
+*		the status of the previous one, so no completion is lost.
+*
+******************************************************************************/
+void XZDma_AsyncIntrHandler(void *Instance)
+{
+	XZDma_AsyncChan *ChanPtr = (XZDma_AsyncChan *)Instance;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertVoid(ChanPtr != NULL);
+
+	XZDma_IntrHandler(ChanPtr->ZDmaPtr);
+
+	if ((ChanPtr->Active == 0U) ||
+	    ((ChanPtr->DoneFlag == 0U) &&
+	     ((ChanPtr->ErrorMask & XZDMA_ASYNC_FATAL_MASK) == 0U))) {
+		return;
+	}
+
+	if ((ChanPtr->ErrorMask & XZDMA_ASYNC_FATAL_MASK) != 0U) {
+		Status = XST_FAILURE;
+	} else {
+		Status = XST_SUCCESS;
+	}
+
+	XZDma_AsyncRetire(ChanPtr, Status);
+	XZDma_AsyncStartChan(ChanPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the engine statistics.
+*
+* @param	EnginePtr is a pointer to the XZDma_Async instance.
+* @param	StatsPtr is filled with the statistics.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XZDma_AsyncGetStats(XZDma_Async *EnginePtr, XZDma_AsyncStats *StatsPtr)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(EnginePtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = EnginePtr->Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function splits a request into chunks and queues them on the
+* channels. Requests smaller than two XZDMA_ASYNC_MIN_SPLIT go to a single
+* channel; the channel of the first chunk rotates between requests.
+*
+* @param	EnginePtr is a pointer to the XZDma_Async instance.
+* @param	ReqPtr is the request with its operation fields set.
+*
+* @return
+*		- XST_SUCCESS if the request was queued.
+*		- XST_DEVICE_BUSY if the channel queues are full.
+*
+******************************************************************************/
+static s32 XZDma_AsyncSubmit(XZDma_Async *EnginePtr, XZDma_AsyncReq *ReqPtr)
+{
+	XZDma_AsyncChan *ChanPtr;
+	XZDma_AsyncChunk *ChunkPtr;
+	u32 NumChunks;
+	u32 ChunkSize;
+	u32 Offset;
+	u32 Need;
+	u32 Index;
+	s32 Status;
+
+	Xil_AssertNonvoid(EnginePtr->NumChans != 0U);
+
+	if ((EnginePtr->NumChans == 1U) ||
+	    (ReqPtr->Size < (2U * XZDMA_ASYNC_MIN_SPLIT))) {
+		NumChunks = 1U;
+	} else {
+		NumChunks = ReqPtr->Size / XZDMA_ASYNC_MIN_SPLIT;
+		if (NumChunks > EnginePtr->NumChans) {
+			NumChunks = EnginePtr->NumChans;
+		}
+	}
+
+	ChunkSize = (ReqPtr->Size + NumChunks - 1U) / NumChunks;
+	ChunkSize = (ChunkSize + XZDMA_ASYNC_ALIGN - 1U) &
+		    ~(XZDMA_ASYNC_ALIGN - 1U);
+	if (ChunkSize > XZDMA_ASYNC_MAX_CHUNK) {
+		ChunkSize = XZDMA_ASYNC_MAX_CHUNK;
+	}
+	NumChunks = (ReqPtr->Size + ChunkSize - 1U) / ChunkSize;
+
+	/* Make sure all chunks fit before queuing any of them */
+	for (Index = 0U; (Index < EnginePtr->NumChans) &&
+	     (Index < NumChunks); Index++) {
+		ChanPtr = &EnginePtr->Chans[(EnginePtr->NextChan + Index) %
+					    EnginePtr->NumChans];
+		Need = NumChunks / EnginePtr->NumChans;
+		if (Index < (NumChunks % EnginePtr->NumChans)) {
+			Need++;
+		}
+		if ((ChanPtr->Count + Need) > XZDMA_ASYNC_QUEUE_DEPTH) {
+			Status = XST_DEVICE_BUSY;
+			goto End;
+		}
+	}
+
+	ReqPtr->Pending = NumChunks;
+	ReqPtr->Status = XST_SUCCESS;
+	ReqPtr->Done = FALSE;
+
+	if (EnginePtr->IsCacheCoherent == 0U) {
+		if (ReqPtr->Op == XZDMA_ASYNC_COPY) {
+			Xil_DCacheFlushRange((INTPTR)ReqPtr->SrcAddr,
+					     ReqPtr->Size);
+		}
+		Xil_DCacheFlushRange((INTPTR)ReqPtr->DstAddr, ReqPtr->Size);
+	}
+
+	Offset = 0U;
+	for (Index = 0U; Index < NumChunks; Index++) {
+		ChanPtr = &EnginePtr->Chans[EnginePtr->NextChan];
+		EnginePtr->NextChan = (EnginePtr->NextChan + 1U) %
+				      EnginePtr->NumChans;
+
+		/* Keep the channel interrupt out while its queue changes */
+		XZDma_DisableIntr(ChanPtr->ZDmaPtr, XZDMA_IXR_ALL_INTR_MASK);
+
+		ChunkPtr = &ChanPtr->Queue[(ChanPtr->Head + ChanPtr->Count) %
+					   XZDMA_ASYNC_QUEUE_DEPTH];
+		ChunkPtr->ReqPtr = ReqPtr;
+		ChunkPtr->DstAddr = ReqPtr->DstAddr + Offset;
+		ChunkPtr->SrcAddr = ReqPtr->SrcAddr + Offset;
+		ChunkPtr->Size = ((ReqPtr->Size - Offset) < ChunkSize) ?
+				 (ReqPtr->Size - Offset) : ChunkSize;
+		ChanPtr->Count++;
+		Offset += ChunkPtr->Size;
+
+		if (ChanPtr->Active == 0U) {
+			XZDma_AsyncStartChan(ChanPtr);
+		} else {
+			XZDma_WriteReg(ChanPtr->ZDmaPtr->Config.BaseAddress,
+				       XZDMA_CH_IEN_OFFSET,
+				       (ChanPtr->ZDmaPtr->IntrMask &
+					XZDMA_IXR_ALL_INTR_MASK));
+		}
+	}
+
+	Status = XST_SUCCESS;
+
+End:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function starts the next run of a channel if it is idle. A
+* fill runs alone in write only simple mode, consecutive copies run together
+* as one linked list.
+*
+* @param	ChanPtr is a pointer to the engine channel.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncStartChan(XZDma_AsyncChan *ChanPtr)
+{
+	XZDma *ZDmaPtr = ChanPtr->ZDmaPtr;
+	XZDma_AsyncChunk *ChunkPtr;
+	XZDma_Transfer *XferPtr;
+	u32 Pattern[4];
+	u32 Num = 0U;
+
+	if ((ChanPtr->Active != 0U) || (ChanPtr->Count == 0U)) {
+		return;
+	}
+
+	ChunkPtr = &ChanPtr->Queue[ChanPtr->Head];
+
+	if (ChunkPtr->ReqPtr->Op == XZDMA_ASYNC_SET) {
+		if ((ZDmaPtr->IsSgDma == TRUE) ||
+		    (ZDmaPtr->Mode != XZDMA_WRONLY_MODE)) {
+			(void)XZDma_SetMode(ZDmaPtr, FALSE, XZDMA_WRONLY_MODE);
+		}
+		Pattern[0] = ChunkPtr->ReqPtr->Pattern;
+		Pattern[1] = ChunkPtr->ReqPtr->Pattern;
+		Pattern[2] = ChunkPtr->ReqPtr->Pattern;
+		Pattern[3] = ChunkPtr->ReqPtr->Pattern;
+		XZDma_WOData(ZDmaPtr, Pattern);
+		Num = 1U;
+	} else {
+		if (ZDmaPtr->IsSgDma != TRUE) {
+			(void)XZDma_SetMode(ZDmaPtr, TRUE, XZDMA_NORMAL_MODE);
+		}
+		while ((Num < ChanPtr->Count) && (Num < ChanPtr->DscrCount)) {
+			ChunkPtr = &ChanPtr->Queue[(ChanPtr->Head + Num) %
+						   XZDMA_ASYNC_QUEUE_DEPTH];
+			if (ChunkPtr->ReqPtr->Op != XZDMA_ASYNC_COPY) {
+				break;
+			}
+			Num++;
+		}
+	}
+
+	for (ChanPtr->Active = 0U; ChanPtr->Active < Num; ChanPtr->Active++) {
+		ChunkPtr = &ChanPtr->Queue[(ChanPtr->Head + ChanPtr->Active) %
+					   XZDMA_ASYNC_QUEUE_DEPTH];
+		XferPtr = &ChanPtr->Xfer[ChanPtr->Active];
+		XferPtr->SrcAddr = ChunkPtr->SrcAddr;
+		XferPtr->DstAddr = ChunkPtr->DstAddr;
+		XferPtr->Size = ChunkPtr->Size;
+		XferPtr->SrcCoherent = ChanPtr->EnginePtr->IsCacheCoherent;
+		XferPtr->DstCoherent = ChanPtr->EnginePtr->IsCacheCoherent;
+		XferPtr->Pause = 0U;
+	}
+
+	ChanPtr->DoneFlag = 0U;
+	ChanPtr->ErrorMask = 0U;
+	ChanPtr->EnginePtr->Stats.Runs++;
+
+	(void)XZDma_Start(ZDmaPtr, ChanPtr->Xfer, Num);
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function completes the chunks of the finished run of a channel
+* and the requests they finish.
+*
+* @param	ChanPtr is a pointer to the engine channel.
+* @param	Status is the result of the run.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncRetire(XZDma_AsyncChan *ChanPtr, s32 Status)
+{
+	XZDma_Async *EnginePtr = ChanPtr->EnginePtr;
+	XZDma_AsyncChunk *ChunkPtr;
+	XZDma_AsyncReq *ReqPtr;
+
+	while (ChanPtr->Active > 0U) {
+		ChunkPtr = &ChanPtr->Queue[ChanPtr->Head];
+		ReqPtr = ChunkPtr->ReqPtr;
+
+		ChanPtr->Head = (ChanPtr->Head + 1U) % XZDMA_ASYNC_QUEUE_DEPTH;
+		ChanPtr->Count--;
+		ChanPtr->Active--;
+
+		if (Status != XST_SUCCESS) {
+			ReqPtr->Status = XST_FAILURE;
+		} else {
+			EnginePtr->Stats.Bytes += ChunkPtr->Size;
+		}
+
+		ReqPtr->Pending--;
+		if (ReqPtr->Pending != 0U) {
+			continue;
+		}
+
+		if (EnginePtr->IsCacheCoherent == 0U) {
+			Xil_DCacheInvalidateRange((INTPTR)ReqPtr->DstAddr,
+						  ReqPtr->Size);
+		}
+
+		EnginePtr->Stats.Requests++;
+		if (ReqPtr->Status != XST_SUCCESS) {
+			EnginePtr->Stats.Errors++;
+		}
+
+		ReqPtr->Done = TRUE;
+		if (ReqPtr->Handler != NULL) {
+			ReqPtr->Handler(ReqPtr->CallBackRef, ReqPtr->Status);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function records the done interrupt of a channel.
+*
+* @param	CallBackRef is a pointer to the engine channel.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncDoneCallBack(void *CallBackRef)
+{
+	XZDma_AsyncChan *ChanPtr = (XZDma_AsyncChan *)CallBackRef;
+
+	ChanPtr->DoneFlag = 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function records the error interrupts of a channel.
+*
+* @param	CallBackRef is a pointer to the engine channel.
+* @param	Mask is the mask of the error interrupts.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncErrorCallBack(void *CallBackRef, u32 Mask)
+{
+	XZDma_AsyncChan *ChanPtr = (XZDma_AsyncChan *)CallBackRef;
+
+	ChanPtr->ErrorMask |= Mask;
+}
+/** @} */
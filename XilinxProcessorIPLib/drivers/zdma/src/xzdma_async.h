@@ -0,0 +1,217 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async.h
+* @addtogroup zdma Overview
+* @{
+*
+* The asynchronous memcpy/memset engine runs memory copies and fills on a set
+* of ZDMA channels, usually all eight channels of the ADMA or GDMA.
+*
+* - The channels are initialized by the application with
+*   XZDma_CfgInitialize() and handed to XZDma_AsyncInitialize() together with
+*   one memory region, which is split into a linked list descriptor pool per
+*   channel.
+* - XZDma_AsyncMemCpy() and XZDma_AsyncMemSet() return at once. Large
+*   requests are split into chunks spread over the channels, small ones go to
+*   one channel. Copies queued on a channel are started together as one
+*   linked list; fills run in write only simple mode.
+* - Completion is reported through the request: the optional callback is
+*   invoked and XZDma_AsyncIsDone() becomes TRUE, so the request can also be
+*   used as a future with XZDma_AsyncWait().
+*
+* In interrupt mode the application connects XZDma_AsyncIntrHandler() to the
+* interrupt of every channel, with XZDma_AsyncGetChanRef() as callback
+* reference, instead of XZDma_IntrHandler(). In polled mode no interrupt is
+* used and XZDma_AsyncPoll() or XZDma_AsyncWait() drive the engine.
+*
+* Unless the channels are cache coherent, the engine flushes the source and
+* destination buffers when a request is submitted and invalidates the
+* destination buffer when it completes. Buffers should be cache line aligned.
+*
+* The engine is not thread safe. Submitting from one thread while the
+* interrupt handlers run is supported.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.20  mb      10/16/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef XZDMA_ASYNC_H_
+#define XZDMA_ASYNC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XZDMA_ASYNC_MAX_CHAN	8U	/**< Channels of one ZDMA */
+#define XZDMA_ASYNC_QUEUE_DEPTH	16U	/**< Queued chunks per channel */
+#define XZDMA_ASYNC_BATCH	16U	/**< Max chunks started at once */
+#define XZDMA_ASYNC_MIN_SPLIT	(64U * 1024U)	/**< Smallest chunk of a
+						  *  split request */
+#define XZDMA_ASYNC_ALIGN	64U	/**< Alignment of split chunks */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * This typedef contains the operations of the engine.
+ */
+typedef enum {
+	XZDMA_ASYNC_COPY,	/**< Memory copy */
+	XZDMA_ASYNC_SET,	/**< Memory fill */
+} XZDma_AsyncOp;
+
+/******************************************************************************/
+/**
+* Callback type for the completion of a request.
+*
+* @param	CallBackRef is the reference passed with the request.
+* @param	Status is XST_SUCCESS, or XST_FAILURE if a chunk of the
+*		request failed.
+*******************************************************************************/
+typedef void (*XZDma_AsyncHandler) (void *CallBackRef, s32 Status);
+
+/**
+ * This typedef contains a request. It is owned by the engine from submission
+ * until completion.
+ */
+typedef struct {
+	XZDma_AsyncOp Op;		/**< Operation */
+	UINTPTR DstAddr;		/**< Destination address */
+	UINTPTR SrcAddr;		/**< Source address, copies only */
+	u32 Size;			/**< Size in bytes */
+	u32 Pattern;			/**< Fill word, fills only */
+	XZDma_AsyncHandler Handler;	/**< Completion callback or NULL */
+	void *CallBackRef;		/**< Passed to Handler */
+	volatile u32 Pending;		/**< Chunks not completed */
+	volatile s32 Status;		/**< Result of the request */
+	volatile u32 Done;		/**< Request has completed */
+} XZDma_AsyncReq;
+
+/**
+ * This typedef contains a chunk of a request queued on a channel.
+ */
+typedef struct {
+	XZDma_AsyncReq *ReqPtr;		/**< Request of the chunk */
+	UINTPTR DstAddr;		/**< Destination of the chunk */
+	UINTPTR SrcAddr;		/**< Source of the chunk */
+	u32 Size;			/**< Size of the chunk */
+} XZDma_AsyncChunk;
+
+struct XZDma_Async_s;
+
+/**
+ * This typedef contains the state of one channel of the engine.
+ */
+typedef struct {
+	XZDma *ZDmaPtr;			/**< Channel instance */
+	struct XZDma_Async_s *EnginePtr;/**< Engine of the channel */
+	XZDma_AsyncChunk Queue[XZDMA_ASYNC_QUEUE_DEPTH];
+					/**< Queued and running chunks */
+	u32 Head;			/**< Oldest chunk */
+	u32 Count;			/**< Queued and running chunks */
+	u32 Active;			/**< Chunks running in hardware */
+	u32 DscrCount;			/**< Descriptors of the channel */
+	volatile u32 DoneFlag;		/**< Done interrupt seen */
+	volatile u32 ErrorMask;		/**< Error interrupts seen */
+	XZDma_Transfer Xfer[XZDMA_ASYNC_BATCH];
+					/**< Transfers of the running batch */
+} XZDma_AsyncChan;
+
+/**
+ * This typedef contains the engine statistics.
+ */
+typedef struct {
+	u32 Requests;			/**< Requests completed */
+	u32 Errors;			/**< Requests failed */
+	u32 Runs;			/**< Hardware starts */
+	u64 Bytes;			/**< Bytes copied or filled */
+} XZDma_AsyncStats;
+
+/**
+ * The engine instance data structure.
+ */
+typedef struct XZDma_Async_s {
+	XZDma_AsyncChan Chans[XZDMA_ASYNC_MAX_CHAN];	/**< Channels */
+	u32 NumChans;			/**< Channels in use */
+	u32 NextChan;			/**< Channel the next request starts at */
+	u8 IsPolled;			/**< Polled instead of interrupt mode */
+	u8 IsCacheCoherent;		/**< Channels are cache coherent */
+	XZDma_AsyncStats Stats;		/**< Statistics */
+} XZDma_Async;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+*
+* This function returns whether a request has completed.
+*
+* @param	ReqPtr is a pointer to the request.
+*
+* @return	TRUE if the request has completed, FALSE otherwise.
+*
+* @note
+* 		C-style signature:
+*		u32 XZDma_AsyncIsDone(XZDma_AsyncReq *ReqPtr)
+*
+******************************************************************************/
+#define XZDma_AsyncIsDone(ReqPtr)	((ReqPtr)->Done)
+
+/*****************************************************************************/
+/**
+*
+* This function returns the callback reference of a channel, to be passed to
+* the interrupt controller together with XZDma_AsyncIntrHandler().
+*
+* @param	EnginePtr is a pointer to the XZDma_Async instance.
+* @param	Index is the index of the channel in XZDma_AsyncInitialize().
+*
+* @return	Callback reference of the channel.
+*
+* @note
+* 		C-style signature:
+*		void *XZDma_AsyncGetChanRef(XZDma_Async *EnginePtr, u32 Index)
+*
+******************************************************************************/
+#define XZDma_AsyncGetChanRef(EnginePtr, Index) \
+	((void *)&(EnginePtr)->Chans[(Index)])
+
+/************************ Prototypes of functions **************************/
+
+s32 XZDma_AsyncInitialize(XZDma_Async *EnginePtr, XZDma *ZDmaPtrs[],
+			  u32 NumChans, UINTPTR DscrMemPtr, u32 DscrMemSize,
+			  u8 IsPolled);
+s32 XZDma_AsyncMemCpy(XZDma_Async *EnginePtr, XZDma_AsyncReq *ReqPtr,
+		      UINTPTR DstAddr, UINTPTR SrcAddr, u32 Size,
+		      XZDma_AsyncHandler Handler, void *CallBackRef);
+s32 XZDma_AsyncMemSet(XZDma_Async *EnginePtr, XZDma_AsyncReq *ReqPtr,
+		      UINTPTR DstAddr, u8 Value, u32 Size,
+		      XZDma_AsyncHandler Handler, void *CallBackRef);
+s32 XZDma_AsyncWait(XZDma_Async *EnginePtr, XZDma_AsyncReq *ReqPtr,
+		    u32 TimeOutUs);
+void XZDma_AsyncPoll(XZDma_Async *EnginePtr);
+void XZDma_AsyncIntrHandler(void *Instance);
+void XZDma_AsyncGetStats(XZDma_Async *EnginePtr, XZDma_AsyncStats *StatsPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XZDMA_ASYNC_H_ */
+/** @} */
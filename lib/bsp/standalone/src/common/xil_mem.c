@@ -1,6 +1,7 @@
 /******************************************************************************/
 /**
 * Copyright (c) 2015 - 2022 Xilinx, Inc.  All rights reserved.
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
 * SPDX-License-Identifier: MIT
 ******************************************************************************/
 
@@ -8,8 +9,10 @@
 /**
 * @file xil_mem.c
 *
-* This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* This file contains xil mem copy, move and set functions. The bulk of every
+* transfer is done with the widest access the processor supports (LDP/STP or
+* NEON on ARMv8, LDM/STM on 32-bit ARM and word accesses elsewhere). The
+* implementation is selected at build time from the compiler target macros.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -22,6 +25,12 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 9.3   mb       10/16/26 Reworked Xil_MemCpy to align the destination and
+* 			  copy the bulk with LDP/STP/NEON on ARMv8, LDM/STM on
+* 			  32-bit ARM and shift-merged words for misaligned
+* 			  sources. Added Xil_MemMove and Xil_MemSet.
+*       mb       10/16/26 Keep 32-bit and 16-bit accesses for short copies
+* 			  and tails of aligned buffers, added Xil_MemCpyDevice.
 *
 * </pre>
 *
@@ -32,11 +41,271 @@
 #include "xil_types.h"
 #include "xil_mem.h"
 
-/***************** Inline Functions Definitions ********************/
+/************************** Constant Definitions ****************************/
+
+#if defined (__aarch64__) || defined (__arch64__)
+typedef u64 XilMemWord;		/**< Native word used by the copy loops */
+#else
+typedef u32 XilMemWord;		/**< Native word used by the copy loops */
+#endif
+
+#define XIL_MEM_WORD_SIZE	((u32)sizeof(XilMemWord))
+#define XIL_MEM_WORD_MASK	((UINTPTR)XIL_MEM_WORD_SIZE - 1U)
+#define XIL_MEM_WORD_BITS	(XIL_MEM_WORD_SIZE * 8U)
+
+/*
+ * Transfers shorter than this skip the alignment prologue and the block
+ * loops, it would cost more than it saves.
+ */
+#define XIL_MEM_SMALL_SIZE	(2U * XIL_MEM_WORD_SIZE)
+
+/* Block size of the unrolled bulk loops */
+#if defined (__aarch64__)
+#define XIL_MEM_BLOCK_SIZE	64U
+#elif defined (__arm__)
+#define XIL_MEM_BLOCK_SIZE	32U
+#else
+#define XIL_MEM_BLOCK_SIZE	(8U * XIL_MEM_WORD_SIZE)
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+#if defined (__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define XIL_MEM_MERGE(Lo, Hi, Shift) \
+	(((Lo) << (Shift)) | ((Hi) >> (XIL_MEM_WORD_BITS - (Shift))))
+#else
+#define XIL_MEM_MERGE(Lo, Hi, Shift) \
+	(((Lo) >> (Shift)) | ((Hi) << (XIL_MEM_WORD_BITS - (Shift))))
+#endif
+
+/************************** Function Prototypes *****************************/
+
+static void Xil_MemCpyNarrow(u8 *d, const u8 *s, u32 cnt);
+static u32 Xil_MemCpyBlocks(u8 *d, const u8 *s, u32 cnt);
+static u32 Xil_MemSetBlocks(u8 *d, XilMemWord Pattern, u32 cnt);
+
+/*****************************************************************************/
+/**
+* @brief       Copies with 32-bit, 16-bit and byte accesses, each width is
+*              used while source and destination are both aligned to it.
+*              Buffers aligned to 4 bytes are copied with 32-bit accesses
+*              up to the last 1 to 3 bytes, as Xil_MemCpy always did.
+*
+* @param       d: destination pointer
+* @param       s: source pointer
+* @param       cnt: number of bytes to copy
+*
+*****************************************************************************/
+static void Xil_MemCpyNarrow(u8 *d, const u8 *s, u32 cnt)
+{
+	if ((((UINTPTR)d | (UINTPTR)s) & 3U) == 0U) {
+		while (cnt >= sizeof(u32)) {
+			*(u32 *)(void *)d = *(const u32 *)(const void *)s;
+			d += sizeof(u32);
+			s += sizeof(u32);
+			cnt -= sizeof(u32);
+		}
+	}
+	if ((((UINTPTR)d | (UINTPTR)s) & 1U) == 0U) {
+		while (cnt >= sizeof(u16)) {
+			*(u16 *)(void *)d = *(const u16 *)(const void *)s;
+			d += sizeof(u16);
+			s += sizeof(u16);
+			cnt -= sizeof(u16);
+		}
+	}
+	while (cnt > 0U) {
+		*d = *s;
+		d += 1U;
+		s += 1U;
+		cnt -= 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       Copies whole blocks between word aligned buffers using the
+*              widest load/store instructions of the processor.
+*
+* @param       d: word aligned destination pointer
+* @param       s: word aligned source pointer
+* @param       cnt: number of bytes available to copy
+*
+* @return      Number of bytes copied, always a multiple of
+*              XIL_MEM_BLOCK_SIZE.
+*
+*****************************************************************************/
+static u32 Xil_MemCpyBlocks(u8 *d, const u8 *s, u32 cnt)
+{
+	u32 Done = cnt & ~(XIL_MEM_BLOCK_SIZE - 1U);
+	u32 Blocks = Done / XIL_MEM_BLOCK_SIZE;
+
+	if (Blocks == 0U) {
+		goto END;
+	}
+
+#if defined (__aarch64__) && defined (__ARM_NEON)
+	__asm__ __volatile__(
+		"1:\n"
+		"ld1	{v0.16b, v1.16b, v2.16b, v3.16b}, [%1], #64\n"
+		"subs	%w2, %w2, #1\n"
+		"st1	{v0.16b, v1.16b, v2.16b, v3.16b}, [%0], #64\n"
+		"b.ne	1b\n"
+		: "+r" (d), "+r" (s), "+r" (Blocks)
+		:
+		: "v0", "v1", "v2", "v3", "cc", "memory");
+#elif defined (__aarch64__)
+	__asm__ __volatile__(
+		"1:\n"
+		"ldp	x6, x7, [%1], #16\n"
+		"ldp	x8, x9, [%1], #16\n"
+		"ldp	x10, x11, [%1], #16\n"
+		"ldp	x12, x13, [%1], #16\n"
+		"subs	%w2, %w2, #1\n"
+		"stp	x6, x7, [%0], #16\n"
+		"stp	x8, x9, [%0], #16\n"
+		"stp	x10, x11, [%0], #16\n"
+		"stp	x12, x13, [%0], #16\n"
+		"b.ne	1b\n"
+		: "+r" (d), "+r" (s), "+r" (Blocks)
+		:
+		: "x6", "x7", "x8", "x9", "x10", "x11", "x12", "x13",
+		  "cc", "memory");
+#elif defined (__arm__)
+	__asm__ __volatile__(
+		"1:\n"
+		"ldmia	%1!, {r3, r4, r5, r6}\n"
+		"stmia	%0!, {r3, r4, r5, r6}\n"
+		"ldmia	%1!, {r3, r4, r5, r6}\n"
+		"subs	%2, %2, #1\n"
+		"stmia	%0!, {r3, r4, r5, r6}\n"
+		"bne	1b\n"
+		: "+r" (d), "+r" (s), "+r" (Blocks)
+		:
+		: "r3", "r4", "r5", "r6", "cc", "memory");
+#else
+	{
+		XilMemWord *Dw = (XilMemWord *)(void *)d;
+		const XilMemWord *Sw = (const XilMemWord *)(const void *)s;
+
+		while (Blocks > 0U) {
+			Dw[0] = Sw[0];
+			Dw[1] = Sw[1];
+			Dw[2] = Sw[2];
+			Dw[3] = Sw[3];
+			Dw[4] = Sw[4];
+			Dw[5] = Sw[5];
+			Dw[6] = Sw[6];
+			Dw[7] = Sw[7];
+			Dw = &Dw[8];
+			Sw = &Sw[8];
+			Blocks -= 1U;
+		}
+	}
+#endif
+
+END:
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+* @brief       Fills whole blocks of a word aligned buffer with a pattern
+*              using the widest store instructions of the processor.
+*
+* @param       d: word aligned destination pointer
+* @param       Pattern: fill byte replicated across a native word
+* @param       cnt: number of bytes available to fill
+*
+* @return      Number of bytes written, always a multiple of
+*              XIL_MEM_BLOCK_SIZE.
+*
+*****************************************************************************/
+static u32 Xil_MemSetBlocks(u8 *d, XilMemWord Pattern, u32 cnt)
+{
+	u32 Done = cnt & ~(XIL_MEM_BLOCK_SIZE - 1U);
+	u32 Blocks = Done / XIL_MEM_BLOCK_SIZE;
+
+	if (Blocks == 0U) {
+		goto END;
+	}
+
+#if defined (__aarch64__) && defined (__ARM_NEON)
+	__asm__ __volatile__(
+		"dup	v0.2d, %x2\n"
+		"mov	v1.16b, v0.16b\n"
+		"mov	v2.16b, v0.16b\n"
+		"mov	v3.16b, v0.16b\n"
+		"1:\n"
+		"subs	%w1, %w1, #1\n"
+		"st1	{v0.16b, v1.16b, v2.16b, v3.16b}, [%0], #64\n"
+		"b.ne	1b\n"
+		: "+r" (d), "+r" (Blocks)
+		: "r" (Pattern)
+		: "v0", "v1", "v2", "v3", "cc", "memory");
+#elif defined (__aarch64__)
+	__asm__ __volatile__(
+		"1:\n"
+		"subs	%w1, %w1, #1\n"
+		"stp	%2, %2, [%0], #16\n"
+		"stp	%2, %2, [%0], #16\n"
+		"stp	%2, %2, [%0], #16\n"
+		"stp	%2, %2, [%0], #16\n"
+		"b.ne	1b\n"
+		: "+r" (d), "+r" (Blocks)
+		: "r" (Pattern)
+		: "cc", "memory");
+#elif defined (__arm__)
+	__asm__ __volatile__(
+		"mov	r3, %2\n"
+		"mov	r4, %2\n"
+		"mov	r5, %2\n"
+		"mov	r6, %2\n"
+		"1:\n"
+		"subs	%1, %1, #1\n"
+		"stmia	%0!, {r3, r4, r5, r6}\n"
+		"stmia	%0!, {r3, r4, r5, r6}\n"
+		"bne	1b\n"
+		: "+r" (d), "+r" (Blocks)
+		: "r" (Pattern)
+		: "r3", "r4", "r5", "r6", "cc", "memory");
+#else
+	{
+		XilMemWord *Dw = (XilMemWord *)(void *)d;
+
+		while (Blocks > 0U) {
+			Dw[0] = Pattern;
+			Dw[1] = Pattern;
+			Dw[2] = Pattern;
+			Dw[3] = Pattern;
+			Dw[4] = Pattern;
+			Dw[5] = Pattern;
+			Dw[6] = Pattern;
+			Dw[7] = Pattern;
+			Dw = &Dw[8];
+			Blocks -= 1U;
+		}
+	}
+#endif
+
+END:
+	return Done;
+}
+
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
 *
+*              The destination is first brought to a word boundary. If the
+*              source is then word aligned too, the bulk is copied in blocks
+*              with the widest accesses available, otherwise aligned source
+*              words are shifted and merged so that no unaligned access is
+*              ever issued. Source and destination must not overlap, use
+*              Xil_MemMove for overlapping buffers and Xil_MemCpyDevice
+*              when either of them is device memory.
+*
 * @param       dst: pointer pointing to destination memory
 *
 * @param       src: pointer pointing to source memory
@@ -46,25 +315,179 @@
 *****************************************************************************/
 void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
-	char *d = (char*)(void *)dst;
-	const char *s = src;
-
-	while (cnt >= sizeof (s32)) {
-		*(s32*)d = *(s32*)s;
-		d += sizeof (s32);
-		s += sizeof (s32);
-		cnt -= sizeof (s32);
-	}
-	while (cnt >= sizeof (u16)) {
-		*(u16*)d = *(u16*)s;
-		d += sizeof (u16);
-		s += sizeof (u16);
-		cnt -= sizeof (u16);
-	}
-	while ((cnt) > 0U){
+	u8 *d = (u8 *)dst;
+	const u8 *s = (const u8 *)src;
+	u32 Len;
+
+	if (cnt < XIL_MEM_SMALL_SIZE) {
+		goto TAIL;
+	}
+
+	while (((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U) {
 		*d = *s;
 		d += 1U;
 		s += 1U;
 		cnt -= 1U;
 	}
+
+	if (((UINTPTR)s & XIL_MEM_WORD_MASK) == 0U) {
+		Len = Xil_MemCpyBlocks(d, s, cnt);
+		d += Len;
+		s += Len;
+		cnt -= Len;
+		while (cnt >= XIL_MEM_WORD_SIZE) {
+			*(XilMemWord *)(void *)d = *(const XilMemWord *)(const void *)s;
+			d += XIL_MEM_WORD_SIZE;
+			s += XIL_MEM_WORD_SIZE;
+			cnt -= XIL_MEM_WORD_SIZE;
+		}
+	} else {
+		u32 Shift = (u32)((UINTPTR)s & XIL_MEM_WORD_MASK) * 8U;
+		const XilMemWord *Sw = (const XilMemWord *)(const void *)
+					((UINTPTR)s & ~XIL_MEM_WORD_MASK);
+		XilMemWord Lo = *Sw;
+		XilMemWord Hi;
+
+		/*
+		 * Every aligned word read below holds at least one byte that
+		 * belongs to the source buffer, so no access crosses past the
+		 * last word of the buffer.
+		 */
+		while (cnt >= XIL_MEM_WORD_SIZE) {
+			Sw = &Sw[1];
+			Hi = *Sw;
+			*(XilMemWord *)(void *)d = XIL_MEM_MERGE(Lo, Hi, Shift);
+			Lo = Hi;
+			d += XIL_MEM_WORD_SIZE;
+			s += XIL_MEM_WORD_SIZE;
+			cnt -= XIL_MEM_WORD_SIZE;
+		}
+	}
+
+TAIL:
+	Xil_MemCpyNarrow(d, s, cnt);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function copies memory from one location to other, where
+*              either of them may be device memory, such as a register,
+*              FIFO or linear flash window. Only naturally aligned 32-bit,
+*              16-bit and byte accesses are issued, never SIMD, load/store
+*              pair or multiple accesses.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       src: pointer pointing to source memory
+*
+* @param       cnt: 32 bit length of bytes to be copied
+*
+*****************************************************************************/
+void Xil_MemCpyDevice(void* dst, const void* src, u32 cnt)
+{
+	Xil_MemCpyNarrow((u8 *)dst, (const u8 *)src, cnt);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function copies memory from one location to other, the
+*              source and destination buffers may overlap.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       src: pointer pointing to source memory
+*
+* @param       cnt: 32 bit length of bytes to be moved
+*
+*****************************************************************************/
+void Xil_MemMove(void* dst, const void* src, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	const u8 *s = (const u8 *)src;
+
+	if (((UINTPTR)d <= (UINTPTR)s) ||
+	    ((UINTPTR)d >= ((UINTPTR)s + cnt))) {
+		/* Forward copy never overwrites unread source bytes */
+		Xil_MemCpy(dst, src, cnt);
+		goto END;
+	}
+
+	/* Destination overlaps the source tail, copy backwards */
+	d += cnt;
+	s += cnt;
+	if ((((UINTPTR)d ^ (UINTPTR)s) & XIL_MEM_WORD_MASK) == 0U) {
+		while ((((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U) && (cnt > 0U)) {
+			d -= 1U;
+			s -= 1U;
+			*d = *s;
+			cnt -= 1U;
+		}
+		while (cnt >= XIL_MEM_WORD_SIZE) {
+			d -= XIL_MEM_WORD_SIZE;
+			s -= XIL_MEM_WORD_SIZE;
+			*(XilMemWord *)(void *)d = *(const XilMemWord *)(const void *)s;
+			cnt -= XIL_MEM_WORD_SIZE;
+		}
+	}
+	while (cnt > 0U) {
+		d -= 1U;
+		s -= 1U;
+		*d = *s;
+		cnt -= 1U;
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a constant byte.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       val: byte value to be written, only the least significant
+*              8 bits are used
+*
+* @param       cnt: 32 bit length of bytes to be written
+*
+*****************************************************************************/
+void Xil_MemSet(void* dst, s32 val, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	u8 Byte = (u8)val;
+	XilMemWord Pattern = (XilMemWord)Byte;
+	u32 Len;
+
+	if (cnt < XIL_MEM_SMALL_SIZE) {
+		goto TAIL;
+	}
+
+	Pattern |= Pattern << 8U;
+	Pattern |= Pattern << 16U;
+#if defined (__aarch64__) || defined (__arch64__)
+	Pattern |= Pattern << 32U;
+#endif
+
+	while (((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U) {
+		*d = Byte;
+		d += 1U;
+		cnt -= 1U;
+	}
+
+	Len = Xil_MemSetBlocks(d, Pattern, cnt);
+	d += Len;
+	cnt -= Len;
+	while (cnt >= XIL_MEM_WORD_SIZE) {
+		*(XilMemWord *)(void *)d = Pattern;
+		d += XIL_MEM_WORD_SIZE;
+		cnt -= XIL_MEM_WORD_SIZE;
+	}
+
+TAIL:
+	while (cnt > 0U) {
+		*d = Byte;
+		d += 1U;
+		cnt -= 1U;
+	}
 }
@@ -59,6 +59,7 @@ extern volatile int TcpSlowTmrFlag;
 
 void platform_enable_interrupts(void);
 void start_application(void);
+int tcp_perf_input(struct netif *netif);
 void print_app_header(void);
 
 #if defined (__arm__) && !defined (ARMR5)
@@ -220,7 +221,7 @@ int main(void)
 			tcp_slowtmr();
 			TcpSlowTmrFlag = 0;
 		}
-		xemacif_input(netif);
+		tcp_perf_input(netif);
 	}
 
 	/* never reached */
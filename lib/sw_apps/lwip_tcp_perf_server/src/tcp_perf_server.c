@@ -29,6 +29,15 @@
 /** Connection handle for a TCP Server session */
 
 #include "tcp_perf_server.h"
+#include "netif/xadapter.h"
+#if TCP_PERF_THROUGHPUT_MODE
+#include "xparameters.h"
+#ifdef SDT
+#include "xiltimer.h"
+#else
+#include "xtime_l.h"
+#endif
+#endif
 
 extern struct netif server_netif;
 static struct tcp_pcb *c_pcb;
@@ -95,6 +104,36 @@ static void stats_buffer(char* outString,
 }
 
 
+#if TCP_PERF_THROUGHPUT_MODE
+/** Report packets/sec and CPU cycles per packet of the receive path */
+static void tcp_conn_report_packets(double duration,
+		enum report_type report_type)
+{
+	u64_t packets, busy_ticks;
+	double pps = 0, cycles = 0;
+	char rate[16], cpp[16];
+
+	if (report_type == INTER_REPORT) {
+		packets = server.i_report.packets;
+		busy_ticks = server.i_report.busy_ticks;
+	} else {
+		packets = server.total_packets;
+		busy_ticks = server.total_busy_ticks;
+	}
+
+	if (duration)
+		pps = packets / duration;
+	if (packets)
+		cycles = ((double)busy_ticks * TCP_PERF_CPU_FREQ_HZ) /
+			((double)COUNTS_PER_SECOND * packets);
+
+	stats_buffer(rate, pps, SPEED);
+	sprintf(cpp, "%.0f", cycles);
+	xil_printf("[%3d] %spackets/sec  %s cycles/packet\n\r",
+			server.client_id, rate, cpp);
+}
+#endif
+
 /** The report function of a TCP server session */
 static void tcp_conn_report(u64_t diff,
 		enum report_type report_type)
@@ -129,6 +168,10 @@ static void tcp_conn_report(u64_t diff,
 	xil_printf("[%3d] %s  %sBytes  %sbits/sec\n\r", server.client_id,
 			time, data, perf);
 
+#if TCP_PERF_THROUGHPUT_MODE
+	tcp_conn_report_packets(duration, report_type);
+#endif
+
 	if (report_type == INTER_REPORT)
 		server.i_report.last_report_time += duration;
 }
@@ -190,6 +233,8 @@ static err_t tcp_recv_perf_traffic(void *arg, struct tcp_pcb *tpcb,
 				/* Reset Interim report counters */
 				server.i_report.start_time = 0;
 				server.i_report.total_bytes = 0;
+				server.i_report.packets = 0;
+				server.i_report.busy_ticks = 0;
 			}
 		} else {
 			/* Save start time for interim report */
@@ -217,6 +262,8 @@ static err_t tcp_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
 	/* Update connected client ID */
 	server.client_id++;
 	server.total_bytes = 0;
+	server.total_packets = 0;
+	server.total_busy_ticks = 0;
 
 	/* Initialize Interim report parameters */
 	server.i_report.report_interval_time =
@@ -224,6 +271,8 @@ static err_t tcp_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
 	server.i_report.last_report_time = 0;
 	server.i_report.start_time = 0;
 	server.i_report.total_bytes = 0;
+	server.i_report.packets = 0;
+	server.i_report.busy_ticks = 0;
 
 	print_tcp_conn_stats();
 
@@ -235,6 +284,31 @@ static err_t tcp_server_accept(void *arg, struct tcp_pcb *newpcb, err_t err)
 	return ERR_OK;
 }
 
+/** Process received frames, timing the receive path in throughput mode */
+int tcp_perf_input(struct netif *netif)
+{
+#if TCP_PERF_THROUGHPUT_MODE
+	XTime start, end;
+	int n_packets;
+
+	XTime_GetTime(&start);
+	n_packets = xemacif_input(netif);
+	XTime_GetTime(&end);
+
+	/* Only account the frames of a running test */
+	if (c_pcb != NULL && n_packets > 0) {
+		server.total_packets += n_packets;
+		server.total_busy_ticks += end - start;
+		server.i_report.packets += n_packets;
+		server.i_report.busy_ticks += end - start;
+	}
+
+	return n_packets;
+#else
+	return xemacif_input(netif);
+#endif
+}
+
 void start_application(void)
 {
 	err_t err;
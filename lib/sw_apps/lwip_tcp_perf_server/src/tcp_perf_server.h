@@ -80,6 +80,8 @@ struct interim_report {
 	u64_t last_report_time;
 	u32_t total_bytes;
 	u32_t report_interval_time;
+	u32_t packets;
+	u64_t busy_ticks;
 };
 
 struct perf_stats {
@@ -87,6 +89,8 @@ struct perf_stats {
 	u64_t start_time;
 	u64_t end_time;
 	u64_t total_bytes;
+	u64_t total_packets;
+	u64_t total_busy_ticks;
 	struct interim_report i_report;
 };
 
@@ -96,6 +100,14 @@ struct perf_stats {
 /* server port to listen on/connect to */
 #define TCP_CONN_PORT 5001
 
+/* set to 1 to also report packets/sec and CPU cycles spent per packet */
+#define TCP_PERF_THROUGHPUT_MODE 0
+
+/* CPU clock used to convert timer ticks into CPU cycles */
+#ifndef TCP_PERF_CPU_FREQ_HZ
+#define TCP_PERF_CPU_FREQ_HZ XPAR_CPU_CORE_CLOCK_FREQ_HZ
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,149 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <string.h>
+#include "xil_types.h"
+#include "xil_cache.h"
+#include "xil_mem.h"
+#include "xil_printf.h"
+#include "xiltimer.h"
+
+#include "memory_config.h"
+#include "memory_bench.h"
+
+/*
+ * memory_bench.c: Compare the bandwidth of Xil_MemCpy, Xil_MemMove and
+ * Xil_MemSet against the newlib memcpy, memmove and memset.
+ *
+ * The first MEMBENCH_WINDOW_SIZE bytes of every tested range are used as
+ * source and destination. D-Caches are enabled for the duration of the
+ * benchmark, as that is how payload buffers are normally accessed, and
+ * disabled again before returning to the memory tests.
+ */
+
+#define MEMBENCH_WINDOW_SIZE	(8U * 1024U * 1024U)
+#define MEMBENCH_MIN_SIZE	64U
+#define MEMBENCH_BYTES_PER_SIZE	(16U * 1024U * 1024U)
+
+typedef void (*membench_fn)(void *dst, const void *src, u32 cnt);
+
+static void xil_cpy(void *dst, const void *src, u32 cnt)
+{
+	Xil_MemCpy(dst, src, cnt);
+}
+
+static void lib_cpy(void *dst, const void *src, u32 cnt)
+{
+	(void)memcpy(dst, src, cnt);
+}
+
+static void xil_move(void *dst, const void *src, u32 cnt)
+{
+	Xil_MemMove(dst, src, cnt);
+}
+
+static void lib_move(void *dst, const void *src, u32 cnt)
+{
+	(void)memmove(dst, src, cnt);
+}
+
+static void xil_set(void *dst, const void *src, u32 cnt)
+{
+	(void)src;
+	Xil_MemSet(dst, 0x5A, cnt);
+}
+
+static void lib_set(void *dst, const void *src, u32 cnt)
+{
+	(void)src;
+	(void)memset(dst, 0x5A, cnt);
+}
+
+struct membench_op_s {
+	const char8 *name;
+	membench_fn xil;
+	membench_fn lib;
+	u32 overlap;
+};
+
+static const struct membench_op_s membench_ops[] = {
+	{ "memcpy ", xil_cpy, lib_cpy, 0U },
+	{ "memmove", xil_move, lib_move, 1U },
+	{ "memset ", xil_set, lib_set, 0U },
+};
+
+/*
+ * Returns the bandwidth in MB/s of Iter calls of fn on Size bytes.
+ */
+static u32 membench_run(membench_fn fn, u8 *dst, const u8 *src, u32 size,
+			u32 iter)
+{
+	XTime start, end;
+	u64 ticks;
+	u32 i;
+
+	XTime_GetTime(&start);
+	for (i = 0U; i < iter; i++) {
+		fn(dst, src, size);
+	}
+	XTime_GetTime(&end);
+
+	ticks = end - start;
+	if (ticks == 0U) {
+		ticks = 1U;
+	}
+
+	return (u32)(((u64)size * iter * COUNTS_PER_SECOND) /
+		     (ticks * 1024U * 1024U));
+}
+
+static void membench_sizes(const struct membench_op_s *op, u8 *base,
+			   u32 window, u32 misalign)
+{
+	u32 size, iter, xil_bw, lib_bw;
+	u8 *src = base;
+	u8 *dst;
+
+	for (size = MEMBENCH_MIN_SIZE; size <= (window / 2U); size *= 4U) {
+		if (op->overlap != 0U) {
+			/* Backward move over a quarter of the buffer */
+			dst = base + (size / 4U);
+		} else {
+			dst = base + (window / 2U);
+		}
+		iter = MEMBENCH_BYTES_PER_SIZE / size;
+
+		xil_bw = membench_run(op->xil, dst, src + misalign, size -
+				      misalign, iter);
+		lib_bw = membench_run(op->lib, dst, src + misalign, size -
+				      misalign, iter);
+
+		xil_printf("    %s %s %8u bytes: Xil %6u MB/s, newlib %6u MB/s\n\r",
+			   op->name, (misalign != 0U) ? "unaligned" : "aligned  ",
+			   size, xil_bw, lib_bw);
+	}
+}
+
+void run_memory_bandwidth_test(struct memory_range_s *range)
+{
+	u8 *base = (u8 *)range->base;
+	u32 window = MEMBENCH_WINDOW_SIZE;
+	u32 i;
+
+	if (range->size < window) {
+		window = (u32)range->size;
+	}
+
+	print("Memory bandwidth: ");
+	print(range->name);
+	print("\n\r");
+
+	Xil_DCacheEnable();
+	for (i = 0U; i < (sizeof(membench_ops) / sizeof(membench_ops[0])); i++) {
+		membench_sizes(&membench_ops[i], base, window, 0U);
+		membench_sizes(&membench_ops[i], base, window, 3U);
+	}
+	Xil_DCacheDisable();
+}
@@ -0,0 +1,13 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef __MEMORY_BENCH_H_
+#define __MEMORY_BENCH_H_
+
+#include "memory_config.h"
+
+void run_memory_bandwidth_test(struct memory_range_s *range);
+
+#endif
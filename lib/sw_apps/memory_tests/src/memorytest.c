@@ -13,6 +13,9 @@
 #include "platform.h"
 #include "memory_config.h"
 #include "xil_printf.h"
+#ifdef XIL_ENABLE_MEMORY_BANDWIDTH_TEST
+#include "memory_bench.h"
+#endif
 
 /*
  * memory_test.c: Test memory ranges present in the Hardware Design.
@@ -23,6 +26,10 @@
  * For MicroBlaze/PowerPC, the BSP doesn't enable caches and this application
  * enables only I-Caches. For ARM, the BSP enables caches by default, so this
  * application disables D-Caches before running memory tests.
+ *
+ * When XIL_ENABLE_MEMORY_BANDWIDTH_TEST is defined, every range that passes
+ * is also used to compare Xil_MemCpy/Xil_MemMove/Xil_MemSet against newlib,
+ * see memory_bench.c.
  */
 
 void putnum(unsigned int num);
@@ -133,6 +140,9 @@ int main()
 		if (Status == XST_FAILURE) {
 			break;
 		}
+#ifdef XIL_ENABLE_MEMORY_BANDWIDTH_TEST
+		run_memory_bandwidth_test(&memory_ranges[i]);
+#endif
 	}
 	print("--Memory Test Application Complete--\n\r");
 
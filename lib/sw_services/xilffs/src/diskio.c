@@ -71,6 +71,10 @@
 * 5.2   ap   12/05/23 Add SDT check to fix bug in disk_initialize.
 *       ap   01/11/24 Fix Doxygen warnings.
 *       sk   07/11/24 Add UFS interface support.
+* 5.4   mb   10/16/26 Split SD disk_read/disk_write requests into ADMA2
+*                     descriptor table sized commands.
+*       mb   10/16/26 The split is needed as the SD driver rejects requests
+*                     over 2MB and f_read now passes longer cluster runs.
 *
 * </pre>
 *
@@ -100,6 +104,12 @@
 
 #ifdef XPAR_XSDPS_NUM_INSTANCES
 #define SD_CD_DELAY		10000U		/**< SD card detection delay */
+/**
+ * Max blocks covered by one ADMA2 descriptor table. XSdPs_ReadPolled and
+ * XSdPs_WritePolled fail larger requests, and f_read hands over runs of
+ * contiguous clusters that can be much longer, so they are split.
+ */
+#define SD_MAX_BLK_CNT		((32U * XSDPS_DESC_MAX_LENGTH) / XSDPS_BLK_SIZE_512_MASK)
 #endif
 
 #define XSDPS_NUM_INSTANCES	2		/**< Number of SD instances */
@@ -452,6 +462,10 @@ DRESULT disk_read (
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	s32 Status = XST_FAILURE;
 	DWORD LocSector = sector;
+#ifdef XPAR_XSDPS_NUM_INSTANCES
+	BYTE *LocBuff = buff;
+	UINT Chunk;
+#endif
 #endif
 
 	s = disk_status(pdrv);
@@ -471,9 +485,21 @@ DRESULT disk_read (
 			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 		}
 
-		Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
-		if (Status != XST_SUCCESS) {
-			return RES_ERROR;
+		/*
+		 * f_read() hands over whole runs of contiguous clusters, issue
+		 * them as few multi-block commands as the ADMA2 descriptor
+		 * table allows.
+		 */
+		while (count > 0U) {
+			Chunk = (count > SD_MAX_BLK_CNT) ? SD_MAX_BLK_CNT : count;
+			Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, Chunk, LocBuff);
+			if (Status != XST_SUCCESS) {
+				return RES_ERROR;
+			}
+			LocSector += ((SdInstance[pdrv].HCS) == 0U) ?
+				     (Chunk * (DWORD)XSDPS_BLK_SIZE_512_MASK) : Chunk;
+			LocBuff += Chunk * (UINT)XSDPS_BLK_SIZE_512_MASK;
+			count -= Chunk;
 		}
 #endif
 	} else {
@@ -737,6 +763,10 @@ DRESULT disk_write (
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	s32 Status = XST_FAILURE;
 	DWORD LocSector = sector;
+#ifdef XPAR_XSDPS_NUM_INSTANCES
+	const BYTE *LocBuff = buff;
+	UINT Chunk;
+#endif
 #endif
 
 	s = disk_status(pdrv);
@@ -755,9 +785,17 @@ DRESULT disk_write (
 			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 		}
 
-		Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
-		if (Status != XST_SUCCESS) {
-			return RES_ERROR;
+		/* Split into ADMA2 descriptor table sized multi-block commands */
+		while (count > 0U) {
+			Chunk = (count > SD_MAX_BLK_CNT) ? SD_MAX_BLK_CNT : count;
+			Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector, Chunk, LocBuff);
+			if (Status != XST_SUCCESS) {
+				return RES_ERROR;
+			}
+			LocSector += ((SdInstance[pdrv].HCS) == 0U) ?
+				     (Chunk * (DWORD)XSDPS_BLK_SIZE_512_MASK) : Chunk;
+			LocBuff += Chunk * (UINT)XSDPS_BLK_SIZE_512_MASK;
+			count -= Chunk;
 		}
 #endif
 	} else {
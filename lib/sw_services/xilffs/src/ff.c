@@ -35,6 +35,8 @@
 * 5.2   sk   07/11/24 Add f_ioctl interface to perform UFS specific configs.
 *       sk   07/11/24 Update drive number calculation logic to support multiple
 *                     digit drive numbers.
+* 5.4   mb   10/16/26 Merge physically contiguous clusters into a single
+*                     disk_read() in f_read().
 ******************************************************************************/
 #include "xparameters.h"
 #include "xstatus.h"
@@ -2125,6 +2127,47 @@ static DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 
 
 
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Count clusters physically contiguous to fp->clust      */
+/*-----------------------------------------------------------------------*/
+
+static UINT contig_clust (	/* Returns number of sectors in the following contiguous clusters */
+	FIL *fp,		/* Pointer to the file object, fp->clust is moved to the last contiguous cluster */
+	FSIZE_t ofs,	/* File offset of the cluster next to fp->clust */
+	UINT nsect		/* Number of sectors wanted after fp->clust */
+)
+{
+	DWORD clst, nxt;
+	UINT cnt = 0;
+	FATFS *fs = fp->obj.fs;
+
+
+	clst = fp->clust;
+	while (nsect - cnt >= fs->csize) {	/* Only whole clusters can be merged into a direct read */
+#if FF_USE_FASTSEEK
+		if (fp->cltbl) {
+			nxt = clmt_clust(fp, ofs);	/* Get next cluster# from the CLMT */
+		}
+		else
+#endif
+		{
+			nxt = get_fat(&fp->obj, clst);	/* Follow cluster chain on the FAT */
+		}
+		if (nxt != clst + 1) {
+			break;        /* End of the fragment or error (reported on the regular path) */
+		}
+		clst = nxt;
+		cnt += fs->csize;
+		ofs += (FSIZE_t)fs->csize * SS(fs);
+	}
+	fp->clust = clst;
+
+	return cnt;
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Fill a cluster with zeros                        */
 /*-----------------------------------------------------------------------*/
@@ -4990,7 +5033,10 @@ FRESULT f_read (
 			cc = btr / SS(fs);					/* When remaining bytes >= sector size, */
 			if (cc > 0) {						/* Read maximum contiguous sectors directly */
 				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
+					UINT xc = cc - (fs->csize - csect);
+
 					cc = fs->csize - csect;
+					cc += contig_clust(fp, fp->fptr + (FSIZE_t)cc * SS(fs), xc);	/* Extend it over contiguous clusters */
 				}
 				if (disk_read(fs->pdrv, rbuff, sect, cc) != RES_OK) {
 					ABORT(fs, FR_DISK_ERR);
@@ -135,6 +135,9 @@
 *                     XLoader_ProcessAuthEncPrtn after Block 0 processing is success
 *       mb   06/30/24 Fixed AES Decryption issue when KAT is enabled
 *       kal  07/24/24 Code refactoring and updates for versal_aiepg2
+* 2.2   mb   10/16/26 Added per stage timing of secure chunk processing
+*       mb   10/16/26 Added cache of verified signatures under PLM_AUTH_CACHE
+*       mb   10/16/26 Overlap RSA and SHA3 KATs of IHT authentication
 *
 * </pre>
 *
@@ -167,8 +170,29 @@
 #endif
 
 /************************** Constant Definitions ****************************/
+#ifdef PLM_AUTH_CACHE
+#ifndef XLOADER_AUTH_CACHE_ENTRIES
+#define XLOADER_AUTH_CACHE_ENTRIES	(8U)
+		/**< Number of verified signatures remembered */
+#endif
+#endif
 
 /**************************** Type Definitions *******************************/
+#ifdef PLM_AUTH_CACHE
+typedef struct {
+	u8 Hash[XLOADER_SHA3_LEN];	/**< Digest the signature was verified on */
+	u8 KeyHash[XLOADER_SHA3_LEN];	/**< SHA3 of the public key used */
+	u32 AuthType;	/**< Public key algorithm */
+	u32 IsValid;	/**< TRUE if the entry holds a verified signature */
+} XLoader_AuthCacheEntry;
+
+typedef struct {
+	XLoader_AuthCacheEntry Entry[XLOADER_AUTH_CACHE_ENTRIES];
+		/**< Verified signatures */
+	u32 Next;	/**< Entry to be replaced next */
+} XLoader_AuthCache;
+#endif
+
 typedef struct {
 	u32 JtagTimeOut;	/**< Timeout value set by user */
 	u8 JtagTimerEnabled;	/**< Enable JTAG timer */
@@ -233,6 +257,14 @@ static int XLoader_RsaSignVerify(const XLoader_SecureParams *SecurePtr,
 #endif
 static int XLoader_VerifySignature(const XLoader_SecureParams *SecurePtr,
 	u8 *Hash, XLoader_RsaKey *Key, u8 *Signature);
+#ifdef PLM_AUTH_CACHE
+static int XLoader_AuthCacheKeyHash(u32 AuthType, const XLoader_RsaKey *Key,
+	u8 *KeyHash);
+static int XLoader_AuthCacheLookup(u32 AuthType, const u8 *Hash,
+	const u8 *KeyHash);
+static void XLoader_AuthCacheAdd(u32 AuthType, const u8 *Hash,
+	const u8 *KeyHash);
+#endif
 static int XLoader_AesDecryption(XLoader_SecureParams *SecurePtr,
 	u64 SrcAddr, u64 DestAddr, u32 Size);
 static int XLoader_AesKeySelect(const XLoader_SecureParams *SecurePtr,
@@ -263,6 +295,9 @@ static int XLoader_AuthJtag(u32 *TimeOut);
 static void XLoader_ClearKatStatusOnCfg(XilPdi *PdiPtr, u32 PlmKatMask);
 static int XLoader_AuthKat(XLoader_SecureParams *SecurePtr);
 static int XLoader_Sha3Kat(XLoader_SecureParams *SecurePtr);
+#ifndef VERSAL_AIEPG2
+static int XLoader_ImgHdrTblAuthKat(XLoader_SecureParams *SecurePtr);
+#endif
 static int XLoader_ClearAesKeysOnCfg(void);
 
 #ifdef VERSAL_AIEPG2
@@ -293,6 +328,9 @@ static int XLoader_HssSha256Kat(XLoader_SecureParams *SecurePtr);
 
 /************************** Variable Definitions *****************************/
 static XLoader_AuthJtagStatus AuthJtagStatus = {0U};
+#ifdef PLM_AUTH_CACHE
+static XLoader_AuthCache AuthCache;
+#endif
 
 /************************** Function Definitions *****************************/
 
@@ -970,6 +1008,11 @@ static int XLoader_VerifySignature(const XLoader_SecureParams *SecurePtr,
 {
 	volatile int Status = XST_FAILURE;
 	u32 AuthType;
+#ifdef PLM_AUTH_CACHE
+	volatile int StatusTmp = XST_FAILURE;
+	u8 KeyHash[XLOADER_SHA3_LEN];
+	u8 IsCacheable = (u8)FALSE;
+#endif
 
 	if (SecurePtr->AuthJtagMessagePtr != NULL) {
 		AuthType = XLoader_GetAuthPubAlgo(&(SecurePtr->AuthJtagMessagePtr->AuthHdr));
@@ -978,6 +1021,28 @@ static int XLoader_VerifySignature(const XLoader_SecureParams *SecurePtr,
 		AuthType = XLoader_GetAuthPubAlgo(&SecurePtr->AcPtr->AuthHdr);
 	}
 
+#ifdef PLM_AUTH_CACHE
+	/**
+	 * A signature already verified on the same digest with the same public
+	 * key need not be verified again. Authenticated JTAG requests are
+	 * always verified.
+	 */
+	if (SecurePtr->AuthJtagMessagePtr == NULL) {
+		Status = XLoader_AuthCacheKeyHash(AuthType, Key, KeyHash);
+		if (Status == XST_SUCCESS) {
+			IsCacheable = (u8)TRUE;
+			XSECURE_TEMPORAL_IMPL(Status, StatusTmp, XLoader_AuthCacheLookup,
+				AuthType, Hash, KeyHash);
+			if ((Status == XST_SUCCESS) && (StatusTmp == XST_SUCCESS)) {
+				XPlmi_Printf(DEBUG_DETAILED, "Signature found in "
+					"authentication cache\n\r");
+				goto END;
+			}
+		}
+		Status = XST_FAILURE;
+	}
+#endif
+
 	/* RSA authentication */
 	if (AuthType ==	XLOADER_PUB_STRENGTH_RSA_4096) {
 #ifndef PLM_RSA_EXCLUDE
@@ -1030,11 +1095,148 @@ static int XLoader_VerifySignature(const XLoader_SecureParams *SecurePtr,
 	(void)Key;
 	(void)Signature;
 #endif
+#ifdef PLM_AUTH_CACHE
+	if ((IsCacheable == (u8)TRUE) && (Status == XST_SUCCESS)) {
+		XLoader_AuthCacheAdd(AuthType, Hash, KeyHash);
+	}
+#endif
+
+END:
+	return Status;
+}
+
+#ifdef PLM_AUTH_CACHE
+/*****************************************************************************/
+/**
+* @brief	This function calculates the SHA3-384 digest of the part of the
+*		public key used by the signature verification of the given
+*		authentication type.
+*
+* @param	AuthType is the public key algorithm
+* @param	Key is pointer to the RSA/ECDSA public key
+* @param	KeyHash is pointer to the buffer to store the digest
+*
+* @return
+* 			- XST_SUCCESS on success.
+* 			- XST_FAILURE on unsupported authentication type.
+* 			- Error code from SHA on failure.
+*
+******************************************************************************/
+static int XLoader_AuthCacheKeyHash(u32 AuthType, const XLoader_RsaKey *Key,
+	u8 *KeyHash)
+{
+	int Status = XST_FAILURE;
+	XSecure_Sha *ShaInstPtr = XSecure_GetSha3Instance(XSECURE_SHA_0_DEVICE_ID);
+	u32 KeySize;
+
+	if (AuthType == XLOADER_PUB_STRENGTH_RSA_4096) {
+		/* Modulus, modulus extension and exponent */
+		KeySize = (XLOADER_RSA_4096_KEY_SIZE * 2U) + XIH_PRTN_WORD_LEN;
+	}
+	else if (AuthType == XLOADER_PUB_STRENGTH_ECDSA_P384) {
+		/* Qx and Qy */
+		KeySize = XLOADER_ECDSA_P384_KEYSIZE * 2U;
+	}
+	else if (AuthType == XLOADER_PUB_STRENGTH_ECDSA_P521) {
+		KeySize = XLOADER_ECDSA_P521_KEYSIZE * 2U;
+	}
+	else {
+		goto END;
+	}
+
+	Status = XSecure_ShaDigest(ShaInstPtr, XSECURE_SHA3_384,
+		(u64)(UINTPTR)Key->PubModulus, KeySize, (u64)(UINTPTR)KeyHash,
+		XLOADER_SHA3_LEN);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief	This function searches the authentication cache for a signature
+*		verified earlier on the same digest with the same public key.
+*
+* @param	AuthType is the public key algorithm
+* @param	Hash is pointer to the digest to be verified
+* @param	KeyHash is pointer to the SHA3-384 digest of the public key
+*
+* @return
+* 			- XST_SUCCESS if a matching entry is found.
+* 			- XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int XLoader_AuthCacheLookup(u32 AuthType, const u8 *Hash,
+	const u8 *KeyHash)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int StatusTmp = XST_FAILURE;
+	const XLoader_AuthCacheEntry *EntryPtr;
+	u32 Index;
+
+	for (Index = 0U; Index < XLOADER_AUTH_CACHE_ENTRIES; ++Index) {
+		EntryPtr = &AuthCache.Entry[Index];
+		if ((EntryPtr->IsValid != (u32)TRUE) ||
+			(EntryPtr->AuthType != AuthType)) {
+			continue;
+		}
+		XSECURE_TEMPORAL_IMPL(Status, StatusTmp, Xil_SMemCmp_CT, Hash,
+			XLOADER_SHA3_LEN, EntryPtr->Hash, XLOADER_SHA3_LEN,
+			XLOADER_SHA3_LEN);
+		if ((Status != XST_SUCCESS) || (StatusTmp != XST_SUCCESS)) {
+			continue;
+		}
+		XSECURE_TEMPORAL_IMPL(Status, StatusTmp, Xil_SMemCmp_CT, KeyHash,
+			XLOADER_SHA3_LEN, EntryPtr->KeyHash, XLOADER_SHA3_LEN,
+			XLOADER_SHA3_LEN);
+		if ((Status == XST_SUCCESS) && (StatusTmp == XST_SUCCESS)) {
+			goto END;
+		}
+	}
+	Status = XST_FAILURE;
 
 END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief	This function records a successfully verified signature in the
+*		authentication cache, replacing the oldest entry when full.
+*
+* @param	AuthType is the public key algorithm
+* @param	Hash is pointer to the verified digest
+* @param	KeyHash is pointer to the SHA3-384 digest of the public key
+*
+* @return	None
+*
+******************************************************************************/
+static void XLoader_AuthCacheAdd(u32 AuthType, const u8 *Hash,
+	const u8 *KeyHash)
+{
+	XLoader_AuthCacheEntry *EntryPtr = &AuthCache.Entry[AuthCache.Next];
+	int Status;
+
+	EntryPtr->IsValid = (u32)FALSE;
+	Status = Xil_SMemCpy(EntryPtr->Hash, XLOADER_SHA3_LEN, Hash,
+		XLOADER_SHA3_LEN, XLOADER_SHA3_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = Xil_SMemCpy(EntryPtr->KeyHash, XLOADER_SHA3_LEN, KeyHash,
+		XLOADER_SHA3_LEN, XLOADER_SHA3_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	EntryPtr->AuthType = AuthType;
+	EntryPtr->IsValid = (u32)TRUE;
+	AuthCache.Next = (AuthCache.Next + 1U) % XLOADER_AUTH_CACHE_ENTRIES;
+
+END:
+	return;
+}
+#endif
+
 /*****************************************************************************/
 /**
 * @brief	This function validates SPK by verifying if the given SPK ID
@@ -3323,6 +3525,7 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 	u64 ProcessTimeEnd;
 	static u64 ProcessTime;
 	XPlmi_PerfTime PerfTime;
+	u64 StageStart;
 #endif
 	u32 PcrInfo = SecurePtr->PdiPtr->MetaHdr.ImgHdr[SecurePtr->PdiPtr->ImageNum].PcrInfo;
 
@@ -3380,9 +3583,16 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 
 #ifndef VERSAL_AIEPG2
 		/** - Verify hash */
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+		StageStart = XPlmi_GetTimerValue();
+#endif
 		XSECURE_TEMPORAL_CHECK(END, Status,
 					XLoader_VerifyAuthHashNUpdateNext,
 					SecurePtr, TotalSize, Last);
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+		XLoader_SecureStageUpdate(SecurePtr, XLOADER_SECURE_STAGE_HASH,
+			StageStart);
+#endif
 #endif
 		if (((SecurePtr->IsEncrypted != (u8)TRUE) &&
 			(SecureTempParams->IsEncrypted != (u8)TRUE)) &&
@@ -3418,8 +3628,15 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 			}
 
 			/** Verify hash on the data */
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+			StageStart = XPlmi_GetTimerValue();
+#endif
 			XSECURE_TEMPORAL_CHECK(END, Status, XLoader_VerifyHashNUpdateNext,
 			SecurePtr, SecurePtr->SecureData, SecurePtr->SecureDataLen, Last);
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+			XLoader_SecureStageUpdate(SecurePtr, XLOADER_SECURE_STAGE_HASH,
+				StageStart);
+#endif
 #endif
 
 		}
@@ -3430,6 +3647,9 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 		else {
 			OutAddr = SecurePtr->SecureData;
 		}
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+		StageStart = XPlmi_GetTimerValue();
+#endif
 		Status = XLoader_AesDecryption(SecurePtr,
 					SecurePtr->SecureData,
 					OutAddr,
@@ -3439,6 +3659,10 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 					XLOADER_ERR_PRTN_DECRYPT_FAIL, Status);
 			goto END;
 		}
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+		XLoader_SecureStageUpdate(SecurePtr, XLOADER_SECURE_STAGE_DECRYPT,
+			StageStart);
+#endif
 	}
 
 	XPlmi_Printf(DEBUG_INFO, "Authentication/Decryption of Block %u is "
@@ -3477,6 +3701,7 @@ END:
 			     "%u.%03u ms Secure Processing time\n\r",
 			     (u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
 		ProcessTime = 0U;
+		XLoader_SecurePrintStages(SecurePtr);
 	}
 #endif
 	/* Clears whole intermediate buffers on failure */
@@ -4979,6 +5204,86 @@ END:
 
 #ifndef VERSAL_AIEPG2
 
+/*****************************************************************************/
+/**
+* @brief	This function runs the KATs needed to authenticate the image
+*		header table. For RSA authenticated PDIs the RSA KAT is started
+*		on the RSA core first and the SHA3 KAT runs on the SHA3 engine
+*		while the RSA core is busy. KATs of the other crypto engines are
+*		run on their first use.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+*
+* @return	XST_SUCCESS on success and error code on failure
+*
+******************************************************************************/
+static int XLoader_ImgHdrTblAuthKat(XLoader_SecureParams *SecurePtr)
+{
+	volatile int Status = XST_FAILURE;
+	u64 KatTime = XPlmi_GetTimerValue();
+	XPlmi_PerfTime PerfTime;
+#ifndef PLM_RSA_EXCLUDE
+	volatile int RsaStatus = XST_FAILURE;
+	volatile int RsaStatusTmp = XST_FAILURE;
+	XSecure_Rsa RsaInstance;
+	u32 RsaKatStarted = (u32)FALSE;
+
+	/**
+	 * - Start the RSA KAT if the PDI is RSA authenticated and the KAT is
+	 *   not run yet
+	 */
+	if (XLoader_GetAuthPubAlgo(&SecurePtr->AcPtr->AuthHdr) ==
+		XLOADER_PUB_STRENGTH_RSA_4096) {
+		XLoader_ClearKatOnPPDI(SecurePtr->PdiPtr, XPLMI_SECURE_RSA_KAT_MASK);
+		if ((SecurePtr->PdiPtr->PlmKatStatus & XPLMI_SECURE_RSA_KAT_MASK) == 0U) {
+			XPLMI_HALT_BOOT_SLD_TEMPORAL_CHECK(XLOADER_ERR_KAT_FAILED, RsaStatus,
+				RsaStatusTmp, XLoader_RsaKatStart, SecurePtr->PmcDmaInstPtr,
+				&RsaInstance);
+			if (RsaStatus != XST_SUCCESS) {
+				XPlmi_Printf(DEBUG_INFO, "RSA KAT Failed\n\r");
+				Status = XLoader_UpdateMinorErr(XLOADER_SEC_KAT_FAILED_ERROR,
+					RsaStatus);
+				goto END;
+			}
+			RsaKatStarted = (u32)TRUE;
+		}
+	}
+#endif
+
+	/** - Run the SHA3 KAT while the RSA core is busy */
+	Status = XLoader_Sha3Kat(SecurePtr);
+
+#ifndef PLM_RSA_EXCLUDE
+	/**
+	 * - Collect the RSA KAT result, also when the SHA3 KAT failed so that
+	 *   the RSA core is released
+	 */
+	if (RsaKatStarted == (u32)TRUE) {
+		XPLMI_HALT_BOOT_SLD_TEMPORAL_CHECK(XLOADER_ERR_KAT_FAILED, RsaStatus,
+			RsaStatusTmp, XLoader_RsaKatFinish, &RsaInstance);
+		if (RsaStatus != XST_SUCCESS) {
+			XPlmi_Printf(DEBUG_INFO, "RSA KAT Failed\n\r");
+			Status = XLoader_UpdateMinorErr(XLOADER_SEC_KAT_FAILED_ERROR,
+				RsaStatus);
+			goto END;
+		}
+		SecurePtr->PdiPtr->PlmKatStatus |= XPLMI_SECURE_RSA_KAT_MASK;
+
+		/* Update KAT status */
+		XPlmi_UpdateKatStatus(SecurePtr->PdiPtr->PlmKatStatus);
+	}
+#endif
+
+END:
+	XPlmi_MeasurePerfTime(KatTime, &PerfTime);
+	XPlmi_Printf(DEBUG_PRINT_PERF,
+		"%u.%03u ms: KATs for IHT authentication, pending till first use: 0x%x\n\r",
+		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac,
+		XPLMI_KAT_MASK & ~(SecurePtr->PdiPtr->PlmKatStatus));
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 * @brief	This function authenticates the image header table
@@ -5039,9 +5344,10 @@ int XLoader_ImgHdrTblAuth(XLoader_SecureParams *SecurePtr)
 		goto END;
 	}
 
-	Status = XLoader_Sha3Kat(SecurePtr);
+	/** - Run the KATs needed for IHT authentication */
+	Status = XLoader_ImgHdrTblAuthKat(SecurePtr);
 	if (Status != XST_SUCCESS) {
-		XPlmi_Printf(DEBUG_INFO, "SHA3 KAT failed\n\r");
+		XPlmi_Printf(DEBUG_INFO, "KAT failed\n\r");
 		Status = XPlmi_UpdateStatus(XLOADER_ERR_KAT_FAILED, Status);
 		goto END;
 	}
@@ -61,6 +61,8 @@
 *       am   03/02/24 Added XLOADER_OPTIMIZED_AUTH_CERT_MIN_SIZE macro
 *       har  03/05/24 Fixed doxygen warnings
 *       kpt  03/15/24 Updated RSA KAT to use 2048-bit key
+* 2.2   mb   10/16/26 Added timing of the secure chunk processing stages, no
+*                     functional change
 *
 * </pre>
 *
@@ -429,6 +431,20 @@ extern "C" {
 	/**< Hash algorithm type SHA3-384 */
 
 #endif
+
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+/**
+ * @name  Stages of secure chunk processing
+ * @{
+ */
+/**< Stages of secure chunk processing whose time is measured */
+#define XLOADER_SECURE_STAGE_COPY	(0U) /**< Waiting for the chunk copy */
+#define XLOADER_SECURE_STAGE_HASH	(1U) /**< Hash verification */
+#define XLOADER_SECURE_STAGE_DECRYPT	(2U) /**< AES decryption */
+#define XLOADER_SECURE_STAGE_MAX	(3U) /**< Number of stages */
+/** @} */
+#endif
+
 /**************************** Type Definitions *******************************/
 /**< RSA Key */
 typedef struct {
@@ -588,6 +604,11 @@ typedef struct XLoader_SecureParams {
 #endif
 	XSecure_ShaMode SignHashAlgo; /**< Hash algorithm used for signature */
 	u32 HashDigestLen; /**< Hash output size in bytes */
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+	u64 StageTime[XLOADER_SECURE_STAGE_MAX]; /**< Time spent per stage */
+	u32 CopyStartedBlocks;	/**< Blocks whose copy was already started
+				  *  by XLoader_StartNextChunkCopy */
+#endif
 } XLoader_SecureParams;
 
 /* To reduce stack usage, instances of XLoader_AuthCertificate and XPufData
@@ -42,6 +42,8 @@
 *       sk   02/26/2024 Added support for Infineon OSPI flash part
 *       ng   03/05/2024 Added support for Macronix OSPI 2G flash part
 *       sk   03/16/2024 Added support for Spansion Die config
+* 1.07  mb   10/16/2026 Select the flash read command once per init and
+*                       report OSPI read throughput with PLM_PRINT_PERF_DMA
 *
 * </pre>
 *
@@ -66,6 +68,25 @@
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+/**< Read command used by XLoader_OspiCopy for the current flash mode */
+typedef struct {
+	u8 Opcode;	/**< Read opcode */
+	u8 ExtendedOpcode;	/**< Second opcode byte in dual byte mode */
+	u8 Proto;	/**< Read protocol */
+	u8 Dummy;	/**< Dummy cycles */
+} XLoader_OspiReadCmd;
+
+#ifdef PLM_PRINT_PERF_DMA
+/**< OSPI read throughput accounting */
+typedef struct {
+	u64 Bytes;	/**< Bytes read since init */
+	u64 Time;	/**< Timer ticks spent in reads since init */
+	u64 XfrStart;	/**< Start time of the non blocking read in progress */
+	u32 XfrSrcAddr;	/**< Flash address of the non blocking read */
+	u32 XfrLen;	/**< Length of the non blocking read */
+	u64 XfrDestAddr;	/**< Destination of the non blocking read */
+} XLoader_OspiPerf;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -74,11 +95,21 @@ static int FlashReadID(XOspiPsv *OspiPsvPtr);
 static int XLoader_FlashEnterExit4BAddMode(XOspiPsv *OspiPsvPtr, u32 Enable);
 static int XLoader_FlashSetDDRMode(XOspiPsv *OspiPsvPtr);
 static int XLoader_SpansionSetEccMode(XOspiPsv *OspiPsvPtr);
+static void XLoader_OspiSetReadCmd(const XOspiPsv *OspiPsvPtr);
+#ifdef PLM_PRINT_PERF_DMA
+static u32 XLoader_OspiMBps(u64 Bytes, const XPlmi_PerfTime *PerfTime);
+static void XLoader_OspiPerfUpdate(u64 StartTime, u32 SrcAddr, u64 DestAddr,
+	u32 Length);
+#endif
 
 /************************** Variable Definitions *****************************/
 static XOspiPsv OspiPsvInstance;
 static u8 OspiFlashMake;
 static u32 OspiFlashSize = 0U;
+static XLoader_OspiReadCmd OspiReadCmd;
+#ifdef PLM_PRINT_PERF_DMA
+static XLoader_OspiPerf OspiPerf;
+#endif
 
 #ifdef VERSAL_NET
 static FlashInfo FlashConfigTable[] = {
@@ -514,10 +545,76 @@ END1:
 	}
 	XLoader_FlashEnterExit4BAddMode(&OspiPsvInstance, TRUE);
 
+	/**
+	 * - Select the read command for the mode the flash ended up in.
+	 */
+	XLoader_OspiSetReadCmd(&OspiPsvInstance);
+#ifdef PLM_PRINT_PERF_DMA
+	OspiPerf.Bytes = 0U;
+	OspiPerf.Time = 0U;
+#endif
+
 END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function selects the read command used by XLoader_OspiCopy.
+ * 			Octal DDR reads are used whenever the controller and flash were
+ * 			switched to DDR PHY mode, otherwise SDR reads are used.
+ *
+ * @param	OspiPsvPtr is a pointer to the OSPIPSV instance.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XLoader_OspiSetReadCmd(const XOspiPsv *OspiPsvPtr)
+{
+	OspiReadCmd.Opcode = READ_CMD_OCTAL_4B;
+
+	if (OspiPsvPtr->SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY) {
+		OspiReadCmd.Proto = XOSPIPSV_READ_8_8_8;
+		if (OspiFlashMake == MACRONIX_OCTAL_ID_BYTE0) {
+			OspiReadCmd.Dummy = XLOADER_MACRONIX_OSPI_DDR_DUMMY_CYCLES +
+				OspiPsvPtr->Extra_DummyCycle;
+			OspiReadCmd.Opcode = READ_CMD_OPI_MX;
+		}
+		else if (OspiFlashMake == SPANSION_OCTAL_ID_BYTE0) {
+			OspiReadCmd.Dummy = XLOADER_SPANSION_OSPI_DDR_DUMMY_CYCLES;
+			OspiReadCmd.Opcode = READ_CMD_OPI_SPN;
+		}
+		else {
+			OspiReadCmd.Dummy = XLOADER_OSPI_DDR_DUMMY_CYCLES +
+				OspiPsvPtr->Extra_DummyCycle;
+		}
+	}
+	else {
+		if (OspiFlashMake == MACRONIX_OCTAL_ID_BYTE0) {
+			OspiReadCmd.Dummy = OspiPsvPtr->Extra_DummyCycle;
+			OspiReadCmd.Opcode = READ_CMD_4B;
+			OspiReadCmd.Proto = XOSPIPSV_READ_1_1_1;
+		}
+		else {
+			OspiReadCmd.Dummy = XLOADER_OSPI_SDR_DUMMY_CYCLES +
+				OspiPsvPtr->Extra_DummyCycle;
+			OspiReadCmd.Proto = XOSPIPSV_READ_1_1_8;
+		}
+	}
+
+	OspiReadCmd.ExtendedOpcode = 0U;
+	if (OspiPsvPtr->DualByteOpcodeEn == XOSPIPSV_DUAL_BYTE_OP_ENABLE) {
+		OspiReadCmd.ExtendedOpcode = (u8)(~OspiReadCmd.Opcode);
+	}
+	else if (OspiPsvPtr->DualByteOpcodeEn == XOSPIPSV_DUAL_BYTE_OP_SAME) {
+		OspiReadCmd.ExtendedOpcode = OspiReadCmd.Opcode;
+	}
+
+	XLoader_Printf(DEBUG_INFO, "OSPI read opcode 0x%x, %s\n\r",
+		OspiReadCmd.Opcode, (OspiReadCmd.Proto == XOSPIPSV_READ_8_8_8) ?
+		"octal DDR" : "SDR");
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to copy the data from OSPI flash to
@@ -548,13 +645,9 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	u32 TrfLen;
 	u32 FlagsTmp;
 	u8 OspiMode = OspiPsvInstance.Config.ConnectionMode;
-	u8 ReadCmd = READ_CMD_OCTAL_4B;
-	u8 Proto;
-	u8 Dummy;
 	static u8 ChipSelect = XOSPIPSV_SELECT_FLASH_CS0;
 #ifdef PLM_PRINT_PERF_DMA
 	u64 OspiCopyTime = XPlmi_GetTimerValue();
-	XPlmi_PerfTime PerfTime = {0U};
 #endif
 
 	XLoader_Printf(DEBUG_INFO, "OSPI Reading Src 0x%0x, Dest 0x%0x%08x, "
@@ -569,7 +662,12 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 		do {
 			Status = (int)XOspiPsv_CheckDmaDone(&OspiPsvInstance);
 		} while (Status != XST_SUCCESS);
-		goto END1;
+#ifdef PLM_PRINT_PERF_DMA
+		/* Account the non blocking read from the time it was started */
+		XLoader_OspiPerfUpdate(OspiPerf.XfrStart, OspiPerf.XfrSrcAddr,
+			OspiPerf.XfrDestAddr, OspiPerf.XfrLen);
+#endif
+		goto END;
 	}
 	FlagsTmp = Flags;
 	/**
@@ -653,45 +751,11 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 		FlashMsg.Xfer64bit = 1U;
 	}
 
-	if (OspiPsvInstance.SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY) {
-		Proto = XOSPIPSV_READ_8_8_8;
-		if (OspiFlashMake == MACRONIX_OCTAL_ID_BYTE0) {
-			Dummy = XLOADER_MACRONIX_OSPI_DDR_DUMMY_CYCLES +
-				OspiPsvInstance.Extra_DummyCycle;
-			ReadCmd = READ_CMD_OPI_MX;
-		}
-		else if (OspiFlashMake == SPANSION_OCTAL_ID_BYTE0) {
-			Dummy = XLOADER_SPANSION_OSPI_DDR_DUMMY_CYCLES;
-			ReadCmd = READ_CMD_OPI_SPN;
-		}
-		else {
-			Dummy = XLOADER_OSPI_DDR_DUMMY_CYCLES +
-				OspiPsvInstance.Extra_DummyCycle;
-		}
-	}
-	else {
-		if (OspiFlashMake == MACRONIX_OCTAL_ID_BYTE0) {
-			Dummy = OspiPsvInstance.Extra_DummyCycle;
-			ReadCmd = READ_CMD_4B;
-			Proto = XOSPIPSV_READ_1_1_1;
-		}
-		else {
-			Dummy = XLOADER_OSPI_SDR_DUMMY_CYCLES +
-				OspiPsvInstance.Extra_DummyCycle;
-			Proto = XOSPIPSV_READ_1_1_8;
-		}
-	}
-
-	FlashMsg.Opcode = ReadCmd;
-	FlashMsg.Proto = Proto;
-	FlashMsg.Dummy = Dummy;
+	FlashMsg.Opcode = OspiReadCmd.Opcode;
+	FlashMsg.ExtendedOpcode = OspiReadCmd.ExtendedOpcode;
+	FlashMsg.Proto = OspiReadCmd.Proto;
+	FlashMsg.Dummy = OspiReadCmd.Dummy;
 
-	if (OspiPsvInstance.DualByteOpcodeEn == 1U) {
-		FlashMsg.ExtendedOpcode = (u8)(~FlashMsg.Opcode);
-	}
-	else if (OspiPsvInstance.DualByteOpcodeEn == 2U) {
-		FlashMsg.ExtendedOpcode = (u8)(FlashMsg.Opcode);
-	}
 	/**
 	 * - Start the DMA Transfer operation if flag is set to non blocking copy.
 	*/
@@ -739,21 +803,16 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 			/*
 			 * Read cmd
 			 */
-			FlashMsg.Opcode = ReadCmd;
-			if (OspiPsvInstance.DualByteOpcodeEn == XOSPIPSV_DUAL_BYTE_OP_ENABLE) {
-				FlashMsg.ExtendedOpcode = (u8)(~FlashMsg.Opcode);
-			}
-			else if (OspiPsvInstance.DualByteOpcodeEn == XOSPIPSV_DUAL_BYTE_OP_SAME) {
-				FlashMsg.ExtendedOpcode = (u8)(FlashMsg.Opcode);
-			}
+			FlashMsg.Opcode = OspiReadCmd.Opcode;
+			FlashMsg.ExtendedOpcode = OspiReadCmd.ExtendedOpcode;
 			FlashMsg.Addrsize = XLOADER_OSPI_READ_ADDR_SIZE;
 			FlashMsg.Addrvalid = TRUE;
 			FlashMsg.TxBfrPtr = NULL;
 			FlashMsg.ByteCount = TrfLen;
 			FlashMsg.Flags = XOSPIPSV_MSG_FLAG_RX;
 			FlashMsg.Addr = SrcAddrLow;
-			FlashMsg.Proto = Proto;
-			FlashMsg.Dummy = Dummy;
+			FlashMsg.Proto = OspiReadCmd.Proto;
+			FlashMsg.Dummy = OspiReadCmd.Dummy;
 
 			if ((DestAddr >> 32U) == 0U) {
 				FlashMsg.RxBfrPtr = (u8*)(UINTPTR)DestAddr;
@@ -785,17 +844,78 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 
 END1:
 #ifdef	PLM_PRINT_PERF_DMA
-	XPlmi_MeasurePerfTime(OspiCopyTime, &PerfTime);
-	XPlmi_Printf(DEBUG_PRINT_PERF,
-	" %u.%03u ms OSPI Copy time: SrcAddr: 0x%08x, DestAddr: 0x%0x08x,"
-	"%u Bytes, Flags: 0x%0x\n\r",
-	(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac,
-	SrcAddrLow, (u32)(DestAddr >> 32U), (u32)DestAddr, Length, Flags);
+	if (Status == XST_SUCCESS) {
+		if (FlagsTmp == XPLMI_DEVICE_COPY_STATE_INITIATE) {
+			/* Measured when the caller waits for it to complete */
+			OspiPerf.XfrStart = OspiCopyTime;
+			OspiPerf.XfrSrcAddr = (u32)SrcAddr;
+			OspiPerf.XfrDestAddr = DestAddr;
+			OspiPerf.XfrLen = Length;
+		}
+		else {
+			XLoader_OspiPerfUpdate(OspiCopyTime, (u32)SrcAddr, DestAddr,
+				Length);
+		}
+	}
 #endif
 END:
 	return Status;
 }
 
+#ifdef PLM_PRINT_PERF_DMA
+/*****************************************************************************/
+/**
+ * @brief	This function calculates the throughput of a flash read.
+ *
+ * @param	Bytes is the number of bytes read
+ * @param	PerfTime is pointer to the time taken by the read
+ *
+ * @return	Throughput in MB/s
+ *
+ *****************************************************************************/
+static u32 XLoader_OspiMBps(u64 Bytes, const XPlmi_PerfTime *PerfTime)
+{
+	u64 TimeUs = (PerfTime->TPerfMs * 1000U) + PerfTime->TPerfMsFrac;
+	u32 MBps = 0U;
+
+	/* Bytes per microsecond is MB/s */
+	if (TimeUs != 0U) {
+		MBps = (u32)(Bytes / TimeUs);
+	}
+
+	return MBps;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the time and throughput of a completed flash
+ * 			read and adds it to the totals reported on release.
+ *
+ * @param	StartTime is the timer value read when the read was started
+ * @param	SrcAddr is the flash address of the read
+ * @param	DestAddr is the destination address of the read
+ * @param	Length is the number of bytes read
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XLoader_OspiPerfUpdate(u64 StartTime, u32 SrcAddr, u64 DestAddr,
+	u32 Length)
+{
+	XPlmi_PerfTime PerfTime = {0U};
+
+	OspiPerf.Time += StartTime - XPlmi_GetTimerValue();
+	OspiPerf.Bytes += Length;
+	XPlmi_MeasurePerfTime(StartTime, &PerfTime);
+	XPlmi_Printf(DEBUG_PRINT_PERF,
+		" %u.%03u ms OSPI Copy time: SrcAddr: 0x%08x, DestAddr: 0x%0x%08x, "
+		"%u Bytes, %u MB/s\n\r",
+		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac, SrcAddr,
+		(u32)(DestAddr >> 32U), (u32)DestAddr, Length,
+		XLoader_OspiMBps(Length, &PerfTime));
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This API enters the flash device into 4 bytes addressing mode.
@@ -1129,6 +1249,15 @@ END:
 int XLoader_OspiRelease(void)
 {
 	int Status = XST_FAILURE;
+#ifdef PLM_PRINT_PERF_DMA
+	XPlmi_PerfTime PerfTime = {0U};
+
+	XPlmi_MeasurePerfTime(XPlmi_GetTimerValue() + OspiPerf.Time, &PerfTime);
+	XPlmi_Printf(DEBUG_PRINT_PERF, " %u.%03u ms OSPI read time: %u KB, "
+		"%u MB/s\n\r", (u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac,
+		(u32)(OspiPerf.Bytes >> 10U),
+		XLoader_OspiMBps(OspiPerf.Bytes, &PerfTime));
+#endif
 
 	/**
 	 * - Request the OSPI driver to release the device.
@@ -127,6 +127,8 @@
 *                     and trying to do secure boot
 * 2.1   kpt  12/13/23 Reset PMC TRNG when exception occurs
 *       ng   01/28/24 u8 variables optimization
+* 2.2   mb   10/16/26 Added timing of the secure chunk processing stages, no
+*                     functional change
 *
 * </pre>
 *
@@ -646,6 +648,7 @@ static int XLoader_ProcessChecksumPrtn(XLoader_SecureParams *SecurePtr,
 	u64 ProcessTimeEnd;
 	static u64 ProcessTime;
 	XPlmi_PerfTime PerfTime;
+	u64 StageStart;
 #endif
 
 	XPlmi_Printf(DEBUG_INFO,
@@ -696,8 +699,15 @@ static int XLoader_ProcessChecksumPrtn(XLoader_SecureParams *SecurePtr,
 		DataAddr = DestAddr;
 	}
 	/** Verify hash on the data */
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+	StageStart = XPlmi_GetTimerValue();
+#endif
 	XSECURE_TEMPORAL_CHECK(END, Status, XLoader_VerifyHashNUpdateNext,
 		SecurePtr, DataAddr, SecurePtr->SecureDataLen, Last);
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+	XLoader_SecureStageUpdate(SecurePtr, XLOADER_SECURE_STAGE_HASH,
+		StageStart);
+#endif
 
 	SecurePtr->NextBlkAddr = SrcAddr + TotalSize;
 	SecurePtr->ProcessedLen = TotalSize;
@@ -714,6 +724,7 @@ END:
 			     "%u.%03u ms Secure Processing time\n\r",
 			     (u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
 		ProcessTime = 0U;
+		XLoader_SecurePrintStages(SecurePtr);
 	}
 #endif
 	return Status;
@@ -742,10 +753,16 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 {
 	int Status = XST_FAILURE;
 	u32 Flags = XPLMI_DEVICE_COPY_STATE_BLK;
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+	u64 StageStart = XPlmi_GetTimerValue();
+#endif
 
 	if (SecurePtr->IsNextChunkCopyStarted == (u8)TRUE) {
 		SecurePtr->IsNextChunkCopyStarted = (u8)FALSE;
 		Flags = XPLMI_DEVICE_COPY_STATE_WAIT_DONE;
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+		SecurePtr->CopyStartedBlocks++;
+#endif
 	}
 
 	/**
@@ -759,6 +776,10 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 				XLOADER_ERR_DATA_COPY_FAIL, Status);
 		goto END;
 	}
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+	XLoader_SecureStageUpdate(SecurePtr, XLOADER_SECURE_STAGE_COPY,
+		StageStart);
+#endif
 
 	/**
 	 * - The following initialization is crucial as the authentication
@@ -782,6 +803,62 @@ END:
 	return Status;
 }
 
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+/*****************************************************************************/
+/**
+* @brief	This function adds the time elapsed since StartTime to a stage of
+*			secure chunk processing
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+* @param	Stage is the stage, XLOADER_SECURE_STAGE_*
+* @param	StartTime is the timer value read when the stage started
+*
+******************************************************************************/
+void XLoader_SecureStageUpdate(XLoader_SecureParams *SecurePtr, u32 Stage,
+	u64 StartTime)
+{
+	/* PIT counts down */
+	SecurePtr->StageTime[Stage] += StartTime - XPlmi_GetTimerValue();
+}
+
+/*****************************************************************************/
+/**
+* @brief	This function prints the time spent in each stage of secure chunk
+*			processing for the partition and the share of each stage,
+*			and the number of blocks whose copy was already started.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+*
+******************************************************************************/
+void XLoader_SecurePrintStages(const XLoader_SecureParams *SecurePtr)
+{
+	static const char *StageName[XLOADER_SECURE_STAGE_MAX] = {
+		"Copy wait", "Hash", "Decrypt"
+	};
+	XPlmi_PerfTime PerfTime;
+	u64 Total = 0U;
+	u32 Stage;
+
+	for (Stage = 0U; Stage < XLOADER_SECURE_STAGE_MAX; Stage++) {
+		Total += SecurePtr->StageTime[Stage];
+	}
+	if (Total == 0U) {
+		Total = 1U;
+	}
+
+	for (Stage = 0U; Stage < XLOADER_SECURE_STAGE_MAX; Stage++) {
+		XPlmi_MeasurePerfTime(XPlmi_GetTimerValue() +
+			SecurePtr->StageTime[Stage], &PerfTime);
+		XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms %s time (%u%%)\n\r",
+			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac,
+			StageName[Stage],
+			(u32)((SecurePtr->StageTime[Stage] * 100U) / Total));
+	}
+	XPlmi_Printf(DEBUG_PRINT_PERF, "%u of %u blocks with copy started\n\r",
+		SecurePtr->CopyStartedBlocks, SecurePtr->BlockNum);
+}
+#endif
+
 /*****************************************************************************/
 /**
 * @brief	This function checks if PPK is programmed.
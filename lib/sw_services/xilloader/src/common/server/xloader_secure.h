@@ -59,6 +59,8 @@
 *       bsv  02/11/22 Code optimization to reduce text size
 *       kpt  02/18/22 Removed Flags param from XLoader_SecureInit function prototype
 * 1.08  dc   07/12/22 Moved error codes related to buffer clear to xplmi_status.h
+* 2.2   mb   10/16/26 Added timing of the secure chunk processing stages, no
+*                     functional change
 *
 * </pre>
 *
@@ -124,6 +126,11 @@ int XLoader_SetSecureState(void);
 XLoader_SecureTempParams* XLoader_GetTempParams(void);
 int XLoader_VerifyHashNUpdateNext(XLoader_SecureParams *SecurePtr,
         u64 DataAddr, u32 Size, u8 Last);
+#ifdef PLM_PRINT_PERF_CDO_PROCESS
+void XLoader_SecureStageUpdate(XLoader_SecureParams *SecurePtr, u32 Stage,
+	u64 StartTime);
+void XLoader_SecurePrintStages(const XLoader_SecureParams *SecurePtr);
+#endif
 
 #ifdef __cplusplus
 }
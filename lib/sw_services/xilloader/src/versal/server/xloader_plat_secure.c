@@ -39,6 +39,7 @@
 * 2.1   pre  01/11/2024 Removed unused macro
 *       ng   02/01/2024 u8 variables optimization
 *       sk   03/13/24 Fixed doxygen comments format
+* 2.2   mb   10/16/2026 Added XLoader_RsaKatStart and XLoader_RsaKatFinish
 *
 * </pre>
 *
@@ -158,6 +159,47 @@ int XLoader_RsaKat(XPmcDma *PmcDmaPtr) {
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief    This function starts the KAT for RSA. The RSA core runs the KAT
+*           operation while PLM runs the KATs of other crypto engines.
+*
+* @param    PmcDmaPtr - Pointer to DMA instance
+* @param    RsaInstPtr - Pointer to RSA instance used until the KAT is finished
+*
+* @return
+* 			- XST_SUCCESS on success and error code on failure
+*
+******************************************************************************/
+int XLoader_RsaKatStart(XPmcDma *PmcDmaPtr, XSecure_Rsa *RsaInstPtr) {
+	int Status = XST_FAILURE;
+
+	(void)PmcDmaPtr;
+
+	Status = XSecure_RsaPublicEncryptKatStart(RsaInstPtr);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief    This function waits for the RSA KAT started by XLoader_RsaKatStart
+*           and checks its result
+*
+* @param    RsaInstPtr - Pointer to RSA instance passed to XLoader_RsaKatStart
+*
+* @return
+* 			- XST_SUCCESS on success and error code on failure
+*
+******************************************************************************/
+int XLoader_RsaKatFinish(XSecure_Rsa *RsaInstPtr) {
+	int Status = XST_FAILURE;
+
+	Status = XSecure_RsaPublicEncryptKatFinish(RsaInstPtr);
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function converts a non-negative integer to an octet string of a
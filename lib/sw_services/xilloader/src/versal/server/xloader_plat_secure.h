@@ -30,6 +30,7 @@
 *       yog  02/23/2024 Added XLOADER_SEC_CURVE_NOT_SUPPORTED error
 *       am   03/02/2024 Added XLOADER_SEC_PRTN_HASH_NOT_PRESENT_IN_IHT_OP_DATA_ERR
 *                       and XLOADER_SEC_PRTN_HASH_COMPARE_FAIL_ERR enum
+* 2.2   mb   10/16/2026 Added XLoader_RsaKatStart and XLoader_RsaKatFinish
 *
 * </pre>
 *
@@ -209,6 +210,10 @@ int XLoader_RsaKat(XPmcDma *PmcDmaPtr);
 int XLoader_MaskGenFunc(XSecure_Sha3 *Sha3InstancePtr,
 	u8 * Out, u32 OutLen, u8 *Input);
 #endif
+#ifndef PLM_RSA_EXCLUDE
+int XLoader_RsaKatStart(XPmcDma *PmcDmaPtr, XSecure_Rsa *RsaInstPtr);
+int XLoader_RsaKatFinish(XSecure_Rsa *RsaInstPtr);
+#endif
 
 /************************** Variable Definitions *****************************/
 
@@ -34,6 +34,7 @@
 * 2.1   ng   02/01/2024 u8 variables optimization
 *       kpt  02/08/2024 Added support to update secure state when DAP state is changed
 *       kpt  03/15/2024 Updated RSA KAT to use 2048-bit key
+* 2.2   mb   10/16/2026 Added XLoader_RsaKatStart and XLoader_RsaKatFinish
 *
 * </pre>
 *
@@ -244,6 +245,44 @@ int XLoader_RsaKat(XPmcDma *PmcDmaPtr) {
 
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+* @brief    This function runs the KAT for RSA. RSA PSS verification uses the
+*           SHA3 engine, so the KAT is completed here and not overlapped with
+*           the KATs of other crypto engines.
+*
+* @param    PmcDmaPtr - Pointer to DMA instance
+* @param    RsaInstPtr - Pointer to RSA instance, not used
+*
+* @return   XST_SUCCESS on success and error code on failure
+*
+******************************************************************************/
+int XLoader_RsaKatStart(XPmcDma *PmcDmaPtr, XSecure_Rsa *RsaInstPtr) {
+	int Status = XST_FAILURE;
+
+	(void)RsaInstPtr;
+
+	Status = XLoader_RsaKat(PmcDmaPtr);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief    This function completes the RSA KAT. The KAT is already completed
+*           by XLoader_RsaKatStart.
+*
+* @param    RsaInstPtr - Pointer to RSA instance, not used
+*
+* @return   XST_SUCCESS
+*
+******************************************************************************/
+int XLoader_RsaKatFinish(XSecure_Rsa *RsaInstPtr) {
+	(void)RsaInstPtr;
+
+	return XST_SUCCESS;
+}
 #endif
 
 /******************************************************************************/
@@ -0,0 +1,78 @@
+#!/bin/sh
+# Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+# SPDX-License-Identifier: MIT
+#
+# Checks of the CDO Write coalescing (PLM_CDO_WRITE_COALESCE) run on the
+# simulator built with it: only runs of Write commands which stay within the
+# NPI space are executed as one DMA transfer, and coalesced writes are still
+# counted as commands.
+#
+# usage: check.sh <cdo_sim built with -DPLM_CDO_WRITE_COALESCE>
+
+SIM=${1:-./cdo_sim}
+CDO=$(mktemp)
+OUT=$(mktemp)
+FAIL=0
+
+trap 'rm -f "$CDO" "$OUT"' EXIT
+
+# Writes a 32 bit little endian word
+word() {
+	v=$(($1 & 0xFFFFFFFF))
+	for b in 1 2 3 4; do
+		printf "\\$(printf '%03o' $((v & 0xFF)))"
+		v=$((v >> 8))
+	done
+}
+
+# Writes a CDO of Count Write commands to consecutive addresses from Addr
+writes_cdo() {
+	len=$(($2 * 3))
+	word 4
+	word 0x004F4443
+	word 0x200
+	word $len
+	word $((~(4 + 0x004F4443 + 0x200 + len)))
+	i=0
+	while [ $i -lt $2 ]; do
+		word 0x20103
+		word $(($1 + (i * 4)))
+		word $((0x5A000000 + i))
+		i=$((i + 1))
+	done
+}
+
+# Reads a value of the report
+stat() {
+	awk -v key="$1" 'index($0, key) == 1 { print $NF == "runs)" ? $(NF - 2) : $(NF) }' "$OUT" |
+		head -n 1
+}
+
+# check <name> <addr> <count> <expected dma bytes> <expected coalesced>
+check() {
+	writes_cdo $2 $3 > "$CDO"
+	if ! "$SIM" -n 1 "$CDO" > "$OUT"; then
+		echo "FAIL $1: cdo_sim failed"
+		FAIL=1
+		return
+	fi
+	dma=$(stat "dma bytes/run")
+	cmds=$(stat "commands/run")
+	coal=$(awk '/^coalesced\/run/ { print $2 }' "$OUT")
+	if [ "$dma" != "$4" ] || [ "$coal" != "$5" ] || [ "$cmds" != "$3" ]; then
+		echo "FAIL $1: dma bytes $dma (expected $4), coalesced $coal" \
+			"(expected $5), commands $cmds (expected $3)"
+		FAIL=1
+	else
+		echo "PASS $1"
+	fi
+}
+
+check "NPI run" 0xF6000000 8 32 8
+check "below NPI" 0xF1000000 8 0 0
+check "above NPI (LPD)" 0xFF000000 8 0 0
+check "above NPI (FPD)" 0xFD000000 8 0 0
+check "run reaching the end of NPI" 0xF7FFFFF0 8 16 4
+check "run shorter than the minimum" 0xF6000000 3 0 0
+
+exit $FAIL
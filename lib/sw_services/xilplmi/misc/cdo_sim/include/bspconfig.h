@@ -0,0 +1,11 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/* BSP configuration of the CDO simulator, a MicroBlaze without PVR */
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#define MICROBLAZE_PVR_NONE
+
+#endif /* BSPCONFIG_H */
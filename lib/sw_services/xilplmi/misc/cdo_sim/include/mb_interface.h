@@ -0,0 +1,40 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mb_interface.h
+*
+* Host replacement of the MicroBlaze interface for the CDO simulator. The
+* extended address loads and stores access the simulated address space.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  mb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef MB_INTERFACE_H
+#define MB_INTERFACE_H
+
+#include "xil_types.h"
+#include "xplmi_sim.h"
+
+#define lwea(lladdr)		XPlmiSim_Read((lladdr), 32U)
+#define lbuea(lladdr)		XPlmiSim_Read((lladdr), 8U)
+#define swea(lladdr, data)	XPlmiSim_Write((lladdr), (u32)(data), 32U)
+#define sbea(lladdr, data)	XPlmiSim_Write((lladdr), (u32)(data), 8U)
+
+#define microblaze_enable_interrupts()
+#define microblaze_disable_interrupts()
+#define mtmsr(v)
+#define mfmsr()			(0U)
+
+#endif /* MB_INTERFACE_H */
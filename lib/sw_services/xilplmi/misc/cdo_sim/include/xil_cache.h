@@ -0,0 +1,14 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/* Host replacement of xil_cache.h for the CDO simulator, PMC has no cache */
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#define Xil_DCacheFlushRange(Addr, Len)
+#define Xil_DCacheInvalidateRange(Addr, Len)
+#define Xil_DCacheFlush()
+#define Xil_DCacheInvalidate()
+
+#endif /* XIL_CACHE_H */
@@ -0,0 +1,23 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/* Host replacement of xil_exception.h for the CDO simulator */
+#ifndef XIL_EXCEPTION_H
+#define XIL_EXCEPTION_H
+
+#include "xil_types.h"
+
+typedef void (*Xil_ExceptionHandler)(void *Data);
+typedef void (*XInterruptHandler)(void *InstancePtr);
+
+#define XIL_EXCEPTION_ID_FIRST		0U
+#define XIL_EXCEPTION_ID_LAST		6U
+#define XIL_EXCEPTION_ID_INT		1U
+
+#define Xil_ExceptionInit()
+#define Xil_ExceptionEnable()
+#define Xil_ExceptionDisable()
+#define Xil_ExceptionRegisterHandler(Id, Handler, Data)
+
+#endif /* XIL_EXCEPTION_H */
@@ -0,0 +1,111 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_io.h
+*
+* Host replacement of the standalone xil_io.h for the CDO simulator. All
+* register and memory accesses are routed to the simulated address space.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  mb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xplmi_sim.h"
+#include "mb_interface.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define INLINE inline
+
+static INLINE u8 Xil_In8(UINTPTR Addr)
+{
+	return (u8)XPlmiSim_Read(Addr, 8U);
+}
+
+static INLINE u16 Xil_In16(UINTPTR Addr)
+{
+	return (u16)XPlmiSim_Read(Addr, 16U);
+}
+
+static INLINE u32 Xil_In32(UINTPTR Addr)
+{
+	return XPlmiSim_Read(Addr, 32U);
+}
+
+static INLINE u64 Xil_In64(UINTPTR Addr)
+{
+	return ((u64)XPlmiSim_Read(Addr + 4U, 32U) << 32U) |
+		XPlmiSim_Read(Addr, 32U);
+}
+
+static INLINE void Xil_Out8(UINTPTR Addr, u8 Value)
+{
+	XPlmiSim_Write(Addr, Value, 8U);
+}
+
+static INLINE void Xil_Out16(UINTPTR Addr, u16 Value)
+{
+	XPlmiSim_Write(Addr, Value, 16U);
+}
+
+static INLINE void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	XPlmiSim_Write(Addr, Value, 32U);
+}
+
+static INLINE void Xil_Out64(UINTPTR Addr, u64 Value)
+{
+	XPlmiSim_Write(Addr, (u32)Value, 32U);
+	XPlmiSim_Write(Addr + 4U, (u32)(Value >> 32U), 32U);
+}
+
+static INLINE int Xil_SecureOut32(UINTPTR Addr, u32 Value)
+{
+	Xil_Out32(Addr, Value);
+	return (Xil_In32(Addr) == Value) ? XST_SUCCESS : XST_FAILURE;
+}
+
+static INLINE u16 Xil_EndianSwap16(u16 Data)
+{
+	return (u16)((Data >> 8U) | (Data << 8U));
+}
+
+static INLINE u32 Xil_EndianSwap32(u32 Data)
+{
+	return __builtin_bswap32(Data);
+}
+
+#define Xil_In16LE	Xil_In16
+#define Xil_In32LE	Xil_In32
+#define Xil_Out16LE	Xil_Out16
+#define Xil_Out32LE	Xil_Out32
+#define Xil_Htons	Xil_EndianSwap16
+#define Xil_Htonl	Xil_EndianSwap32
+#define Xil_Ntohs	Xil_EndianSwap16
+#define Xil_Ntohl	Xil_EndianSwap32
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_IO_H */
@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/* Hardware parameters of the CDO simulator, a Versal PMC */
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+
+#define XPAR_XIOMODULE_0_BASEADDR	0xF0280000U
+#define XPAR_XCSUDMA_0_BASEADDR		0xF11C0000U
+#define XPAR_XCSUDMA_1_BASEADDR		0xF11D0000U
+#define XPAR_XCFUPMC_0_BASEADDR		0xF12B0000U
+#define XPAR_XCFUPMC_MAIN_0_BASEADDR	0xF12B0000U
+#define XPAR_XCFUPMC_0_S_AXI_BASEADDR	0xF12B0000U
+
+#endif /* XPARAMETERS_H */
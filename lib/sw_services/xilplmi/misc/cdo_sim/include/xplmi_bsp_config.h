@@ -0,0 +1,24 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/*
+ * xilplmi configuration of the CDO simulator. Prints are limited to errors
+ * so that they do not distort the measurement.
+ */
+#ifndef XPLMI_BSP_CONFIG_H
+#define XPLMI_BSP_CONFIG_H
+
+#include "xparameters.h"
+
+#define PLM_DEBUG
+#define PLM_PRINT_NO_UART
+#define PLM_SEM_EXCLUDE
+#define PLM_NVM_EXCLUDE
+#define PLM_PUF_EXCLUDE
+#define PLM_OCP_EXCLUDE
+
+#define XPAR_MAX_USER_MODULES (0U)
+#define XPAR_PLM_VERSION_USER_DEFINED (0U)
+
+#endif /* XPLMI_BSP_CONFIG_H */
@@ -0,0 +1,15 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/*
+ * SysMon driver of the CDO simulator. Only the instance type is needed by
+ * xplmi_sysmon.h; the driver headers are not used, as they redefine GET_BIT
+ * of xil_util.h.
+ */
+#ifndef XSYSMONPSV_H
+#define XSYSMONPSV_H
+
+typedef struct XSysMonPsv XSysMonPsv;
+
+#endif /* XSYSMONPSV_H */
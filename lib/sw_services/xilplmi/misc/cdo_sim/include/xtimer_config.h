@@ -0,0 +1,9 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+/* Timer configuration of the CDO simulator, no timer is configured */
+#ifndef XTIMER_CONFIG_H
+#define XTIMER_CONFIG_H
+
+#endif /* XTIMER_CONFIG_H */
@@ -0,0 +1,613 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_sim.c
+*
+* This file contains the simulated address space of the host side CDO
+* simulator and the host versions of the PLM services used by the CDO
+* parser and the generic commands.
+*
+* Polls always succeed: when a polled register does not hold the expected
+* value it is forced to it and the poll is counted as forced, so that the
+* report shows how many polls would have waited on hardware. DMA transfers
+* are copies within the simulated address space; SBI transfers only count
+* the bytes, as the configuration data is consumed by the hardware.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  mb   10/16/26 First release
+*       mb   10/16/26 Added the PMC timer read by the command statistics
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "xplmi_sim.h"
+#include "xplmi.h"
+#include "xplmi_dma.h"
+#include "xplmi_generic.h"
+#include "xplmi_event_logging.h"
+#include "xplmi_ssit.h"
+#include "xplmi_sysmon.h"
+#include "xplmi_tamper.h"
+#include "xplmi_wdt.h"
+#include "xplmi_err_common.h"
+#include "xil_util.h"
+#include "xcfupmc.h"
+
+/************************** Constant Definitions *****************************/
+#define XPLMISIM_PAGE_SHIFT	(12U)
+#define XPLMISIM_PAGE_WORDS	(1024U)
+#define XPLMISIM_HASH_SIZE	(4096U)
+
+/**************************** Type Definitions *******************************/
+typedef struct XPlmiSim_Page {
+	struct XPlmiSim_Page *Next;
+	u64 PageNum;
+	u32 Data[XPLMISIM_PAGE_WORDS];
+} XPlmiSim_Page;
+
+/************************** Variable Definitions *****************************/
+u32 Xil_AssertStatus;
+static XPlmiSim_Page *PageHash[XPLMISIM_HASH_SIZE];
+static XPlmiSim_Stats Stats;
+static u32 SimVerbose;
+static u32 LpdInitialized;
+
+/************************** Function Prototypes ******************************/
+static u32 *XPlmiSim_RegPtr(u64 Addr);
+static void *XPlmiSim_HostPtr(u64 Addr);
+
+/*****************************************************************************/
+/**
+ * @brief	This function maps the PMC RAM at its device address.
+ *
+ * @return	XST_SUCCESS on success and XST_FAILURE if the address range is
+ *		not available in the host process.
+ *
+ *****************************************************************************/
+int XPlmiSim_Init(void)
+{
+	int Status = XST_FAILURE;
+	void *Ptr = mmap((void *)(UINTPTR)XPLMISIM_PMCRAM_BASEADDR,
+		XPLMISIM_PMCRAM_LEN, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+	if (Ptr != (void *)(UINTPTR)XPLMISIM_PMCRAM_BASEADDR) {
+		fprintf(stderr, "cannot map PMC RAM at 0x%08x\n",
+			XPLMISIM_PMCRAM_BASEADDR);
+		goto END;
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function clears the register file and the PMC RAM before a
+ *		new run. The statistics accumulate over the runs.
+ *
+ *****************************************************************************/
+void XPlmiSim_Reset(void)
+{
+	u32 Index;
+	XPlmiSim_Page *Page;
+
+	for (Index = 0U; Index < XPLMISIM_HASH_SIZE; Index++) {
+		while (PageHash[Index] != NULL) {
+			Page = PageHash[Index];
+			PageHash[Index] = Page->Next;
+			free(Page);
+		}
+	}
+	memset((void *)(UINTPTR)XPLMISIM_PMCRAM_BASEADDR, 0,
+		XPLMISIM_PMCRAM_LEN);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function sets the reset value of a register. It is not
+ *		counted as an access.
+ *
+ * @param	Addr is the register address
+ * @param	Value is the value of the register
+ *
+ *****************************************************************************/
+void XPlmiSim_Preload(u64 Addr, u32 Value)
+{
+	u32 *Ptr = XPlmiSim_HostPtr(Addr);
+
+	if (Ptr == NULL) {
+		Ptr = XPlmiSim_RegPtr(Addr);
+	}
+	*Ptr = Value;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the word of the register file holding an
+ *		address, allocating its page on first use.
+ *
+ * @param	Addr is the device address
+ *
+ * @return	Pointer to the word
+ *
+ *****************************************************************************/
+static u32 *XPlmiSim_RegPtr(u64 Addr)
+{
+	u64 PageNum = Addr >> XPLMISIM_PAGE_SHIFT;
+	u32 Index = (u32)((PageNum * 0x9E3779B97F4A7C15ULL) >> 52U);
+	XPlmiSim_Page *Page = PageHash[Index];
+
+	while ((Page != NULL) && (Page->PageNum != PageNum)) {
+		Page = Page->Next;
+	}
+	if (Page == NULL) {
+		Page = calloc(1U, sizeof(*Page));
+		if (Page == NULL) {
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+		Page->PageNum = PageNum;
+		Page->Next = PageHash[Index];
+		PageHash[Index] = Page;
+	}
+
+	return &Page->Data[(Addr >> 2U) & (XPLMISIM_PAGE_WORDS - 1U)];
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns a host pointer for a PMC RAM or host
+ *		address, or NULL for a register file address.
+ *
+ *****************************************************************************/
+static void *XPlmiSim_HostPtr(u64 Addr)
+{
+	void *Ptr = NULL;
+
+	if ((Addr >= XPLMISIM_HOST_ADDR_MIN) ||
+		((Addr >= XPLMISIM_PMCRAM_BASEADDR) &&
+		(Addr < (XPLMISIM_PMCRAM_BASEADDR + XPLMISIM_PMCRAM_LEN)))) {
+		Ptr = (void *)(UINTPTR)Addr;
+	}
+
+	return Ptr;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads from the simulated address space.
+ *
+ * @param	Addr is the address
+ * @param	Width is the access width in bits
+ *
+ * @return	Value read
+ *
+ *****************************************************************************/
+u32 XPlmiSim_Read(u64 Addr, u32 Width)
+{
+	u32 Value;
+	u32 Shift;
+	const u8 *Ptr = XPlmiSim_HostPtr(Addr);
+
+	if (Ptr != NULL) {
+		if (Width == 8U) {
+			Value = *Ptr;
+		} else if (Width == 16U) {
+			Value = *(const u16 *)Ptr;
+		} else {
+			Value = *(const u32 *)Ptr;
+		}
+		goto END;
+	}
+
+	++Stats.Reads;
+	Value = *XPlmiSim_RegPtr(Addr);
+	if (Width != 32U) {
+		Shift = (u32)(Addr & 0x3U) * 8U;
+		Value = (Value >> Shift) & ((1U << Width) - 1U);
+	}
+	if (SimVerbose != 0U) {
+		printf("  rd 0x%08llx = 0x%08x\n", (unsigned long long)Addr, Value);
+	}
+
+END:
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function writes to the simulated address space.
+ *
+ * @param	Addr is the address
+ * @param	Value is the value to be written
+ * @param	Width is the access width in bits
+ *
+ *****************************************************************************/
+void XPlmiSim_Write(u64 Addr, u32 Value, u32 Width)
+{
+	u32 *RegPtr;
+	u32 Shift;
+	u32 Mask;
+	u8 *Ptr = XPlmiSim_HostPtr(Addr);
+
+	if (Ptr != NULL) {
+		if (Width == 8U) {
+			*Ptr = (u8)Value;
+		} else if (Width == 16U) {
+			*(u16 *)Ptr = (u16)Value;
+		} else {
+			*(u32 *)Ptr = Value;
+		}
+		goto END;
+	}
+
+	++Stats.Writes;
+	RegPtr = XPlmiSim_RegPtr(Addr);
+	if (Width == 32U) {
+		*RegPtr = Value;
+	} else {
+		Shift = (u32)(Addr & 0x3U) * 8U;
+		Mask = ((1U << Width) - 1U) << Shift;
+		*RegPtr = (*RegPtr & ~Mask) | ((Value << Shift) & Mask);
+	}
+	if (SimVerbose != 0U) {
+		printf("  wr 0x%08llx = 0x%08x\n", (unsigned long long)Addr, Value);
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the simulator statistics.
+ *
+ *****************************************************************************/
+XPlmiSim_Stats *XPlmiSim_GetStats(void)
+{
+	return &Stats;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function enables the trace of register accesses.
+ *
+ *****************************************************************************/
+void XPlmiSim_SetVerbose(u32 Verbose)
+{
+	SimVerbose = Verbose;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function polls a register and forces the expected value if
+ *		the condition is not met.
+ *
+ *****************************************************************************/
+static void XPlmiSim_Poll(u64 Addr, u32 Mask, u32 Expected)
+{
+	u32 Value = XPlmiSim_Read(Addr, 32U);
+
+	++Stats.Polls;
+	if ((Value & Mask) != Expected) {
+		++Stats.PollsForced;
+		XPlmiSim_Write(Addr, (Value & ~Mask) | (Expected & Mask), 32U);
+	}
+}
+
+int XPlmi_UtilPoll(u32 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs,
+		void (*ClearHandler)(void))
+{
+	(void)TimeOutInUs;
+	(void)ClearHandler;
+	XPlmiSim_Poll(RegAddr, Mask, ExpectedValue);
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_UtilPoll64(u64 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs)
+{
+	(void)TimeOutInUs;
+	XPlmiSim_Poll(RegAddr, Mask, ExpectedValue);
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_UtilRMW(u32 RegAddr, u32 Mask, u32 Value)
+{
+	u32 Val = XPlmiSim_Read(RegAddr, 32U);
+
+	XPlmiSim_Write(RegAddr, (Val & ~Mask) | (Value & Mask), 32U);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	DMA transfers copy words within the simulated address space.
+ *		Len is in words, as for the PMC DMA.
+ *
+ *****************************************************************************/
+int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	u32 Index;
+	u32 Value;
+
+	for (Index = 0U; Index < Len; Index++) {
+		if ((Flags & XPLMI_SRC_CH_AXI_FIXED) != 0U) {
+			Value = XPlmiSim_Read(SrcAddr, 32U);
+		} else {
+			Value = XPlmiSim_Read(SrcAddr + (Index * 4U), 32U);
+		}
+		if ((Flags & XPLMI_DST_CH_AXI_FIXED) != 0U) {
+			XPlmiSim_Write(DestAddr, Value, 32U);
+		} else {
+			XPlmiSim_Write(DestAddr + (Index * 4U), Value, 32U);
+		}
+	}
+	Stats.DmaBytes += (u64)Len * 4U;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_DmaSbiXfer(u64 SrcAddr, u32 Len, u32 Flags)
+{
+	(void)SrcAddr;
+	(void)Flags;
+	Stats.SbiBytes += (u64)Len * 4U;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_WaitForNonBlkDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_WaitForNonBlkSrcDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_MemSet(u64 DestAddress, u32 Val, u32 Len)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		XPlmiSim_Write(DestAddress + (Index * 4U), Val, 32U);
+	}
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_MemSetBytes(void *const DestPtr, u32 DestLen, u8 Val, u32 Length)
+{
+	int Status = XST_FAILURE;
+
+	if ((DestPtr != NULL) && (DestLen >= Length)) {
+		memset(DestPtr, Val, Length);
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+s32 Xil_SMemCpy(void *Dest, const u32 DestSize, const void *Src,
+		const u32 SrcSize, const u32 CopyLen)
+{
+	s32 Status = XST_FAILURE;
+
+	if ((Dest != NULL) && (Src != NULL) && (CopyLen <= DestSize) &&
+		(CopyLen <= SrcSize)) {
+		memmove(Dest, Src, CopyLen);
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+int XPlmi_VerifyAddrRange(u64 StartAddr, u64 EndAddr)
+{
+	return (EndAddr >= StartAddr) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	The PMC buffer list is placed in PMC RAM as on the PMC, so that
+ *		the stored buffers and procs of the generic commands work.
+ *
+ *****************************************************************************/
+XPlmi_BufferList *XPlmi_GetBufferList(u32 BufferListType)
+{
+	static XPlmi_BufferList PsmBufferList = {0U};
+	static XPlmi_BufferData PsmBuffers[XPLMI_MAX_PSM_BUFFERS + 1U] = {0U};
+	static XPlmi_BufferList PmcBufferList = {0U};
+	static XPlmi_BufferData PmcBuffers[XPLMI_MAX_PMC_BUFFERS + 1U] = {0U};
+	XPlmi_BufferList *BufferList = &PsmBufferList;
+
+	PsmBufferList.Data = PsmBuffers;
+	PsmBufferList.MaxBufferCount = XPLMI_MAX_PSM_BUFFERS;
+	PmcBufferList.Data = PmcBuffers;
+	PmcBufferList.MaxBufferCount = XPLMI_MAX_PMC_BUFFERS;
+
+	if (BufferListType == XPLMI_PMC_BUFFER_LIST) {
+		BufferList = &PmcBufferList;
+		PmcBufferList.Data[0U].Addr = XPLMI_PMCRAM_BUFFER_MEMORY;
+		PmcBufferList.BufferMemSize = XPLMI_PMCRAM_BUFFER_MEMORY_LENGTH;
+		PmcBufferList.IsBufferMemAvailable = (u8)TRUE;
+	}
+
+	return BufferList;
+}
+
+XPlmi_BoardParams *XPlmi_GetBoardParams(void)
+{
+	static XPlmi_BoardParams BoardParams = {0U};
+
+	return &BoardParams;
+}
+
+u32 *XPlmi_GetLpdInitialized(void)
+{
+	return &LpdInitialized;
+}
+
+void XPlmi_GetReadbackSrcDest(u32 SlrType, u64 *SrcAddr, u64 *DestAddrRead)
+{
+	(void)SlrType;
+	*SrcAddr = (u64)CFU_FDRO_2_ADDR;
+	*DestAddrRead = (u64)CFU_STREAM_2_ADDR;
+}
+
+void XPlmi_Print(u16 DebugType, const char8 *Ctrl1, ...)
+{
+	va_list Args;
+
+	if ((DebugType & XPlmiDbgCurrentTypes) != 0U) {
+		va_start(Args, Ctrl1);
+		vprintf(Ctrl1, Args);
+		va_end(Args);
+	}
+}
+
+void XPlmi_PrintArray(u16 DebugType, const u64 BufAddr, u32 Len,
+		const char *Str)
+{
+	u32 Index;
+
+	if ((DebugType & XPlmiDbgCurrentTypes) != 0U) {
+		printf("%s START, Len:0x%08x\n", Str, Len);
+		for (Index = 0U; Index < Len; Index++) {
+			printf("0x%08x ", XPlmiSim_Read(BufAddr + (Index * 4U),
+				32U));
+		}
+		printf("\n%s END\n", Str);
+	}
+}
+
+void XPlmi_LogPlmErr(int ErrStatusVal)
+{
+	++Stats.Errors;
+	XPlmi_Printf(DEBUG_GENERAL, "PLM error 0x%08x\n", (u32)ErrStatusVal);
+}
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	fprintf(stderr, "assert %s:%d\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
+
+/*
+ * The PMC timer counts down, it is modelled by the host monotonic clock in
+ * ns, so that the command statistics (PLM_CMD_STATS) cost what they do on
+ * the device.
+ */
+u64 XPlmi_GetTimerValue(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ~(((u64)Ts.tv_sec * 1000000000U) + (u64)Ts.tv_nsec);
+}
+
+/*
+ * Services of the PLM without effect on CDO processing.
+ */
+int XPlmi_EnableWdt(u32 NodeId, u32 Periodicity)
+{
+	(void)NodeId;
+	(void)Periodicity;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_EventLogging(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_SetMaxOutCmds(u8 Val)
+{
+	(void)Val;
+}
+
+void XPlmi_SetPlmLiveStatus(void)
+{
+}
+
+u32 XPlmi_SldState(void)
+{
+	return XPLMI_SLD_NOT_TRIGGERED;
+}
+
+void XPlmi_SysMonOTDetect(u32 WaitInMSecVal)
+{
+	(void)WaitInMSecVal;
+}
+
+void XPlmi_TriggerTamperResponse(u32 Response, u32 Flag)
+{
+	(void)Response;
+	(void)Flag;
+}
+
+int XPlmi_SendIpiCmdToSlaveSlr(u32 *Payload, u32 *RespBuf)
+{
+	(void)Payload;
+	(void)RespBuf;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitCfgSecComm(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitSyncMaster(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitSyncSlaves(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitWaitSlaves(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
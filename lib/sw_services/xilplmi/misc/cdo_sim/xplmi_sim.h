@@ -0,0 +1,70 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_sim.h
+*
+* This file contains the simulated address space and statistics of the host
+* side CDO simulator.
+*
+* The PMC RAM is mapped at its device address, so that the CDO chunks and the
+* buffers kept there by the generic commands can be used through pointers as
+* on the PMC. All other device addresses are backed by a sparse register
+* file which reads zero until written. Addresses above the 44 bit device
+* address space are host pointers, e.g. to stack buffers of the command
+* handlers, and are accessed directly.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  mb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XPLMI_SIM_H
+#define XPLMI_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define XPLMISIM_PMCRAM_BASEADDR	(0xF2000000U)
+#define XPLMISIM_PMCRAM_LEN		(0x20000U)
+#define XPLMISIM_HOST_ADDR_MIN		(0x100000000000ULL)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u64 Reads;		/**< Register reads */
+	u64 Writes;		/**< Register writes */
+	u64 Polls;		/**< Mask polls */
+	u64 PollsForced;	/**< Polls whose condition had to be forced */
+	u64 DmaBytes;		/**< Bytes moved by DMA */
+	u64 SbiBytes;		/**< Bytes written to the SBI */
+	u64 Errors;		/**< Deferred errors logged */
+} XPlmiSim_Stats;
+
+/************************** Function Prototypes ******************************/
+int XPlmiSim_Init(void);
+void XPlmiSim_Reset(void);
+void XPlmiSim_Preload(u64 Addr, u32 Value);
+u32 XPlmiSim_Read(u64 Addr, u32 Width);
+void XPlmiSim_Write(u64 Addr, u32 Value, u32 Width);
+XPlmiSim_Stats *XPlmiSim_GetStats(void);
+void XPlmiSim_SetVerbose(u32 Verbose);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPLMI_SIM_H */
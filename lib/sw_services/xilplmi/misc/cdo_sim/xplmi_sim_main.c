@@ -0,0 +1,654 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_sim_main.c
+*
+* This file contains the command line front end of the host side CDO
+* simulator. The CDOs found in the input file are processed by the xilplmi
+* CDO parser and generic command handlers in chunks, the same way the loader
+* processes a non secure CDO partition, and the execution time of every
+* command is measured.
+*
+* Commands of the other modules (PM, loader, error manager, ...) are accepted
+* and skipped, so that their count and size are reported but their time is
+* only the dispatch overhead.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  mb   10/16/26 First release
+*       mb   10/16/26 Count Write commands coalesced by the CDO parser
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+#include "xplmi_sim.h"
+#include "xplmi_cdo.h"
+#include "xplmi_cmd.h"
+#include "xplmi_modules.h"
+#include "xplmi_generic.h"
+#include "xplmi_hw.h"
+#include "xplmi_dma.h"
+
+/************************** Constant Definitions *****************************/
+#define XPLMISIM_MAX_CMDS		(0x10000U)
+#define XPLMISIM_MAX_CHUNK		(0x8000U)
+#define XPLMISIM_DEF_RUNS		(10U)
+#define XPLMISIM_SINK_CMDS		(256U)
+#define XPLMISIM_CMD_ID_MASK		(0xFFFFU)
+#define XPLMISIM_NS_PER_SEC		(1000000000ULL)
+#define XPLMISIM_WRITE_CMD_ID		((XPLMI_MODULE_GENERIC_ID << \
+		XPLMI_CMD_MODULE_ID_SHIFT) | XPLMI_WRITE_CMD_ID)
+#define XPLMISIM_WRITE_CMD_WORDS	(2U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u64 Count;		/**< Executions of the command */
+	u64 Words;		/**< Payload words */
+	u64 TimeNs;		/**< Execute and resume time */
+} XPlmiSim_CmdStats;
+
+typedef struct {
+	u64 Addr;
+	u32 Value;
+} XPlmiSim_RegInit;
+
+/************************** Function Prototypes ******************************/
+int __real_XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr);
+int __real_XPlmi_CmdResume(XPlmi_Cmd *CmdPtr);
+int __wrap_XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr);
+int __wrap_XPlmi_CmdResume(XPlmi_Cmd *CmdPtr);
+int XPlmiSim_CdoDmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags);
+
+/************************** Variable Definitions *****************************/
+static XPlmiSim_CmdStats CmdStats[XPLMISIM_MAX_CMDS];
+static XPlmiSim_CmdStats BaseStats[XPLMISIM_MAX_CMDS];
+static XPlmiSim_RegInit *RegInit;
+static u32 RegInitCnt;
+static u64 CoalescedCmds;	/**< Write commands executed in runs */
+static u64 CoalescedRuns;	/**< Runs of Write commands */
+
+static const char *GenericCmdNames[] = {
+	"features", "mask_poll", "mask_write", "write", "delay", "dma_write",
+	"mask_poll64", "mask_write64", "write64", "dma_xfer", "init_seq",
+	"cfi_read", "set", "dma_write_keyhole", "ssit_sync_master",
+	"ssit_sync_slaves", "ssit_wait_slaves", "nop", "get_device_id",
+	"event_logging", "set_board", "get_board", "set_wdt_param",
+	"log_str", "log_address", "marker", "proc", "begin", "end", "break",
+	"ot_check", "psm_sequence", "inplace_plm_update", "scatter_write",
+	"scatter_write2", "tamper_trigger", "set_fips_kat_mask",
+	"set_ipi_access", "run_proc", "list_set", "list_write",
+	"list_mask_write", "list_mask_poll", "ssit_cfg_sec_comm",
+};
+
+static const char *ModuleNames[XPLMI_MAX_MODULES] = {
+	NULL, "plmi", "pm", "sem", NULL, "secure", "psm", "loader", "err",
+	NULL, "stl", "nvm", "puf", "ocp",
+};
+
+static inline u64 XPlmiSim_Now(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * XPLMISIM_NS_PER_SEC) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	Wrappers of the command dispatch, linked with --wrap, which
+ *		measure the time of every command. A command split over
+ *		chunks is executed once and resumed for every further chunk.
+ *
+ *****************************************************************************/
+int __wrap_XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
+{
+	XPlmiSim_CmdStats *Stats = &CmdStats[CmdPtr->CmdId & XPLMISIM_CMD_ID_MASK];
+	u64 Start = XPlmiSim_Now();
+	int Status = __real_XPlmi_CmdExecute(CmdPtr);
+
+	Stats->TimeNs += XPlmiSim_Now() - Start;
+	Stats->Words += CmdPtr->PayloadLen;
+	++Stats->Count;
+
+	return Status;
+}
+
+int __wrap_XPlmi_CmdResume(XPlmi_Cmd *CmdPtr)
+{
+	XPlmiSim_CmdStats *Stats = &CmdStats[CmdPtr->CmdId & XPLMISIM_CMD_ID_MASK];
+	u64 Start = XPlmiSim_Now();
+	int Status = __real_XPlmi_CmdResume(CmdPtr);
+
+	Stats->TimeNs += XPlmiSim_Now() - Start;
+	Stats->Words += CmdPtr->PayloadLen;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	DMA transfers of the CDO parser. The Makefile renames the
+ *		XPlmi_DmaXfr calls of xplmi_cdo.o to this function. The parser
+ *		only uses DMA for runs of Write commands coalesced with
+ *		PLM_CDO_WRITE_COALESCE, one word per command, so every word is
+ *		counted and timed as a Write command.
+ *
+ *****************************************************************************/
+int XPlmiSim_CdoDmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	XPlmiSim_CmdStats *Stats = &CmdStats[XPLMISIM_WRITE_CMD_ID];
+	u64 Start = XPlmiSim_Now();
+	int Status = XPlmi_DmaXfr(SrcAddr, DestAddr, Len, Flags);
+
+	Stats->TimeNs += XPlmiSim_Now() - Start;
+	Stats->Words += (u64)Len * XPLMISIM_WRITE_CMD_WORDS;
+	Stats->Count += Len;
+	CoalescedCmds += Len;
+	++CoalescedRuns;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	Handler of the commands of the modules not built into the
+ *		simulator.
+ *
+ *****************************************************************************/
+static int XPlmiSim_SinkCmd(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+static void XPlmiSim_RegisterModules(void)
+{
+	static XPlmi_ModuleCmd SinkCmds[XPLMISIM_SINK_CMDS];
+	static XPlmi_Module SinkModules[XPLMI_MAX_MODULES];
+	u32 Index;
+
+	for (Index = 0U; Index < XPLMISIM_SINK_CMDS; Index++) {
+		SinkCmds[Index].Handler = XPlmiSim_SinkCmd;
+	}
+
+	XPlmi_GenericInit();
+	for (Index = XPLMI_MODULE_XILPM_ID; Index < XPLMI_MAX_MODULES; Index++) {
+		SinkModules[Index].Id = Index;
+		SinkModules[Index].CmdAry = SinkCmds;
+		SinkModules[Index].CmdCnt = XPLMISIM_SINK_CMDS;
+		XPlmi_ModuleRegister(&SinkModules[Index]);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks for a valid CDO header at a word of the
+ *		input and returns the length of the CDO in words.
+ *
+ * @return	Length of the CDO including the header, 0 if there is none
+ *
+ *****************************************************************************/
+static u32 XPlmiSim_CdoAt(const u32 *Buf, u32 Words)
+{
+	u32 Len = 0U;
+	u32 CheckSum = 0U;
+	u32 Index;
+
+	if ((Words < XPLMI_CDO_HDR_LEN) || (Buf[1U] != XPLMI_CDO_HDR_IDN_WRD)) {
+		goto END;
+	}
+	for (Index = 0U; Index < (XPLMI_CDO_HDR_LEN - 1U); Index++) {
+		CheckSum += Buf[Index];
+	}
+	if ((~CheckSum != Buf[XPLMI_CDO_HDR_LEN - 1U]) ||
+		(Buf[3U] > (Words - XPLMI_CDO_HDR_LEN))) {
+		goto END;
+	}
+	Len = Buf[3U] + XPLMI_CDO_HDR_LEN;
+
+END:
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes one CDO as XLoader_ProcessCdo() does
+ *		for a non secure partition: the CDO is copied chunk by chunk
+ *		into the two PMC RAM chunk buffers and every chunk is handed
+ *		to XPlmi_ProcessCdo().
+ *
+ * @return	XST_SUCCESS on success, error code of the parser otherwise
+ *
+ *****************************************************************************/
+static int XPlmiSim_RunCdo(const u32 *Cdo, u32 Words, u32 ChunkLen,
+		u64 *TimeNs, u32 *DeferredErr)
+{
+	int Status = XST_FAILURE;
+	XPlmiCdo CdoInst;
+	u32 ChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+	u32 Offset = 0U;
+	u32 Len = 0U;
+	u64 Start;
+
+	Status = XPlmi_InitCdo(&CdoInst);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	CdoInst.NextChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+
+	while (Offset < (Words * XPLMI_WORD_LEN)) {
+		Len = (Words * XPLMI_WORD_LEN) - Offset;
+		if (Len > ChunkLen) {
+			Len = ChunkLen;
+		}
+		memcpy((void *)(UINTPTR)ChunkAddr, (const u8 *)Cdo + Offset, Len);
+		CdoInst.BufPtr = (u32 *)(UINTPTR)ChunkAddr;
+		CdoInst.BufLen = Len / XPLMI_WORD_LEN;
+		Offset += Len;
+		ChunkAddr = (ChunkAddr == XPLMI_PMCRAM_CHUNK_MEMORY) ?
+			XPLMI_PMCRAM_CHUNK_MEMORY_1 : XPLMI_PMCRAM_CHUNK_MEMORY;
+		CdoInst.NextChunkAddr = ChunkAddr;
+
+		Start = XPlmiSim_Now();
+		Status = XPlmi_ProcessCdo(&CdoInst);
+		*TimeNs += XPlmiSim_Now() - Start;
+		if (Status != XST_SUCCESS) {
+			fprintf(stderr, "CDO error 0x%08x at word 0x%x\n",
+				(u32)Status, CdoInst.ProcessedCdoLen +
+				XPLMI_CDO_HDR_LEN);
+			goto END;
+		}
+	}
+	if (CdoInst.DeferredError == (u8)TRUE) {
+		++*DeferredErr;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function loads the register preload file. Each line holds
+ *		an address and a value; '#' starts a comment.
+ *
+ *****************************************************************************/
+static int XPlmiSim_LoadRegInit(const char *Name)
+{
+	int Status = XST_FAILURE;
+	char Line[256U];
+	unsigned long long Addr;
+	unsigned long Value;
+	u32 Max = 0U;
+	FILE *Fp = fopen(Name, "r");
+
+	if (Fp == NULL) {
+		perror(Name);
+		goto END;
+	}
+	while (fgets(Line, sizeof(Line), Fp) != NULL) {
+		if (sscanf(Line, "%llx %lx", &Addr, &Value) != 2) {
+			continue;
+		}
+		if (RegInitCnt == Max) {
+			Max = (Max == 0U) ? 64U : (Max * 2U);
+			RegInit = realloc(RegInit, Max * sizeof(*RegInit));
+			if (RegInit == NULL) {
+				goto END;
+			}
+		}
+		RegInit[RegInitCnt].Addr = Addr;
+		RegInit[RegInitCnt].Value = (u32)Value;
+		++RegInitCnt;
+	}
+	Status = XST_SUCCESS;
+
+END:
+	if (Fp != NULL) {
+		fclose(Fp);
+	}
+	return Status;
+}
+
+static void XPlmiSim_CmdName(u32 CmdId, char *Name, size_t Size)
+{
+	u32 ModuleId = (CmdId & XPLMI_CMD_MODULE_ID_MASK) >>
+		XPLMI_CMD_MODULE_ID_SHIFT;
+	u32 ApiId = CmdId & XPLMI_CMD_API_ID_MASK;
+	const char *Module = NULL;
+
+	if (ModuleId < XPLMI_MAX_MODULES) {
+		Module = ModuleNames[ModuleId];
+	}
+	if ((ModuleId == XPLMI_MODULE_GENERIC_ID) &&
+		(ApiId < (sizeof(GenericCmdNames) / sizeof(GenericCmdNames[0U])))) {
+		(void)snprintf(Name, Size, "%s", GenericCmdNames[ApiId]);
+	} else if (Module != NULL) {
+		(void)snprintf(Name, Size, "%s.0x%02x", Module, ApiId);
+	} else {
+		(void)snprintf(Name, Size, "mod%u.0x%02x", ModuleId, ApiId);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads a baseline written with -o.
+ *
+ *****************************************************************************/
+static int XPlmiSim_LoadBaseline(const char *Name, u64 *TotalNs)
+{
+	int Status = XST_FAILURE;
+	char Line[256U];
+	unsigned int CmdId;
+	unsigned long long Count;
+	unsigned long long Words;
+	unsigned long long TimeNs;
+	FILE *Fp = fopen(Name, "r");
+
+	if (Fp == NULL) {
+		perror(Name);
+		goto END;
+	}
+	while (fgets(Line, sizeof(Line), Fp) != NULL) {
+		if (sscanf(Line, "total,%llu", &TimeNs) == 1) {
+			*TotalNs = TimeNs;
+		} else if ((sscanf(Line, "0x%x,%*[^,],%llu,%llu,%llu", &CmdId,
+			&Count, &Words, &TimeNs) == 4) &&
+			(CmdId < XPLMISIM_MAX_CMDS)) {
+			BaseStats[CmdId].Count = Count;
+			BaseStats[CmdId].Words = Words;
+			BaseStats[CmdId].TimeNs = TimeNs;
+		}
+	}
+	Status = XST_SUCCESS;
+
+END:
+	if (Fp != NULL) {
+		fclose(Fp);
+	}
+	return Status;
+}
+
+static int XPlmiSim_CmpTime(const void *A, const void *B)
+{
+	u64 TimeA = CmdStats[*(const u32 *)A].TimeNs;
+	u64 TimeB = CmdStats[*(const u32 *)B].TimeNs;
+
+	return (TimeA < TimeB) ? 1 : ((TimeA > TimeB) ? -1 : 0);
+}
+
+static double XPlmiSim_Delta(u64 New, u64 Old)
+{
+	return (Old == 0U) ? 0.0 : ((((double)New - (double)Old) * 100.0) /
+		(double)Old);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the report and writes the CSV file. Times
+ *		are per run, commands are listed by total time.
+ *
+ *****************************************************************************/
+static void XPlmiSim_Report(u32 Runs, u64 TotalNs, u64 Bytes, const char *Csv,
+		u32 HasBase, u64 BaseNs)
+{
+	static u32 Order[XPLMISIM_MAX_CMDS];
+	u32 OrderCnt = 0U;
+	u32 Index;
+	const XPlmiSim_CmdStats *Stats;
+	const XPlmiSim_CmdStats *Base;
+	u32 CmdId;
+	u64 Cmds = 0U;
+	u64 CmdNs = 0U;
+	char Name[32U];
+	FILE *Fp = NULL;
+	const XPlmiSim_Stats *Sim = XPlmiSim_GetStats();
+
+	for (CmdId = 0U; CmdId < XPLMISIM_MAX_CMDS; CmdId++) {
+		CmdStats[CmdId].Count /= Runs;
+		CmdStats[CmdId].Words /= Runs;
+		CmdStats[CmdId].TimeNs /= Runs;
+		Cmds += CmdStats[CmdId].Count;
+		CmdNs += CmdStats[CmdId].TimeNs;
+		if (CmdStats[CmdId].Count != 0U) {
+			Order[OrderCnt] = CmdId;
+			++OrderCnt;
+		}
+	}
+	qsort(Order, OrderCnt, sizeof(Order[0U]), XPlmiSim_CmpTime);
+	TotalNs /= Runs;
+	if (TotalNs == 0U) {
+		TotalNs = 1U;
+	}
+
+	printf("runs            %u\n", Runs);
+	printf("time/run        %llu ns", (unsigned long long)TotalNs);
+	if (HasBase != 0U) {
+		printf(" (%+.1f%%)", XPlmiSim_Delta(TotalNs, BaseNs));
+	}
+	printf("\ncommand ns/run  %llu (parser %llu)\n",
+		(unsigned long long)CmdNs, (unsigned long long)((TotalNs > CmdNs) ?
+		(TotalNs - CmdNs) : 0U));
+	printf("commands/run    %llu\n", (unsigned long long)Cmds);
+	printf("coalesced/run   %llu (%llu runs)\n",
+		(unsigned long long)(CoalescedCmds / Runs),
+		(unsigned long long)(CoalescedRuns / Runs));
+	printf("commands/s      %.0f\n", ((double)Cmds * XPLMISIM_NS_PER_SEC) /
+		(double)TotalNs);
+	printf("bytes/s         %.0f\n", ((double)Bytes * XPLMISIM_NS_PER_SEC) /
+		(double)TotalNs);
+	printf("reg reads/run   %llu\n", (unsigned long long)(Sim->Reads / Runs));
+	printf("reg writes/run  %llu\n", (unsigned long long)(Sim->Writes / Runs));
+	printf("polls/run       %llu (%llu forced)\n",
+		(unsigned long long)(Sim->Polls / Runs),
+		(unsigned long long)(Sim->PollsForced / Runs));
+	printf("dma bytes/run   %llu\n", (unsigned long long)(Sim->DmaBytes / Runs));
+	printf("sbi bytes/run   %llu\n", (unsigned long long)(Sim->SbiBytes / Runs));
+	printf("\n%-20s %10s %12s %12s %8s %6s", "command", "count", "words",
+		"total ns", "avg ns", "share");
+	if (HasBase != 0U) {
+		printf(" %9s", "avg delta");
+	}
+	printf("\n");
+
+	if (Csv != NULL) {
+		Fp = fopen(Csv, "w");
+		if (Fp == NULL) {
+			perror(Csv);
+		} else {
+			fprintf(Fp, "cmd_id,name,count,words,total_ns\n");
+			fprintf(Fp, "total,%llu\n", (unsigned long long)TotalNs);
+		}
+	}
+
+	for (Index = 0U; Index < OrderCnt; Index++) {
+		CmdId = Order[Index];
+		Stats = &CmdStats[CmdId];
+		Base = &BaseStats[CmdId];
+
+		XPlmiSim_CmdName(CmdId, Name, sizeof(Name));
+		printf("%-20s %10llu %12llu %12llu %8llu %5.1f%%", Name,
+			(unsigned long long)Stats->Count,
+			(unsigned long long)Stats->Words,
+			(unsigned long long)Stats->TimeNs,
+			(unsigned long long)(Stats->TimeNs / Stats->Count),
+			(CmdNs == 0U) ? 0.0 : (((double)Stats->TimeNs * 100.0) /
+			(double)CmdNs));
+		if ((HasBase != 0U) && (Base->Count != 0U)) {
+			printf(" %+8.1f%%", XPlmiSim_Delta(
+				Stats->TimeNs / Stats->Count,
+				Base->TimeNs / Base->Count));
+		}
+		printf("\n");
+		if (Fp != NULL) {
+			fprintf(Fp, "0x%04x,%s,%llu,%llu,%llu\n", CmdId, Name,
+				(unsigned long long)Stats->Count,
+				(unsigned long long)Stats->Words,
+				(unsigned long long)Stats->TimeNs);
+		}
+	}
+
+	if (Fp != NULL) {
+		fclose(Fp);
+	}
+}
+
+static void XPlmiSim_Usage(const char *Prog)
+{
+	fprintf(stderr,
+		"usage: %s [options] <file.cdo|file.pdi|file.bin>\n"
+		"  -n <runs>   number of runs, default %u\n"
+		"  -c <bytes>  chunk size, default and max 0x%x\n"
+		"  -r <file>   register preload, lines of \"addr value\" in hex\n"
+		"  -o <file>   write the per command results as CSV\n"
+		"  -b <file>   compare with a CSV written by -o\n"
+		"  -v          trace register accesses\n",
+		Prog, XPLMISIM_DEF_RUNS, XPLMISIM_MAX_CHUNK);
+}
+
+int main(int argc, char *argv[])
+{
+	int Status = XST_FAILURE;
+	int Opt;
+	u32 Runs = XPLMISIM_DEF_RUNS;
+	u32 ChunkLen = XPLMISIM_MAX_CHUNK;
+	u32 Verbose = 0U;
+	const char *Csv = NULL;
+	const char *Baseline = NULL;
+	u64 BaseNs = 0U;
+	FILE *Fp;
+	long Size;
+	u32 *Buf = NULL;
+	u32 Words;
+	u32 Run;
+	u32 Index;
+	u32 CdoLen;
+	u32 CdoCnt = 0U;
+	u32 DeferredErr = 0U;
+	u64 TotalNs = 0U;
+	u64 Bytes = 0U;
+
+	while ((Opt = getopt(argc, argv, "n:c:r:o:b:v")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Runs = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'c':
+			ChunkLen = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			if (XPlmiSim_LoadRegInit(optarg) != XST_SUCCESS) {
+				goto END;
+			}
+			break;
+		case 'o':
+			Csv = optarg;
+			break;
+		case 'b':
+			Baseline = optarg;
+			break;
+		case 'v':
+			Verbose = 1U;
+			break;
+		default:
+			XPlmiSim_Usage(argv[0]);
+			goto END;
+		}
+	}
+	ChunkLen &= ~(XPLMI_WORD_LEN - 1U);
+	if ((optind != (argc - 1)) || (Runs == 0U) || (ChunkLen == 0U) ||
+		(ChunkLen > XPLMISIM_MAX_CHUNK)) {
+		XPlmiSim_Usage(argv[0]);
+		goto END;
+	}
+	if ((Baseline != NULL) &&
+		(XPlmiSim_LoadBaseline(Baseline, &BaseNs) != XST_SUCCESS)) {
+		goto END;
+	}
+
+	Fp = fopen(argv[optind], "rb");
+	if (Fp == NULL) {
+		perror(argv[optind]);
+		goto END;
+	}
+	(void)fseek(Fp, 0, SEEK_END);
+	Size = ftell(Fp);
+	(void)fseek(Fp, 0, SEEK_SET);
+	Words = (u32)(Size / XPLMI_WORD_LEN);
+	Buf = malloc(((size_t)Words + 1U) * XPLMI_WORD_LEN);
+	if ((Buf == NULL) || (fread(Buf, XPLMI_WORD_LEN, Words, Fp) != Words)) {
+		fprintf(stderr, "cannot read %s\n", argv[optind]);
+		fclose(Fp);
+		goto END;
+	}
+	fclose(Fp);
+
+	if (XPlmiSim_Init() != XST_SUCCESS) {
+		goto END;
+	}
+	XPlmiSim_SetVerbose(Verbose);
+	XPlmiSim_RegisterModules();
+
+	for (Run = 0U; Run < Runs; Run++) {
+		XPlmiSim_Reset();
+		for (Index = 0U; Index < RegInitCnt; Index++) {
+			XPlmiSim_Preload(RegInit[Index].Addr,
+				RegInit[Index].Value);
+		}
+
+		Index = 0U;
+		while (Index < Words) {
+			CdoLen = XPlmiSim_CdoAt(&Buf[Index], Words - Index);
+			if (CdoLen == 0U) {
+				++Index;
+				continue;
+			}
+			Status = XPlmiSim_RunCdo(&Buf[Index], CdoLen, ChunkLen,
+				&TotalNs, &DeferredErr);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+			if (Run == 0U) {
+				++CdoCnt;
+				Bytes += (u64)CdoLen * XPLMI_WORD_LEN;
+			}
+			Index += CdoLen;
+		}
+		if (CdoCnt == 0U) {
+			fprintf(stderr, "no CDO found in %s\n", argv[optind]);
+			Status = XST_FAILURE;
+			goto END;
+		}
+	}
+
+	printf("file            %s\n", argv[optind]);
+	printf("CDOs            %u (%llu bytes)\n", CdoCnt,
+		(unsigned long long)Bytes);
+	if (DeferredErr != 0U) {
+		printf("deferred errors %u\n", DeferredErr / Runs);
+	}
+	XPlmiSim_Report(Runs, TotalNs, Bytes, Csv, (Baseline != NULL) ?
+		1U : 0U, BaseNs);
+
+END:
+	free(Buf);
+	free(RegInit);
+	return (Status == XST_SUCCESS) ? 0 : 1;
+}
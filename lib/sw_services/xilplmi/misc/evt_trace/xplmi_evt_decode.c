@@ -0,0 +1,447 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_evt_decode.c
+*
+* This file contains the host side decoder of the PLM event trace. The input
+* is the binary records retrieved with the event logging command, one or
+* more retrieves appended in order. Every record is printed as text or CSV
+* and a summary of the command, task, DMA and IPI events is printed at the
+* end.
+*
+* The record layout and event IDs mirror XPlmi_EvtTraceRecord and the
+* XPLMI_EVT_TRACE_* defines in xplmi_event_logging.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  mb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <getopt.h>
+
+/************************** Constant Definitions *****************************/
+#define EVT_RECORD_WORDS	(4U)
+#define EVT_ID_SHIFT		(24U)
+#define EVT_SEQ_MASK		(0xFFFFFFU)
+#define EVT_DEF_FREQ		(320000000ULL)
+#define EVT_MAX_DEPTH		(16U)
+#define EVT_MAX_ENTRIES		(256U)
+
+#define EVT_CMD_START		(0x1U)
+#define EVT_CMD_RESUME		(0x2U)
+#define EVT_CMD_END		(0x3U)
+#define EVT_TASK_START		(0x4U)
+#define EVT_TASK_END		(0x5U)
+#define EVT_DMA_START		(0x6U)
+#define EVT_DMA_DONE		(0x7U)
+#define EVT_IPI_RECV		(0x8U)
+#define EVT_MAX_ID		(EVT_IPI_RECV)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	uint32_t Key;		/**< Command ID, handler or IPI mask */
+	uint64_t Count;		/**< Completed events */
+	uint64_t Total;		/**< Total cycles */
+	uint64_t Max;		/**< Maximum cycles */
+} EvtStats;
+
+typedef struct {
+	uint32_t Key[EVT_MAX_DEPTH];	/**< Argument of the start event */
+	uint64_t Time[EVT_MAX_DEPTH];	/**< Time of the start event */
+	uint32_t Depth;			/**< Open start events */
+} EvtStack;
+
+typedef struct {
+	EvtStats Entry[EVT_MAX_ENTRIES];	/**< Statistics per key */
+	uint32_t Count;				/**< Used entries */
+} EvtTable;
+
+/************************** Variable Definitions *****************************/
+static const char *EvtName[EVT_MAX_ID + 1U] = {
+	"UNKNOWN", "CMD_START", "CMD_RESUME", "CMD_END", "TASK_START",
+	"TASK_END", "DMA_START", "DMA_DONE", "IPI_RECV",
+};
+
+static uint64_t Freq = EVT_DEF_FREQ;
+static EvtTable CmdTable;
+static EvtTable TaskTable;
+static EvtTable IpiTable;
+static EvtStack CmdStack;
+static EvtStack TaskStack;
+static EvtStack DmaStack;
+static uint64_t DmaCount;
+static uint64_t DmaWords;
+static uint64_t DmaCycles;
+static uint64_t Records;
+static uint64_t Lost;
+static uint64_t Unmatched;
+
+/*****************************************************************************/
+/**
+ * @brief	This function converts PMC IRO cycles to microseconds.
+ *
+ * @param	Cycles is the number of cycles
+ *
+ * @return	Time in microseconds
+ *
+ *****************************************************************************/
+static double EvtUs(uint64_t Cycles)
+{
+	return ((double)Cycles * 1000000.0) / (double)Freq;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the statistics entry of a key, allocating
+ * 			it on first use.
+ *
+ * @param	Table is the statistics table
+ * @param	Key is the command ID, task handler or IPI mask
+ *
+ * @return	Statistics entry, NULL if the table is full
+ *
+ *****************************************************************************/
+static EvtStats *EvtGetStats(EvtTable *Table, uint32_t Key)
+{
+	uint32_t Index;
+
+	for (Index = 0U; Index < Table->Count; Index++) {
+		if (Table->Entry[Index].Key == Key) {
+			return &Table->Entry[Index];
+		}
+	}
+	if (Table->Count == EVT_MAX_ENTRIES) {
+		return NULL;
+	}
+	Table->Entry[Table->Count].Key = Key;
+
+	return &Table->Entry[Table->Count++];
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function accounts a completed event in a statistics table.
+ *
+ * @param	Table is the statistics table
+ * @param	Key is the command ID, task handler or IPI mask
+ * @param	Cycles is the duration of the event
+ *
+ *****************************************************************************/
+static void EvtAccount(EvtTable *Table, uint32_t Key, uint64_t Cycles)
+{
+	EvtStats *Stats = EvtGetStats(Table, Key);
+
+	if (Stats != NULL) {
+		++Stats->Count;
+		Stats->Total += Cycles;
+		if (Cycles > Stats->Max) {
+			Stats->Max = Cycles;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function pushes a start event.
+ *
+ * @param	Stack is the stack of open start events
+ * @param	Key is the argument of the start event
+ * @param	Time is the time of the start event
+ *
+ *****************************************************************************/
+static void EvtPush(EvtStack *Stack, uint32_t Key, uint64_t Time)
+{
+	if (Stack->Depth < EVT_MAX_DEPTH) {
+		Stack->Key[Stack->Depth] = Key;
+		Stack->Time[Stack->Depth] = Time;
+	}
+	++Stack->Depth;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function pops the start event matching an end event.
+ *
+ * @param	Stack is the stack of open start events
+ * @param	Key is the argument of the end event
+ * @param	Time is the time of the end event
+ * @param	Cycles is updated with the time since the start event
+ *
+ * @return	1 if the start event was found, 0 otherwise
+ *
+ *****************************************************************************/
+static int EvtPop(EvtStack *Stack, uint32_t Key, uint64_t Time,
+	uint64_t *Cycles)
+{
+	int Found = 0;
+
+	if ((Stack->Depth > 0U) && (Stack->Depth <= EVT_MAX_DEPTH) &&
+		(Stack->Key[Stack->Depth - 1U] == Key)) {
+		*Cycles = Time - Stack->Time[Stack->Depth - 1U];
+		Found = 1;
+	}
+	if (Stack->Depth > 0U) {
+		--Stack->Depth;
+	}
+	if (Found == 0) {
+		++Unmatched;
+	}
+
+	return Found;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function drops the open start events, used when records
+ * 			are lost and start and end events can no longer be paired.
+ *
+ *****************************************************************************/
+static void EvtResetStacks(void)
+{
+	CmdStack.Depth = 0U;
+	TaskStack.Depth = 0U;
+	DmaStack.Depth = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function decodes and prints one record.
+ *
+ * @param	Word is the record
+ * @param	Csv prints the record as CSV if set
+ * @param	Quiet prints nothing if set
+ *
+ *****************************************************************************/
+static void EvtDecode(const uint32_t *Word, int Csv, int Quiet)
+{
+	static uint32_t NextSeq;
+	uint64_t Time = ((uint64_t)Word[0U] << 32U) | Word[1U];
+	uint32_t Id = Word[2U] >> EVT_ID_SHIFT;
+	uint32_t Seq = Word[2U] & EVT_SEQ_MASK;
+	uint32_t Arg = Word[3U];
+	uint64_t Cycles = 0U;
+	int HasTime = 0;
+
+	if ((Records != 0U) && (Seq != NextSeq)) {
+		Lost += (Seq - NextSeq) & EVT_SEQ_MASK;
+		EvtResetStacks();
+		if ((Quiet == 0) && (Csv == 0)) {
+			printf("-- %u records lost --\n",
+				(Seq - NextSeq) & EVT_SEQ_MASK);
+		}
+	}
+	NextSeq = (Seq + 1U) & EVT_SEQ_MASK;
+	++Records;
+	if (Id > EVT_MAX_ID) {
+		Id = 0U;
+	}
+
+	switch (Id) {
+	case EVT_CMD_START:
+	case EVT_CMD_RESUME:
+		EvtPush(&CmdStack, Arg, Time);
+		break;
+	case EVT_CMD_END:
+		HasTime = EvtPop(&CmdStack, Arg, Time, &Cycles);
+		if (HasTime != 0) {
+			EvtAccount(&CmdTable, Arg & 0xFFFFU, Cycles);
+		}
+		break;
+	case EVT_TASK_START:
+		EvtPush(&TaskStack, Arg, Time);
+		break;
+	case EVT_TASK_END:
+		HasTime = EvtPop(&TaskStack, Arg, Time, &Cycles);
+		if (HasTime != 0) {
+			EvtAccount(&TaskTable, Arg, Cycles);
+		}
+		break;
+	case EVT_DMA_START:
+		EvtPush(&DmaStack, Arg, Time);
+		break;
+	case EVT_DMA_DONE:
+		HasTime = EvtPop(&DmaStack, Arg, Time, &Cycles);
+		if (HasTime != 0) {
+			++DmaCount;
+			DmaWords += Arg;
+			DmaCycles += Cycles;
+		}
+		break;
+	case EVT_IPI_RECV:
+		EvtAccount(&IpiTable, Arg, 0U);
+		break;
+	default:
+		break;
+	}
+
+	if (Quiet != 0) {
+		return;
+	}
+	if (Csv != 0) {
+		printf("%u,%" PRIu64 ",%.3f,%s,0x%08x,%.3f\n", Seq, Time,
+			EvtUs(Time), EvtName[Id], Arg,
+			(HasTime != 0) ? EvtUs(Cycles) : 0.0);
+	}
+	else if (HasTime != 0) {
+		printf("%14.3f us  %-10s 0x%08x  %.3f us\n", EvtUs(Time),
+			EvtName[Id], Arg, EvtUs(Cycles));
+	}
+	else {
+		printf("%14.3f us  %-10s 0x%08x\n", EvtUs(Time), EvtName[Id],
+			Arg);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints a statistics table.
+ *
+ * @param	Title is the title of the table
+ * @param	KeyName is the name of the key column
+ * @param	Table is the statistics table
+ * @param	HasTime prints the times if set
+ *
+ *****************************************************************************/
+static void EvtPrintTable(const char *Title, const char *KeyName,
+	const EvtTable *Table, int HasTime)
+{
+	uint32_t Index;
+	const EvtStats *Stats;
+
+	if (Table->Count == 0U) {
+		return;
+	}
+	printf("\n%s\n", Title);
+	if (HasTime != 0) {
+		printf("%-10s %10s %14s %12s %12s\n", KeyName, "count",
+			"total us", "avg us", "max us");
+	}
+	else {
+		printf("%-10s %10s\n", KeyName, "count");
+	}
+	for (Index = 0U; Index < Table->Count; Index++) {
+		Stats = &Table->Entry[Index];
+		if (HasTime != 0) {
+			printf("0x%08x %10" PRIu64 " %14.3f %12.3f %12.3f\n",
+				Stats->Key, Stats->Count, EvtUs(Stats->Total),
+				EvtUs(Stats->Total) / (double)Stats->Count,
+				EvtUs(Stats->Max));
+		}
+		else {
+			printf("0x%08x %10" PRIu64 "\n", Stats->Key,
+				Stats->Count);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the summary.
+ *
+ *****************************************************************************/
+static void EvtPrintSummary(void)
+{
+	printf("\nrecords %" PRIu64 ", lost %" PRIu64 ", unmatched ends %"
+		PRIu64 "\n", Records, Lost, Unmatched);
+	EvtPrintTable("Commands", "cmd id", &CmdTable, 1);
+	EvtPrintTable("Tasks", "handler", &TaskTable, 1);
+	EvtPrintTable("IPIs", "source", &IpiTable, 0);
+	if (DmaCount != 0U) {
+		printf("\nDMA: %" PRIu64 " transfers, %" PRIu64 " bytes, %.3f us",
+			DmaCount, DmaWords * 4U, EvtUs(DmaCycles));
+		if (DmaCycles != 0U) {
+			printf(", %.1f MB/s", ((double)DmaWords * 4.0) /
+				EvtUs(DmaCycles));
+		}
+		printf("\n");
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the usage.
+ *
+ * @param	Name is the program name
+ *
+ *****************************************************************************/
+static void EvtUsage(const char *Name)
+{
+	fprintf(stderr, "usage: %s [-f freq_hz] [-c] [-s] file\n"
+		"  -f  PMC IRO frequency in Hz, default %llu\n"
+		"  -c  print the records as CSV\n"
+		"  -s  print only the summary\n", Name, EVT_DEF_FREQ);
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *File;
+	uint8_t Buf[EVT_RECORD_WORDS * 4U];
+	uint32_t Word[EVT_RECORD_WORDS];
+	uint32_t Index;
+	int Csv = 0;
+	int Quiet = 0;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "f:cs")) != -1) {
+		switch (Opt) {
+		case 'f':
+			Freq = strtoull(optarg, NULL, 0);
+			break;
+		case 'c':
+			Csv = 1;
+			break;
+		case 's':
+			Quiet = 1;
+			break;
+		default:
+			EvtUsage(argv[0]);
+			return 1;
+		}
+	}
+	if ((optind != (argc - 1)) || (Freq == 0U)) {
+		EvtUsage(argv[0]);
+		return 1;
+	}
+
+	File = fopen(argv[optind], "rb");
+	if (File == NULL) {
+		perror(argv[optind]);
+		return 1;
+	}
+	if ((Csv != 0) && (Quiet == 0)) {
+		printf("seq,cycles,us,event,arg,duration_us\n");
+	}
+	/* The records are little endian words, independent of the host */
+	while (fread(Buf, sizeof(Buf), 1U, File) == 1U) {
+		for (Index = 0U; Index < EVT_RECORD_WORDS; Index++) {
+			Word[Index] = (uint32_t)Buf[Index * 4U] |
+				((uint32_t)Buf[(Index * 4U) + 1U] << 8U) |
+				((uint32_t)Buf[(Index * 4U) + 2U] << 16U) |
+				((uint32_t)Buf[(Index * 4U) + 3U] << 24U);
+		}
+		EvtDecode(Word, Csv, Quiet);
+	}
+	fclose(File);
+
+	if ((Csv == 0) || (Quiet != 0)) {
+		EvtPrintSummary();
+	}
+
+	return 0;
+}
@@ -65,6 +65,12 @@
 * 2.00  ng   12/27/2023 Reduced log level for less frequent prints
 *       bm   03/01/2024 Set LogCdoOffset by default in JTAG boot mode
 *       ng   03/20/2024 Added CDO debug prints
+* 2.01  mb   10/16/2026 Execute runs of Write commands to consecutive NPI
+*                       addresses as one DMA transfer
+*       mb   10/16/2026 Do not coalesce Write commands above the NPI space
+*       mb   10/16/2026 Count coalesced Write commands in the command
+*                       statistics
+*       mb   10/16/2026 Record coalesced Write runs in the event trace
 *
 * </pre>
 *
@@ -85,6 +91,21 @@
 /************************** Constant Definitions *****************************/
 #define XPLMI_CMD_LEN_TEMPBUF		(0x8U) /**< This buffer is used to
 			store commands which extend across 32K boundaries */
+#ifdef PLM_CDO_WRITE_COALESCE
+#define XPLMI_CDO_WRITE_CMD_HDR		(((u32)XPLMI_CMD_ARG_CNT_TWO << \
+	XPLMI_SHORT_CMD_LEN_SHIFT) | (XPLMI_MODULE_GENERIC_ID << \
+	XPLMI_CMD_MODULE_ID_SHIFT) | XPLMI_WRITE_CMD_ID) /**< Header of
+			Write command */
+#define XPLMI_CDO_WRITE_CMD_LEN		(3U) /**< Words of Write command */
+#define XPLMI_CDO_WRITE_RUN_MIN		(4U) /**< Minimum Write commands
+			executed as one DMA transfer */
+#define XPLMI_CDO_WRITE_RUN_MAX		(XPLMI_SET_CHUNK_SIZE) /**< Maximum
+			Write commands executed as one DMA transfer */
+#define XPLMI_CDO_NPI_ADDR_LOW		(NPI_NIR_BASEADDR) /**< Start of NPI
+			address space */
+#define XPLMI_CDO_NPI_ADDR_HIGH		(0xF7FFFFFFU) /**< End of NPI address
+			space */
+#endif
 
 /**************************** Type Definitions *******************************/
 
@@ -426,6 +447,104 @@ END:
 	return Status;
 }
 
+#ifdef PLM_CDO_WRITE_COALESCE
+/*****************************************************************************/
+/**
+ * @brief	This function executes a run of Write commands to consecutive
+ * 			NPI addresses at the start of the buffer as one DMA transfer.
+ * 			Only commands present in the buffer are considered and any
+ * 			other command, including Mask Write, ends the run, so the
+ * 			order of register accesses is kept.
+ *
+ * @param	CdoPtr is pointer to the CDO structure
+ * @param	BufPtr is pointer to the buffer
+ * @param	BufLen is length of the buffer
+ * @param	Size is pointer to the Size consumed, 0 if no run is executed
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_CDO_CMD if the DMA transfer fails.
+ *
+ *****************************************************************************/
+static int XPlmi_CdoWriteRun(XPlmiCdo *CdoPtr, const u32 *BufPtr, u32 BufLen,
+	u32 *Size)
+{
+	int Status = XST_FAILURE;
+	u32 Src[XPLMI_CDO_WRITE_RUN_MAX];
+	u32 Addr = BufPtr[1U];
+	u32 MaxCount = BufLen / XPLMI_CDO_WRITE_CMD_LEN;
+	u32 Count = 0U;
+	const u32 *CmdBuf = BufPtr;
+#ifdef PLM_CMD_STATS
+	u64 StartTime;
+#endif
+
+	*Size = 0U;
+	/** - Only word aligned addresses within the NPI space are coalesced */
+	if ((Addr < XPLMI_CDO_NPI_ADDR_LOW) || (Addr > XPLMI_CDO_NPI_ADDR_HIGH) ||
+		((Addr & (XPLMI_WORD_LEN - 1U)) != 0U)) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+	if (MaxCount > XPLMI_CDO_WRITE_RUN_MAX) {
+		MaxCount = XPLMI_CDO_WRITE_RUN_MAX;
+	}
+	if (MaxCount > (((XPLMI_CDO_NPI_ADDR_HIGH - Addr) / XPLMI_WORD_LEN) + 1U)) {
+		MaxCount = ((XPLMI_CDO_NPI_ADDR_HIGH - Addr) / XPLMI_WORD_LEN) + 1U;
+	}
+
+	/** - Collect the values of the Write commands to consecutive addresses */
+	while ((Count < MaxCount) && (CmdBuf[0U] == XPLMI_CDO_WRITE_CMD_HDR) &&
+		(CmdBuf[1U] == (Addr + (Count * XPLMI_WORD_LEN)))) {
+		Src[Count] = CmdBuf[2U];
+		++Count;
+		CmdBuf = &CmdBuf[XPLMI_CDO_WRITE_CMD_LEN];
+	}
+	/** - The last address of the run must be within the NPI space too */
+	if ((Count < XPLMI_CDO_WRITE_RUN_MIN) ||
+		((Addr + ((Count * XPLMI_WORD_LEN) - 1U)) > XPLMI_CDO_NPI_ADDR_HIGH)) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	/* Log Cdo Offset of the first command of the run */
+	if (CdoPtr->LogCdoOffset == TRUE) {
+		XPlmi_Out32(PMC_GLOBAL_PMC_GSW_ERR, CdoPtr->PartitionOffset +
+			CdoPtr->ProcessedCdoLen + XPLMI_CDO_HDR_LEN);
+	}
+	XPlmi_Printf(DEBUG_DETAILED, "%s, Addr: 0x%0x, Count: %u\n\r",
+		__func__, Addr, Count);
+
+	/** - Write the values with one DMA transfer */
+#ifdef PLM_CMD_STATS
+	StartTime = XPlmi_GetTimerValue();
+#endif
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_CMD_START, XPLMI_CDO_WRITE_CMD_HDR);
+	Status = XPlmi_DmaXfr((u64)(UINTPTR)Src, (u64)Addr, Count,
+		XPLMI_PMCDMA_0);
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_CMD_END, XPLMI_CDO_WRITE_CMD_HDR);
+#ifdef PLM_CMD_STATS
+	XPlmi_UpdateCmdStats(XPLMI_CDO_WRITE_CMD_HDR, StartTime, Count);
+#endif
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_CDO_CMD, Status);
+		XPlmi_Printf(DEBUG_PRINT_ALWAYS, "CMD: 0x%08x run of %u execute "
+			"failed, Processed Cdo Length 0x%0x\n\r",
+			XPLMI_CDO_WRITE_CMD_HDR, Count,
+			(CdoPtr->ProcessedCdoLen + XPLMI_CDO_HDR_LEN) * XPLMI_WORD_LEN);
+		goto END;
+	}
+
+	CdoPtr->Cmd.DeferredError = (u8)FALSE;
+	CdoPtr->Cmd.BreakLength = 0U;
+	*Size = Count * XPLMI_CDO_WRITE_CMD_LEN;
+	CdoPtr->ProcessedCdoLen += *Size;
+
+END:
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function process the CDO file.
@@ -530,8 +649,20 @@ int XPlmi_ProcessCdo(XPlmiCdo *CdoPtr)
 			Status =
 				XPlmi_CdoCmdResume(CdoPtr, BufPtr, BufLen, &Size);
 		} else {
+#ifdef PLM_CDO_WRITE_COALESCE
+			Size = 0U;
+			if (BufPtr[0U] == XPLMI_CDO_WRITE_CMD_HDR) {
+				Status = XPlmi_CdoWriteRun(CdoPtr, BufPtr, BufLen,
+					&Size);
+			}
+			if (Size == 0U) {
+				Status = XPlmi_CdoCmdExecute(CdoPtr, BufPtr, BufLen,
+					&Size);
+			}
+#else
 			Status =
 				XPlmi_CdoCmdExecute(CdoPtr, BufPtr, BufLen, &Size);
+#endif
 		}
 		CdoPtr->DeferredError |= CdoPtr->Cmd.DeferredError;
 		if (Status != XST_SUCCESS) {
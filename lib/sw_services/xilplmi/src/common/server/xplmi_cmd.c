@@ -30,6 +30,9 @@
 * 2.0   ng   11/11/2023 Implemented user modules
 *       mss  03/13/2024 Fix MISRA-C violation 10.3
 *       bs   07/15/2024 Updated Cmd Resume to return errror in 0x2XXX format
+* 2.1   mb   10/16/2026 Added per command latency statistics
+*       mb   10/16/2026 Record command start and end in the event trace
+*       mb   10/16/2026 Allow a statistics update to cover several executions
 * </pre>
 *
 * @note
@@ -41,8 +44,15 @@
 #include "xplmi_debug.h"
 #include "xplmi_modules.h"
 #include "xil_assert.h"
+#ifdef PLM_CMD_STATS
+#include "xplmi_proc.h"
+#include "xplmi_dma.h"
+#endif
 
 /************************** Constant Definitions *****************************/
+#ifdef PLM_CMD_STATS
+#define XPLMI_CMD_STATS_MAX_TICKS	(0xFFFFFFFFU) /**< Min and max limit */
+#endif
 
 /**************************** Type Definitions *******************************/
 
@@ -72,8 +82,154 @@ static inline u32 XPlmi_GetCdoErr(u32 CmdId) {
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
+#ifdef PLM_CMD_STATS
+static XPlmi_CmdStats CmdStats[XPLMI_CMD_STATS_MAX_ENTRIES];
+static u32 CmdStatsDropped; /**< Executions not recorded, table full */
+#endif
+
+/*****************************************************************************/
+#ifdef PLM_CMD_STATS
+/*****************************************************************************/
+/**
+ * @brief	This function returns the statistics entry of a command ID,
+ * 			allocating it on first use. The table is open addressed with
+ * 			linear probing on the module and API ID.
+ *
+ * @param	CmdId is the module and API ID of the command
+ *
+ * @return
+ * 			- Pointer to the entry, NULL if the table is full.
+ *
+ *****************************************************************************/
+static XPlmi_CmdStats *XPlmi_GetCmdStatsEntry(u32 CmdId)
+{
+	XPlmi_CmdStats *Entry = NULL;
+	u32 Index = (CmdId ^ (CmdId >> XPLMI_CMD_MODULE_ID_SHIFT)) &
+		(XPLMI_CMD_STATS_MAX_ENTRIES - 1U);
+	u32 Probe;
+
+	for (Probe = 0U; Probe < XPLMI_CMD_STATS_MAX_ENTRIES; Probe++) {
+		if (CmdStats[Index].CmdId == CmdId) {
+			Entry = &CmdStats[Index];
+			break;
+		}
+		if (CmdStats[Index].CmdId == 0U) {
+			Entry = &CmdStats[Index];
+			Entry->CmdId = CmdId;
+			Entry->MinTicks = XPLMI_CMD_STATS_MAX_TICKS;
+			break;
+		}
+		Index = (Index + 1U) & (XPLMI_CMD_STATS_MAX_ENTRIES - 1U);
+	}
+
+	return Entry;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds the execution time of a command to its
+ * 			statistics. A time covering several executions, such as a
+ * 			coalesced run of Write commands, is recorded as that many
+ * 			executions of the average time.
+ *
+ * @param	CmdId is the command ID from the command header
+ * @param	StartTime is the timer value before the command was executed
+ * @param	Count is the number of executions, 0 if the command was resumed
+ *
+ *****************************************************************************/
+void XPlmi_UpdateCmdStats(u32 CmdId, u64 StartTime, u32 Count)
+{
+	/* PMC timer counts down */
+	u64 Ticks = StartTime - XPlmi_GetTimerValue();
+	u64 AvgTicks = Ticks;
+	u32 Ticks32;
+	u32 Bucket = 0U;
+	XPlmi_CmdStats *Entry = XPlmi_GetCmdStatsEntry(CmdId &
+		(XPLMI_CMD_MODULE_ID_MASK | XPLMI_CMD_API_ID_MASK));
+
+	if (Entry == NULL) {
+		++CmdStatsDropped;
+		goto END;
+	}
+
+	Entry->TotalTicks += Ticks;
+	if (Count == 0U) {
+		goto END;
+	}
+	if (Count > 1U) {
+		AvgTicks = Ticks / Count;
+	}
+	Ticks32 = (AvgTicks > XPLMI_CMD_STATS_MAX_TICKS) ?
+		XPLMI_CMD_STATS_MAX_TICKS : (u32)AvgTicks;
+	Entry->Count += Count;
+	if (Ticks32 < Entry->MinTicks) {
+		Entry->MinTicks = Ticks32;
+	}
+	if (Ticks32 > Entry->MaxTicks) {
+		Entry->MaxTicks = Ticks32;
+	}
+
+	/* Bucket is floor(log2(Ticks)) - XPLMI_CMD_STATS_HIST_SHIFT, clamped */
+	if (Ticks32 != 0U) {
+		Bucket = 31U - (u32)__builtin_clz(Ticks32);
+	}
+	if (Bucket <= XPLMI_CMD_STATS_HIST_SHIFT) {
+		Bucket = 0U;
+	}
+	else {
+		Bucket -= XPLMI_CMD_STATS_HIST_SHIFT;
+		if (Bucket >= XPLMI_CMD_STATS_HIST_BUCKETS) {
+			Bucket = XPLMI_CMD_STATS_HIST_BUCKETS - 1U;
+		}
+	}
+	Entry->Hist[Bucket] += Count;
+
+END:
+	return;
+}
 
 /*****************************************************************************/
+/**
+ * @brief	This function returns the command statistics table. Entries
+ * 			with CmdId 0 are unused.
+ *
+ * @param	UsedEntries is updated with the number of used entries
+ * @param	DroppedCnt is updated with the number of executions not
+ * 			recorded because the table was full
+ *
+ * @return
+ * 			- Pointer to the table of XPLMI_CMD_STATS_MAX_ENTRIES entries.
+ *
+ *****************************************************************************/
+XPlmi_CmdStats *XPlmi_GetCmdStats(u32 *UsedEntries, u32 *DroppedCnt)
+{
+	u32 Index;
+	u32 Used = 0U;
+
+	for (Index = 0U; Index < XPLMI_CMD_STATS_MAX_ENTRIES; Index++) {
+		if (CmdStats[Index].CmdId != 0U) {
+			++Used;
+		}
+	}
+	*UsedEntries = Used;
+	*DroppedCnt = CmdStatsDropped;
+
+	return CmdStats;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function clears the command statistics.
+ *
+ *****************************************************************************/
+void XPlmi_ClearCmdStats(void)
+{
+	(void)XPlmi_MemSetBytes(CmdStats, sizeof(CmdStats), 0U,
+		sizeof(CmdStats));
+	CmdStatsDropped = 0U;
+}
+#endif
+
 
 /*****************************************************************************/
 /**
@@ -98,6 +254,9 @@ int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
 	u32 ApiId = CmdPtr->CmdId & XPLMI_CMD_API_ID_MASK;
 	const XPlmi_Module *Module = NULL;
 	const XPlmi_ModuleCmd *ModuleCmd = NULL;
+#ifdef PLM_CMD_STATS
+	u64 StartTime;
+#endif
 
 	XPlmi_Printf(DEBUG_DETAILED, "CMD Execute \n\r");
 
@@ -124,7 +283,15 @@ int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
 			CmdPtr->CmdId, CmdPtr->Len, CmdPtr->PayloadLen);
 
 	/** - Execute the API. */
+#ifdef PLM_CMD_STATS
+	StartTime = XPlmi_GetTimerValue();
+#endif
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_CMD_START, CmdPtr->CmdId);
 	Status = ModuleCmd->Handler(CmdPtr);
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_CMD_END, CmdPtr->CmdId);
+#ifdef PLM_CMD_STATS
+	XPlmi_UpdateCmdStats(CmdPtr->CmdId, StartTime, 1U);
+#endif
 	if (Status != XST_SUCCESS) {
 
 		Status = XPlmi_UpdateStatus((XPlmiStatus_t)XPlmi_GetCdoErr(CmdPtr->CmdId), Status);
@@ -164,11 +331,22 @@ END:
 int XPlmi_CmdResume(XPlmi_Cmd * CmdPtr)
 {
 	int Status = XST_FAILURE;
+#ifdef PLM_CMD_STATS
+	u64 StartTime;
+#endif
 
 	XPlmi_Printf(DEBUG_DETAILED, "CMD Resume \n\r");
 	Xil_AssertNonvoid(CmdPtr->ResumeHandler != NULL);
 
+#ifdef PLM_CMD_STATS
+	StartTime = XPlmi_GetTimerValue();
+#endif
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_CMD_RESUME, CmdPtr->CmdId);
 	Status = CmdPtr->ResumeHandler(CmdPtr);
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_CMD_END, CmdPtr->CmdId);
+#ifdef PLM_CMD_STATS
+	XPlmi_UpdateCmdStats(CmdPtr->CmdId, StartTime, 0U);
+#endif
 	if (Status != XST_SUCCESS) {
 
 		Status = XPlmi_UpdateStatus((XPlmiStatus_t)XPlmi_GetCdoErr(CmdPtr->CmdId), Status);
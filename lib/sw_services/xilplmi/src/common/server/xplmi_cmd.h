@@ -46,6 +46,8 @@
 *                       boundaries
 * 1.8   skg  10/04/2022 Added masks for SLR ID and Zeriozing the SLR ID
 * 1.9   bm   07/11/2023 Added XPlmi_ClearEndStack member to XPlmi_Cmd structure
+* 2.1   mb   10/16/2026 Added per command latency statistics
+*       mb   10/16/2026 Export XPlmi_UpdateCmdStats for coalesced Write runs
 *
 * </pre>
 *
@@ -61,6 +63,7 @@ extern "C" {
 
 /***************************** Include Files *********************************/
 #include "xplmi_status.h"
+#include "xplmi_config.h"
 
 /**@cond xplmi_internal
  * @{
@@ -77,6 +80,15 @@ extern "C" {
 #define XPLMI_SLR_ID_ZEROISE            ~(XPLMI_CMD_SLR_ID_MASK)  /* Mask for making SlrIndex Zero after use*/
 #define XPLMI_BEGIN_OFFSET_STACK_SIZE		(10U)
 
+#ifdef PLM_CMD_STATS
+#define XPLMI_CMD_STATS_MAX_ENTRIES		(64U) /**< Command IDs tracked,
+						must be a power of 2 */
+#define XPLMI_CMD_STATS_HIST_BUCKETS		(16U) /**< Histogram buckets */
+#define XPLMI_CMD_STATS_HIST_SHIFT		(6U) /**< Bucket 0 holds times
+						below 2^7 timer ticks, bucket n
+						times of 2^(6+n) ticks and more */
+#endif
+
 /**************************** Type Definitions *******************************/
 typedef struct XPlmi_Cmd XPlmi_Cmd;
 typedef struct XPlmi_KeyHoleParams XPlmi_KeyHoleParams;
@@ -114,11 +126,34 @@ struct XPlmi_Cmd {
 	u8 AckInPLM;
 };
 
+#ifdef PLM_CMD_STATS
+/**
+ * Latency statistics of one command ID. Times are in PMC IRO timer ticks.
+ * The time of a command resumed over several chunks is added to TotalTicks
+ * only, Min, Max and the histogram cover the first execution. A run of
+ * coalesced Write commands counts as that many executions of its average
+ * time.
+ */
+typedef struct {
+	u32 CmdId;	/**< Module and API ID, 0 if the entry is unused */
+	u32 Count;	/**< Number of executions */
+	u64 TotalTicks;	/**< Total execution time */
+	u32 MinTicks;	/**< Shortest execution time */
+	u32 MaxTicks;	/**< Longest execution time */
+	u32 Hist[XPLMI_CMD_STATS_HIST_BUCKETS]; /**< log2 latency histogram */
+} XPlmi_CmdStats;
+#endif
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
 int XPlmi_CmdExecute(XPlmi_Cmd * CmdPtr);
 int XPlmi_CmdResume(XPlmi_Cmd * CmdPtr);
+#ifdef PLM_CMD_STATS
+XPlmi_CmdStats *XPlmi_GetCmdStats(u32 *UsedEntries, u32 *DroppedCnt);
+void XPlmi_UpdateCmdStats(u32 CmdId, u64 StartTime, u32 Count);
+void XPlmi_ClearCmdStats(void);
+#endif
 
 
 /**
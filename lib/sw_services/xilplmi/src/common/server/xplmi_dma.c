@@ -52,6 +52,7 @@
 *       ng   01/28/2024 optimized u8 variables
 *       mss  03/13/2024 MISRA-C violatiom Rule 17.8 fixed
 *       bm   07/15/2024 Fixed Memset logic by using source buffer in PPU RAM
+* 1.10  mb   10/16/2026 Record DMA start and done in the event trace
 *
 * </pre>
 *
@@ -407,6 +408,7 @@ static int XPlmi_DmaChXfer(u64 Addr, u32 Len, XPmcDma_Channel Channel, u32 Flags
 
 	XPmcDma_64BitTransfer(DmaPtr, Channel , (u32)(Addr),
 		(u32)(Addr >> 32U), Len, 0U);
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_DMA_START, Len);
 
 	if (((Flags & XPLMI_DMA_SRC_NONBLK) != 0U) ||
 		((Flags & XPLMI_DMA_DST_NONBLK) != 0U)) {
@@ -426,6 +428,7 @@ static int XPlmi_DmaChXfer(u64 Addr, u32 Len, XPmcDma_Channel Channel, u32 Flags
 
 	/* To acknowledge the transfer has completed */
 	XPmcDma_IntrClear(DmaPtr, Channel, XPMCDMA_IXR_DONE_MASK);
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_DMA_DONE, Len);
 
 	/* Revert the setting of PMC_DMA in AXI FIXED mode */
 	if (((Channel == XPMCDMA_DST_CHANNEL) &&
@@ -712,6 +715,7 @@ int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
+	XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_DMA_START, Len);
 
 	if ((Flags & XPLMI_DMA_SRC_NONBLK) != (u32)FALSE) {
 		goto END;
@@ -750,6 +754,7 @@ int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 
 	if ((Flags & (XPLMI_DMA_SRC_NONBLK | XPLMI_DMA_DST_NONBLK)) == (u32)FALSE) {
 		XPlmi_Printf(DEBUG_INFO, "DMA Xfer completed \n\r");
+		XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_DMA_DONE, Len);
 	}
 
 END:
@@ -53,6 +53,11 @@
 *       dd   09/12/2023 MISRA-C violation Rule 10.8 fixed
 *       ng   02/14/2024 removed int typecast for errors
 *       mss  03/13/2024 MISRA-C violatiom Rule 17.8 fixed
+* 2.1   mb   10/16/2026 Added sub commands to retrieve command statistics
+*       mb   10/16/2026 Added sub command to retrieve task queue statistics
+*       mb   10/16/2026 Added binary event trace ring with incremental read
+*       mb   10/16/2026 Keep the caller's interrupt state while reading the
+*                       event trace
 *
 * </pre>
 *
@@ -71,6 +76,9 @@
 #include "xil_util.h"
 #include "xplmi_modules.h"
 #include "xplmi_plat.h"
+#include "xplmi_task.h"
+#include "xplmi_proc.h"
+#include "mb_interface.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -90,6 +98,14 @@
 #define XPLMI_TRACE_LOG_BUFFER	(0U)
 #define XPLMI_DEBUG_LOG_BUFFER	(1U)
 
+#ifdef PLM_EVENT_TRACE
+#ifndef XPLMI_EVT_TRACE_RECORDS
+#define XPLMI_EVT_TRACE_RECORDS		(128U) /**< Records in the event
+				trace ring, must be a power of 2 */
+#endif
+#define XPLMI_EVT_TRACE_INDEX_MASK	(XPLMI_EVT_TRACE_RECORDS - 1U)
+#endif
+
 /**
  * @}
  * @endcond
@@ -104,6 +120,16 @@
  */
 XPlmi_LogInfo *DebugLog = (XPlmi_LogInfo *)(UINTPTR)XPLMI_RTCFG_DBG_LOG_BUF_ADDR;
 
+#ifdef PLM_EVENT_TRACE
+/* Event trace ring, Head and Tail are free running record counts */
+static struct {
+	u32 Head;	/**< Records written */
+	u32 Tail;	/**< Next record to be retrieved */
+	u32 EventMask;	/**< Bit of every event ID to be recorded */
+	XPlmi_EvtTraceRecord Records[XPLMI_EVT_TRACE_RECORDS];
+} EvtTrace = {0U, 0U, XPLMI_EVT_TRACE_ALL_MASK, {{0U}}};
+#endif
+
 
 /*****************************************************************************/
 /**
@@ -230,6 +256,210 @@ static void XPlmi_RetrieveBufferInfo(XPlmi_Cmd *Cmd,
 	Cmd->Response[5U] = LogBuffer->IsBufferFull;
 }
 
+#ifdef PLM_CMD_STATS
+/*****************************************************************************/
+/**
+ * @brief	This function copies the command statistics table to the given
+ * 			address. The whole table of XPLMI_CMD_STATS_MAX_ENTRIES
+ * 			entries is copied, entries with CmdId 0 are unused.
+ *
+ * @param 	Cmd is the pointer to command structure
+ * @param 	DestAddr is the address to which the table is copied
+ * @param 	Len is the size of the destination buffer in bytes
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_INVALID_LOG_BUF_LEN if the buffer is too small.
+ * 			- XPLMI_ERR_INVALID_LOG_BUF_ADDR if the buffer address is
+ * 			invalid.
+ *
+ *****************************************************************************/
+static int XPlmi_RetrieveCmdStats(XPlmi_Cmd *Cmd, u64 DestAddr, u32 Len)
+{
+	int Status = XST_FAILURE;
+	u32 UsedEntries;
+	u32 DroppedCnt;
+	const XPlmi_CmdStats *CmdStats = XPlmi_GetCmdStats(&UsedEntries,
+		&DroppedCnt);
+	u32 Size = (u32)sizeof(XPlmi_CmdStats) * XPLMI_CMD_STATS_MAX_ENTRIES;
+
+	if (Len < Size) {
+		Status = XPLMI_ERR_INVALID_LOG_BUF_LEN;
+		goto END;
+	}
+	if (XPlmi_VerifyAddrRange(DestAddr, DestAddr + Size - 1U) !=
+		XST_SUCCESS) {
+		Status = XPLMI_ERR_INVALID_LOG_BUF_ADDR;
+		goto END;
+	}
+
+	Status = XPlmi_MemCpy64(DestAddr, (u64)(UINTPTR)CmdStats, Size);
+	Cmd->Response[1U] = Size;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function retrieves command statistics info into cmd
+ * 			response.
+ *
+ * @param 	Cmd is the pointer to command structure
+ *
+ *****************************************************************************/
+static void XPlmi_RetrieveCmdStatsInfo(XPlmi_Cmd *Cmd)
+{
+	u32 UsedEntries;
+	u32 DroppedCnt;
+
+	(void)XPlmi_GetCmdStats(&UsedEntries, &DroppedCnt);
+	Cmd->Response[1U] = UsedEntries;
+	Cmd->Response[2U] = XPLMI_CMD_STATS_MAX_ENTRIES;
+	Cmd->Response[3U] = (u32)sizeof(XPlmi_CmdStats);
+	Cmd->Response[4U] = *XPlmi_GetPmcIroFreq();
+	Cmd->Response[5U] = DroppedCnt;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function copies the task queue statistics of all the task
+ * 			priorities to the given address.
+ *
+ * @param 	Cmd is the pointer to command structure
+ * @param 	DestAddr is the address to which the statistics are copied
+ * @param 	Len is the size of the destination buffer in bytes
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_INVALID_LOG_BUF_LEN if the buffer is too small.
+ * 			- XPLMI_ERR_INVALID_LOG_BUF_ADDR if the buffer address is
+ * 			invalid.
+ *
+ *****************************************************************************/
+static int XPlmi_RetrieveTaskStats(XPlmi_Cmd *Cmd, u64 DestAddr, u32 Len)
+{
+	int Status = XST_FAILURE;
+	u32 Size = (u32)sizeof(XPlmi_TaskStats) * XPLMI_TASK_PRIORITIES;
+
+	if (Len < Size) {
+		Status = XPLMI_ERR_INVALID_LOG_BUF_LEN;
+		goto END;
+	}
+	if (XPlmi_VerifyAddrRange(DestAddr, DestAddr + Size - 1U) !=
+		XST_SUCCESS) {
+		Status = XPLMI_ERR_INVALID_LOG_BUF_ADDR;
+		goto END;
+	}
+
+	Status = XPlmi_MemCpy64(DestAddr, (u64)(UINTPTR)XPlmi_GetTaskStats(),
+		Size);
+	Cmd->Response[1U] = Size;
+
+END:
+	return Status;
+}
+#endif
+
+#ifdef PLM_EVENT_TRACE
+/*****************************************************************************/
+/**
+ * @brief	This function copies the event trace records not retrieved yet,
+ * 			oldest first, to the given address and advances the read
+ * 			cursor past them. Records overwritten before they were
+ * 			retrieved are reported as dropped.
+ *
+ * @param 	Cmd is the pointer to command structure
+ * @param 	DestAddr is the address to which the records are copied
+ * @param 	Len is the size of the destination buffer in bytes
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_INVALID_LOG_BUF_ADDR if the buffer address is
+ * 			invalid.
+ *
+ *****************************************************************************/
+static int XPlmi_RetrieveEvtTrace(XPlmi_Cmd *Cmd, u64 DestAddr, u32 Len)
+{
+	int Status = XST_FAILURE;
+	u32 EventMask = EvtTrace.EventMask;
+	u32 RecordSize = (u32)sizeof(XPlmi_EvtTraceRecord);
+	u32 Dropped = 0U;
+	u32 Msr;
+	u32 Count;
+	u32 Index;
+	u32 Size;
+
+	/* Stop recording, copying the records would record DMA events */
+	EvtTrace.EventMask = 0U;
+
+	Msr = mfmsr();
+	mtmsr(Msr & (~XPLMI_MB_MSR_IE_MASK));
+	Count = EvtTrace.Head - EvtTrace.Tail;
+	if (Count > XPLMI_EVT_TRACE_RECORDS) {
+		Dropped = Count - XPLMI_EVT_TRACE_RECORDS;
+		EvtTrace.Tail += Dropped;
+		Count = XPLMI_EVT_TRACE_RECORDS;
+	}
+	mtmsr(Msr);
+
+	if (Count > (Len / RecordSize)) {
+		Count = Len / RecordSize;
+	}
+	Cmd->Response[2U] = EvtTrace.Tail;
+	Cmd->Response[3U] = Dropped;
+	if (Count == 0U) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+	if (XPlmi_VerifyAddrRange(DestAddr, DestAddr +
+		((u64)Count * RecordSize) - 1U) != XST_SUCCESS) {
+		Status = XPLMI_ERR_INVALID_LOG_BUF_ADDR;
+		goto END;
+	}
+
+	/** - Copy the records up to the end of the ring, then from its start */
+	Index = EvtTrace.Tail & XPLMI_EVT_TRACE_INDEX_MASK;
+	Size = XPLMI_EVT_TRACE_RECORDS - Index;
+	if (Size > Count) {
+		Size = Count;
+	}
+	Status = XPlmi_MemCpy64(DestAddr,
+		(u64)(UINTPTR)&EvtTrace.Records[Index], Size * RecordSize);
+	if ((Status == XST_SUCCESS) && (Size < Count)) {
+		Status = XPlmi_MemCpy64(DestAddr + ((u64)Size * RecordSize),
+			(u64)(UINTPTR)&EvtTrace.Records[0U],
+			(Count - Size) * RecordSize);
+	}
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	EvtTrace.Tail += Count;
+
+END:
+	Cmd->Response[1U] = (Status == XST_SUCCESS) ? Count : 0U;
+	EvtTrace.EventMask = EventMask;
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function retrieves event trace ring info into cmd response.
+ *
+ * @param 	Cmd is the pointer to command structure
+ *
+ *****************************************************************************/
+static void XPlmi_RetrieveEvtTraceInfo(XPlmi_Cmd *Cmd)
+{
+	Cmd->Response[1U] = EvtTrace.Head;
+	Cmd->Response[2U] = EvtTrace.Tail;
+	Cmd->Response[3U] = XPLMI_EVT_TRACE_RECORDS;
+	Cmd->Response[4U] = (u32)sizeof(XPlmi_EvtTraceRecord);
+	Cmd->Response[5U] = *XPlmi_GetPmcIroFreq();
+	Cmd->Response[6U] = EvtTrace.EventMask;
+}
+#endif
+
 /**
  * @}
  * @endcond
@@ -261,6 +491,23 @@ static void XPlmi_RetrieveBufferInfo(XPlmi_Cmd *Cmd,
  *		8 - Configure Uart
  *			Arg1 - Uart Select
  *			Arg2 - Uart Enable
+ *		9 - Retrieve command statistics
+ *			Arg1 - High Address
+ *			Arg2 - Low Address
+ *			Arg3 - Length
+ *		10 - Retrieve command statistics information
+ *		11 - Clear command and task queue statistics
+ *		12 - Retrieve task queue statistics
+ *			Arg1 - High Address
+ *			Arg2 - Low Address
+ *			Arg3 - Length
+ *		13 - Configure event trace, records not retrieved are discarded
+ *			Arg1 - Event mask, bit N enables event ID N
+ *		14 - Retrieve event trace records from the read cursor
+ *			Arg1 - High Address
+ *			Arg2 - Low Address
+ *			Arg3 - Length
+ *		15 - Retrieve event trace information
  *
  * @param	Cmd is pointer to the command structure
  *
@@ -278,6 +525,9 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 	u64 Arg2 = (u64)Cmd->Payload[2U];
 	u32 Arg3 = Cmd->Payload[3U];
 	u64 StartAddr;
+#ifdef PLM_EVENT_TRACE
+	u32 Msr;
+#endif
 	XPlmi_CircularBuffer *TraceLog = XPlmi_GetTraceLogInst();
 	XPLMI_EXPORT_CMD(XPLMI_EVENT_LOGGING_CMD_ID, XPLMI_MODULE_GENERIC_ID,
 		XPLMI_CMD_ARG_CNT_FOUR, XPLMI_CMD_ARG_CNT_FOUR);
@@ -321,6 +571,43 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 		case XPLMI_LOGGING_CMD_CONFIG_UART:
 			Status = XPlmi_ConfigUart((u8)Arg1, (u8)Arg2);
 			break;
+#ifdef PLM_CMD_STATS
+		case XPLMI_LOGGING_CMD_RETRIEVE_CMD_STATS:
+			Status = XPlmi_RetrieveCmdStats(Cmd, (Arg1 << 32U) | Arg2,
+					Arg3);
+			break;
+		case XPLMI_LOGGING_CMD_RETRIEVE_CMD_STATS_INFO:
+			XPlmi_RetrieveCmdStatsInfo(Cmd);
+			Status = XST_SUCCESS;
+			break;
+		case XPLMI_LOGGING_CMD_CLEAR_CMD_STATS:
+			XPlmi_ClearCmdStats();
+			XPlmi_ClearTaskStats();
+			Status = XST_SUCCESS;
+			break;
+		case XPLMI_LOGGING_CMD_RETRIEVE_TASK_STATS:
+			Status = XPlmi_RetrieveTaskStats(Cmd, (Arg1 << 32U) | Arg2,
+					Arg3);
+			break;
+#endif
+#ifdef PLM_EVENT_TRACE
+		case XPLMI_LOGGING_CMD_CONFIG_EVT_TRACE:
+			EvtTrace.EventMask = (u32)Arg1 & XPLMI_EVT_TRACE_ALL_MASK;
+			Msr = mfmsr();
+			mtmsr(Msr & (~XPLMI_MB_MSR_IE_MASK));
+			EvtTrace.Tail = EvtTrace.Head;
+			mtmsr(Msr);
+			Status = XST_SUCCESS;
+			break;
+		case XPLMI_LOGGING_CMD_RETRIEVE_EVT_TRACE:
+			Status = XPlmi_RetrieveEvtTrace(Cmd, (Arg1 << 32U) | Arg2,
+					Arg3);
+			break;
+		case XPLMI_LOGGING_CMD_RETRIEVE_EVT_TRACE_INFO:
+			XPlmi_RetrieveEvtTraceInfo(Cmd);
+			Status = XST_SUCCESS;
+			break;
+#endif
 		default:
 			XPlmi_Printf(DEBUG_GENERAL,
 				"Received invalid event logging command\n\r");
@@ -371,6 +658,43 @@ void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 	}
 }
 
+#ifdef PLM_EVENT_TRACE
+/*****************************************************************************/
+/**
+ * @brief	This function records an event in the event trace ring,
+ * 			overwriting the oldest record when the ring is full. It can be
+ * 			called from interrupt context.
+ *
+ * @param	EventId is the event trace ID
+ * @param	Arg is the argument of the event
+ *
+ *****************************************************************************/
+void XPlmi_EvtTraceLog(u32 EventId, u32 Arg)
+{
+	u32 Msr;
+	u32 Seq;
+	u64 Time;
+	XPlmi_EvtTraceRecord *Record;
+
+	if ((EvtTrace.EventMask & ((u32)1U << EventId)) != 0U) {
+		/* Restore the interrupt state after, this may be interrupt context */
+		Msr = mfmsr();
+		mtmsr(Msr & (~XPLMI_MB_MSR_IE_MASK));
+		Time = ((XPLMI_PIT1_CYCLE_VALUE << 32U) | XPLMI_PIT2_CYCLE_VALUE) -
+			XPlmi_GetTimerValue();
+		Seq = EvtTrace.Head;
+		++EvtTrace.Head;
+		Record = &EvtTrace.Records[Seq & XPLMI_EVT_TRACE_INDEX_MASK];
+		Record->TimeHigh = (u32)(Time >> 32U);
+		Record->TimeLow = (u32)Time;
+		Record->Header = (EventId << XPLMI_EVT_TRACE_ID_SHIFT) |
+			(Seq & XPLMI_EVT_TRACE_SEQ_MASK);
+		Record->Arg = Arg;
+		mtmsr(Msr);
+	}
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function initializes the the DebugLog structure.
@@ -30,6 +30,9 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
+* 2.1   mb   10/16/2026 Added sub commands to retrieve command statistics
+*       mb   10/16/2026 Added sub command to retrieve task queue statistics
+*       mb   10/16/2026 Added binary event trace ring
 *
 *
 * </pre>
@@ -68,6 +71,16 @@ typedef struct {
 	u8 PrintToBuf;	/**< If set, log is also written to PMC_RAM */
 } XPlmi_LogInfo;
 
+#ifdef PLM_EVENT_TRACE
+/* Event trace record, misc/evt_trace/xplmi_evt_decode.c decodes this layout */
+typedef struct {
+	u32 TimeHigh;	/**< Upper word of PMC IRO cycles since PLM start */
+	u32 TimeLow;	/**< Lower word of PMC IRO cycles since PLM start */
+	u32 Header;	/**< Event ID and sequence number */
+	u32 Arg;	/**< Event argument */
+} XPlmi_EvtTraceRecord;
+#endif
+
 /**@cond xplmi_internal
  * @{
  */
@@ -76,6 +89,9 @@ typedef struct {
 int XPlmi_EventLogging(XPlmi_Cmd * Cmd);
 void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len);
 void XPlmi_InitDebugLogBuffer(void);
+#ifdef PLM_EVENT_TRACE
+void XPlmi_EvtTraceLog(u32 EventId, u32 Arg);
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 /** Event Logging sub command IDs */
@@ -87,6 +103,13 @@ void XPlmi_InitDebugLogBuffer(void);
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_DATA	(0x6U)
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_BUFFER_INFO	(0x7U)
 #define XPLMI_LOGGING_CMD_CONFIG_UART			(0x8U)
+#define XPLMI_LOGGING_CMD_RETRIEVE_CMD_STATS		(0x9U)
+#define XPLMI_LOGGING_CMD_RETRIEVE_CMD_STATS_INFO	(0xAU)
+#define XPLMI_LOGGING_CMD_CLEAR_CMD_STATS		(0xBU)
+#define XPLMI_LOGGING_CMD_RETRIEVE_TASK_STATS		(0xCU)
+#define XPLMI_LOGGING_CMD_CONFIG_EVT_TRACE		(0xDU)
+#define XPLMI_LOGGING_CMD_RETRIEVE_EVT_TRACE		(0xEU)
+#define XPLMI_LOGGING_CMD_RETRIEVE_EVT_TRACE_INFO	(0xFU)
 #define XPLMI_LOG_LEVEL_SHIFT		(0x4U)
 
 /* Trace log buffer length shift */
@@ -95,6 +118,35 @@ void XPlmi_InitDebugLogBuffer(void);
 /* Trace event IDs */
 #define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
 
+/*
+ * Event trace record header
+ * 		[31:24] - Event ID
+ * 		[23:0] - Sequence number, lower bits
+ */
+#define XPLMI_EVT_TRACE_ID_SHIFT		(24U)
+#define XPLMI_EVT_TRACE_SEQ_MASK		(0xFFFFFFU)
+
+/* Event trace IDs and their argument */
+#define XPLMI_EVT_TRACE_CMD_START		(0x1U) /**< Command ID */
+#define XPLMI_EVT_TRACE_CMD_RESUME		(0x2U) /**< Command ID */
+#define XPLMI_EVT_TRACE_CMD_END			(0x3U) /**< Command ID */
+#define XPLMI_EVT_TRACE_TASK_START		(0x4U) /**< Task handler */
+#define XPLMI_EVT_TRACE_TASK_END		(0x5U) /**< Task handler */
+#define XPLMI_EVT_TRACE_DMA_START		(0x6U) /**< Length in words */
+#define XPLMI_EVT_TRACE_DMA_DONE		(0x7U) /**< Length in words */
+#define XPLMI_EVT_TRACE_IPI_RECV		(0x8U) /**< IPI source mask */
+#define XPLMI_EVT_TRACE_ALL_MASK		(0x1FEU) /**< All event IDs */
+
+/*
+ * Records an event in the event trace ring, compiled out unless
+ * PLM_EVENT_TRACE is defined
+ */
+#ifdef PLM_EVENT_TRACE
+#define XPLMI_EVT_TRACE(EventId, Arg)	XPlmi_EvtTraceLog((EventId), (u32)(Arg))
+#else
+#define XPLMI_EVT_TRACE(EventId, Arg)
+#endif
+
 /*
  * Trace log functions
  * TraceBuffer structure
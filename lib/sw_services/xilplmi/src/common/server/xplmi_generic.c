@@ -120,6 +120,8 @@
 *       pre  07/11/2024 Implemented secure PLM to PLM communication
 *       pre  07/16/2024 Added command routing to slave SLRs
 *       pre  08/22/2024 Modified XPlmi_GetReadbackLen for external linkage
+* 2.02  mb   10/16/2026 Look up procs through a hash index and overwrite a
+*                       redefined proc of the same length in place
 *
 * </pre>
 *
@@ -201,6 +203,24 @@
 /**< Versal Subsystem node ID for PMC. */
 #define XPLMI_PMC_SUBSYS_NODE_ID	(0x1c000001U)
 
+/* Buffer index related defines */
+#define XPLMI_BUFFER_INDEX_SIZE		(128U) /**< Slots of a buffer index,
+				power of 2 and at least twice the buffers */
+#define XPLMI_BUFFER_INDEX_MASK		(XPLMI_BUFFER_INDEX_SIZE - 1U)
+#define XPLMI_BUFFER_INDEX_LISTS	(XPLMI_PMC_BUFFER_LIST + 1U) /**< PSM
+				and PMC buffer lists are indexed */
+#if ((XPLMI_MAX_PSM_BUFFERS * 2U) > XPLMI_BUFFER_INDEX_SIZE) || \
+	((XPLMI_MAX_PMC_BUFFERS * 2U) > XPLMI_BUFFER_INDEX_SIZE)
+#error "XPLMI_BUFFER_INDEX_SIZE is too small for the buffer lists"
+#endif
+
+/**************************** Type Definitions *******************************/
+/* Hash index from buffer ID to position in the buffer list */
+typedef struct {
+	u8 IsValid;	/**< Index matches the buffer list */
+	u8 Slot[XPLMI_BUFFER_INDEX_SIZE]; /**< Position + 1, 0 if empty */
+} XPlmi_BufferIndex;
+
 /************************** Function Prototypes ******************************/
 static int XPlmi_CfiWrite(u64 SrcAddr, u64 DestAddr, u32 Keyholesize, u32 Len,
         XPlmi_Cmd* Cmd);
@@ -211,6 +231,8 @@ static int XPlmi_KeyHoleXfr(XPlmi_KeyHoleXfrParams* KeyHoleXfrParams);
 static int XPlmi_StackPush(XPlmi_CdoParamsStack *CdoParamsStack, u32 *Data);
 static int XPlmi_StackPop(XPlmi_CdoParamsStack *CdoParamsStack, u32 PopLevel, u32 *Data);
 static int XPlmi_TamperTrigger(XPlmi_Cmd *Cmd);
+static u32 XPlmi_FindBuffer(const XPlmi_BufferList *BufferList, u32 BufferId);
+static void XPlmi_InvalidateBufferIndex(const XPlmi_BufferList *BufferList);
 
 /************************** Variable Definitions *****************************/
 
@@ -1597,6 +1619,125 @@ static int XPlmi_Marker(XPlmi_Cmd *Cmd)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function returns the hash index of the PSM or PMC buffer
+ * 			list. Other buffer lists are not indexed.
+ *
+ * @param	BufferList is the pointer to the buffer list
+ *
+ * @return
+ * 			- Pointer to the index, NULL if the list is not indexed.
+ *
+ *****************************************************************************/
+static XPlmi_BufferIndex *XPlmi_GetBufferIndex(
+	const XPlmi_BufferList *BufferList)
+{
+	static XPlmi_BufferIndex BufferIndex[XPLMI_BUFFER_INDEX_LISTS];
+	XPlmi_BufferIndex *IndexPtr = NULL;
+	u32 ListType;
+
+	for (ListType = 0U; ListType < XPLMI_BUFFER_INDEX_LISTS; ++ListType) {
+		if (XPlmi_GetBufferList(ListType) == BufferList) {
+			IndexPtr = &BufferIndex[ListType];
+			break;
+		}
+	}
+
+	return IndexPtr;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the hash index slot of a buffer ID.
+ *
+ * @param	BufferId is the buffer ID
+ *
+ * @return	Slot of the buffer ID, to be probed linearly
+ *
+ *****************************************************************************/
+static u32 XPlmi_BufferIndexHash(u32 BufferId)
+{
+	return (BufferId ^ (BufferId >> 16U) ^ (BufferId >> 24U)) &
+		XPLMI_BUFFER_INDEX_MASK;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function marks the hash index of a buffer list stale after
+ * 			buffers are added, removed or moved. The index is rebuilt on
+ * 			the next lookup.
+ *
+ * @param	BufferList is the pointer to the buffer list
+ *
+ *****************************************************************************/
+static void XPlmi_InvalidateBufferIndex(const XPlmi_BufferList *BufferList)
+{
+	XPlmi_BufferIndex *IndexPtr = XPlmi_GetBufferIndex(BufferList);
+
+	if (IndexPtr != NULL) {
+		IndexPtr->IsValid = (u8)FALSE;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function finds the position of a buffer ID in a buffer
+ * 			list. PSM and PMC buffer lists are looked up through their
+ * 			hash index, which is rebuilt from the list when it is stale,
+ * 			also after the list is restored by an In-Place PLM Update.
+ * 			Other lists are searched linearly.
+ *
+ * @param	BufferList is the pointer to the buffer list
+ * @param	BufferId is the buffer ID to find
+ *
+ * @return	Position of the buffer, BufferCount if it is not in the list
+ *
+ *****************************************************************************/
+static u32 XPlmi_FindBuffer(const XPlmi_BufferList *BufferList, u32 BufferId)
+{
+	XPlmi_BufferIndex *IndexPtr = XPlmi_GetBufferIndex(BufferList);
+	u32 Index = 0U;
+	u32 Slot;
+
+	if (IndexPtr == NULL) {
+		while ((Index < BufferList->BufferCount) &&
+			(BufferList->Data[Index].Id != BufferId)) {
+			Index++;
+		}
+		goto END;
+	}
+
+	/** - Rebuild the index if the list changed since it was built */
+	if (IndexPtr->IsValid != (u8)TRUE) {
+		for (Slot = 0U; Slot < XPLMI_BUFFER_INDEX_SIZE; Slot++) {
+			IndexPtr->Slot[Slot] = 0U;
+		}
+		for (Index = 0U; Index < BufferList->BufferCount; Index++) {
+			Slot = XPlmi_BufferIndexHash(BufferList->Data[Index].Id);
+			while (IndexPtr->Slot[Slot] != 0U) {
+				Slot = (Slot + 1U) & XPLMI_BUFFER_INDEX_MASK;
+			}
+			IndexPtr->Slot[Slot] = (u8)(Index + 1U);
+		}
+		IndexPtr->IsValid = (u8)TRUE;
+	}
+
+	/** - Probe from the hash slot until the ID or an empty slot is found */
+	Index = BufferList->BufferCount;
+	Slot = XPlmi_BufferIndexHash(BufferId);
+	while (IndexPtr->Slot[Slot] != 0U) {
+		if (BufferList->Data[IndexPtr->Slot[Slot] - 1U].Id == BufferId) {
+			Index = (u32)IndexPtr->Slot[Slot] - 1U;
+			break;
+		}
+		Slot = (Slot + 1U) & XPLMI_BUFFER_INDEX_MASK;
+	}
+
+END:
+	return Index;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function provides functionality to move procs when proc
@@ -1654,6 +1795,7 @@ int XPlmi_MoveBuffer(u32 BufferIndex, XPlmi_BufferList *BufferList)
 					BufferList->Data[Index + 1U].Addr - DeletedBufferLen;
 		Index++;
 	}
+	XPlmi_InvalidateBufferIndex(BufferList);
 
 END:
 	return Status;
@@ -1727,7 +1869,7 @@ int XPlmi_SearchBufferList(XPlmi_BufferList *BufferList, u32 BufferId,
 		u64 *BufAddr, u32 *BufLen)
 {
 	int Status = XST_FAILURE;
-	u8 BufferIndex = 0U;
+	u32 BufferIndex;
 
 	/** - Check if Buffer Memory is available. */
 	if (BufferList->IsBufferMemAvailable != (u8)TRUE) {
@@ -1735,10 +1877,7 @@ int XPlmi_SearchBufferList(XPlmi_BufferList *BufferList, u32 BufferId,
 		goto END;
 	}
 	/** - Search for the buffer index which has a matching BufferId. */
-	BufferList->Data[BufferList->BufferCount].Id = BufferId;
-	while (BufferList->Data[BufferIndex].Id != BufferId) {
-		BufferIndex++;
-	}
+	BufferIndex = XPlmi_FindBuffer(BufferList, BufferId);
 
 	/** - Execute proc if the received BufferId is valid. */
 	if (BufferIndex >= BufferList->BufferCount) {
@@ -1906,9 +2045,17 @@ int XPlmi_StoreBuffer(XPlmi_Cmd *Cmd, u32 BufferId, XPlmi_BufferList *BufferList
 		}
 
 		/* Check if received BufferId is already in memory */
-		BufferList->Data[BufferList->BufferCount].Id = BufferId;
-		while (BufferList->Data[Index].Id != BufferId) {
-			Index++;
+		Index = XPlmi_FindBuffer(BufferList, BufferId);
+		if ((Index < BufferList->BufferCount) && (CmdLenInBytes ==
+			(BufferList->Data[Index + 1U].Addr - BufferList->Data[Index].Addr))) {
+			/*
+			 * Proc of the same length is overwritten in place, the
+			 * other procs are not moved
+			 */
+			Cmd->ResumeData[0U] = (u32)BufferList->Data[Index].Addr;
+			SrcAddr = (u32)(&Cmd->Payload[1U]);
+			CurrPayloadLen = Cmd->PayloadLen - 1U;
+			goto COPY;
 		}
 		if (Index < BufferList->BufferCount) {
 			/*
@@ -1963,12 +2110,14 @@ int XPlmi_StoreBuffer(XPlmi_Cmd *Cmd, u32 BufferId, XPlmi_BufferList *BufferList
 		BufferList->BufferCount++;
 		BufferList->Data[BufferList->BufferCount].Addr =
 				BufferList->Data[BufferList->BufferCount - 1U].Addr + CmdLenInBytes;
+		XPlmi_InvalidateBufferIndex(BufferList);
 	} else {
 		/* Handle command resume for proc data */
 		SrcAddr = (u32)(&Cmd->Payload[0U]);
 		CurrPayloadLen = Cmd->PayloadLen;
 	}
 
+COPY:
 	/* Copy the received proc to proc memory */
 	Status = XPlmi_DmaTransfer(Cmd->ResumeData[0U], SrcAddr, CurrPayloadLen,
 			XPLMI_PMCDMA_0);
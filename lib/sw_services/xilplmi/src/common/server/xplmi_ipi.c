@@ -84,6 +84,7 @@
  *       pre  07/11/2024 Throwing error if IPI request length is greater than XPLMI_MAX_IPI_CMD_LEN
  *       pre  07/30/2024 Fixed misrac violation
  *       am   08/22/2024 Fixed IPI acknowledgement prior to executing handlers
+ * 2.02  mb   10/16/2026 Record IPI arrival in the event trace
  *
  * </pre>
  *
@@ -325,6 +326,7 @@ static int XPlmi_IpiDispatchHandler(void *Data)
 		if (XST_SUCCESS != Status) {
 			goto END;
 		}
+		XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_IPI_RECV, Cmd.IpiMask);
 
 		/**
 		 * Get IPI request type
@@ -54,6 +54,8 @@
 *       ng   06/21/2023 Added support for system device-tree flow
 *       ng   01/28/2024 optimized u8 variables
 *       ma   03/05/2024 Fixed improper timestamp issue after In-place PLM update
+* 1.11  mb   10/16/2026 Restart PIT3 after In-place PLM update and pass the
+*                       scheduler tick to XPlmi_SchedulerInit
 *
 * </pre>
 *
@@ -317,17 +319,17 @@ int XPlmi_StartTimer(void)
 		goto END;
 	}
 
-	if (XPlmi_IsPlmUpdateDone() != (u8)TRUE) {
-		/*
-		 * PLM scheduler is running too fast for QEMU, so increasing the
-		 * scheduler's poling time to 100ms for QEMU instead of 10ms
-		*/
-		if (XPLMI_PLATFORM == PMC_TAP_VERSION_QEMU) {
-			Pit3ResetValue = PmcIroFreq / XPLMI_PIT_FREQ_DIVISOR_QEMU;
-		} else {
-			Pit3ResetValue = PmcIroFreq / XPLMI_PIT_FREQ_DIVISOR;
-		}
+	/*
+	 * PLM scheduler is running too fast for QEMU, so increasing the
+	 * scheduler's poling time to 100ms for QEMU instead of 10ms
+	*/
+	if (XPLMI_PLATFORM == PMC_TAP_VERSION_QEMU) {
+		Pit3ResetValue = PmcIroFreq / XPLMI_PIT_FREQ_DIVISOR_QEMU;
+	} else {
+		Pit3ResetValue = PmcIroFreq / XPLMI_PIT_FREQ_DIVISOR;
+	}
 
+	if (XPlmi_IsPlmUpdateDone() != (u8)TRUE) {
 		/**
 		 * - Initialize and start the timer
 		 *   - Use PIT1 and PIT2 in prescaler mode
@@ -337,10 +339,14 @@ int XPlmi_StartTimer(void)
 			MB_IOMODULE_GPO1_PIT1_PRESCALE_SRC_MASK);
 		XPlmi_InitPitTimer(XPLMI_PIT2, XPLMI_PIT2_RESET_VALUE);
 		XPlmi_InitPitTimer(XPLMI_PIT1, XPLMI_PIT1_RESET_VALUE);
-		XPlmi_InitPitTimer(XPLMI_PIT3, Pit3ResetValue);
 	}
 
-	XPlmi_SchedulerInit();
+	/**
+	 * - PIT3 is restarted with one scheduler tick also after In-Place PLM
+	 *   Update, as the scheduler may have programmed it for several ticks
+	 */
+	XPlmi_InitPitTimer(XPLMI_PIT3, Pit3ResetValue);
+	XPlmi_SchedulerInit(Pit3ResetValue);
 
 END:
 	return Status;
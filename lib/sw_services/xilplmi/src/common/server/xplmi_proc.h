@@ -40,6 +40,7 @@
 * 1.08  bm   04/28/2023 Update Trim related macros
 * 1.09  ng   07/06/2023 Added support for SDT flow
 *       ma   03/05/2024 Fixed improper timestamp issue after In-place PLM update
+* 1.10  mb   10/16/2026 Added XPLMI_MB_MSR_IE_MASK
 *
 * </pre>
 *
@@ -85,6 +86,9 @@ extern "C" {
 #define XPLMI_MEGA			(1000000U)
 #define XPLMI_KILO			(1000U)
 
+/** MicroBlaze MSR interrupt enable bit */
+#define XPLMI_MB_MSR_IE_MASK		(0x2U)
+
 #define XPLMI_EFUSE_IRO_TRIM_SLOW	(0U)
 #define XPLMI_EFUSE_IRO_TRIM_FAST	(1U)
 
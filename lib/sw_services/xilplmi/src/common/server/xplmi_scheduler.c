@@ -11,6 +11,14 @@
 *
 * This file contains code related to scheduler.
 *
+* Scheduler tasks are kept in a timer wheel of XPLMI_SCHED_WHEEL_SIZE buckets
+* hashed by the tick at which they are due, so on every tick only the bucket
+* of that tick is visited. The tasks of a bucket are sorted by trigger time,
+* so the earliest task of the wheel is one of the bucket heads. Task slots come from a free list which is filled
+* with a default pool and can be extended by modules with
+* XPlmi_SchedulerAddSlots(). When WDT is not enabled, PIT3 is programmed to
+* expire at the tick of the next due task instead of every tick.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -50,6 +58,13 @@
 *       dd   09/12/2023 MISRA-C violation Rule 13.4 fixed
 * 2.00  ng   12/27/2023 Reduced log level for less frequent prints
 *       ng   01/28/2024 optimized u8 variables
+* 2.01  mb   10/16/2026 Replaced fixed task list scan with a hashed timer
+*                       wheel, added XPlmi_SchedulerAddSlots and program
+*                       PIT3 for the next due task when WDT is disabled
+*       mb   10/16/2026 Use XPlmi_TaskRemove to dequeue removed tasks
+*       mb   10/16/2026 Restore the caller's interrupt state
+*       mb   10/16/2026 Keep the tasks of a bucket sorted, track the next due
+*                       task and reject periodic tasks under one tick
 *
 * </pre>
 *
@@ -61,12 +76,21 @@
 #include "xplmi_scheduler.h"
 #include "xplmi_debug.h"
 #include "xplmi_wdt.h"
+#include "xplmi_proc.h"
+#include "xplmi_plat.h"
 
 /**@cond xplmi_internal
  * @{
  */
 
 /************************** Constant Definitions *****************************/
+#define XPLMI_SCHED_HALF_RANGE		(0x80000000U) /**< Tick distance up to
+						which a tick is treated as
+						reached */
+#define XPLMI_SCHED_MAX_PIT_VALUE	(0xFFFFFFFFU) /**< Largest PIT3 reset
+						value */
+#define XPLMI_SCHED_MIN_CYCLES_SHIFT	(4U) /**< PIT3 is programmed for at
+						least 1/16th of a tick */
 
 /**************************** Type Definitions *******************************/
 
@@ -78,72 +102,334 @@
  */
 
 /************************** Function Prototypes ******************************/
-static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
-	u32 TaskListIndex);
+static u8 XPlmi_IsTaskNonPeriodic(const struct XPlmi_Task_t *TaskPtr);
+static u8 XPlmi_SchedIsTickReached(u32 TriggerTime, u32 Tick);
+static void XPlmi_SchedInsertTask(struct XPlmi_Task_t *TaskPtr);
+static void XPlmi_SchedFreeTask(struct XPlmi_Task_t *TaskPtr);
+static void XPlmi_SchedAddFreeSlots(struct XPlmi_Task_t *Slots, u32 Count);
+static u32 XPlmi_SchedGetTicksToNext(void);
+static void XPlmi_SchedProgramPit(u32 Cycles);
+static void XPlmi_SchedSetTimer(u64 Now, u8 IsTickHandler);
+static u32 XPlmi_SchedRemoveFromBucket(struct metal_list *Bucket,
+	u32 OwnerId, XPlmi_Callback_t CallbackFn, u32 MilliSeconds,
+	const void *Data);
 
 /************************** Variable Definitions *****************************/
 static XPlmi_Scheduler_t Sched;
+static struct XPlmi_Task_t SchedSlots[XPLMI_SCHED_MAX_TASK];
 
 /*****************************************************************************/
 
 /******************************************************************************/
 /**
-* @brief	The function checks the specified task is active or not, returns
-* 			corresponding status of the task
+* @brief	The function checks the specified task is periodic or not, returns
+* 			corresponding periodicity status.
 *
-* @param   	SchedPtr is Scheduler pointer
-* @param   	TaskListIndex is Task index
+* @param    TaskPtr is pointer to the scheduler task
 *
-* @return	TRUE or FALSE based on the task active status
+* @return	TRUE or FALSE based on the task peridocity status
 *
 ****************************************************************************/
-static u8 XPlmi_IsTaskActive(XPlmi_Scheduler_t *SchedPtr, u32 TaskListIndex)
+static u8 XPlmi_IsTaskNonPeriodic(const struct XPlmi_Task_t *TaskPtr)
 {
 	u8 ReturnVal = (u8)FALSE;
 
-	if (NULL == SchedPtr->TaskList[TaskListIndex].CustomerFunc) {
-		goto END;
+	if (TaskPtr->Type == XPLMI_NON_PERIODIC_TASK) {
+		ReturnVal = (u8)TRUE;
 	}
 
-	if (XPlmi_IsTaskNonPeriodic(SchedPtr, TaskListIndex) == (u8)TRUE) {
-		if (SchedPtr->TaskList[TaskListIndex].TriggerTime <=
-			SchedPtr->Tick) {
-			ReturnVal = (u8)TRUE;
+	return ReturnVal;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function checks if a trigger time is reached at the given
+* 			tick, taking the wrap of the tick counter into account.
+*
+* @param	TriggerTime is the tick to be checked
+* @param	Tick is the current tick
+*
+* @return	TRUE if TriggerTime is not after Tick, FALSE otherwise
+*
+****************************************************************************/
+static u8 XPlmi_SchedIsTickReached(u32 TriggerTime, u32 Tick)
+{
+	u8 ReturnVal = (u8)FALSE;
+
+	if ((Tick - TriggerTime) < XPLMI_SCHED_HALF_RANGE) {
+		ReturnVal = (u8)TRUE;
+	}
+
+	return ReturnVal;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function links the task into the wheel bucket of its trigger
+* 			time, after the tasks of the bucket which are due at or before
+* 			it. A task is due on the next tick at the earliest. It must be
+* 			called with interrupts disabled.
+*
+* @param	TaskPtr is pointer to the scheduler task
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedInsertTask(struct XPlmi_Task_t *TaskPtr)
+{
+	struct metal_list *Bucket;
+	struct metal_list *Node;
+	const struct XPlmi_Task_t *Prev;
+
+	if (XPlmi_SchedIsTickReached(TaskPtr->TriggerTime, Sched.Tick) ==
+		(u8)TRUE) {
+		TaskPtr->TriggerTime = Sched.Tick + 1U;
+	}
+
+	Bucket = &Sched.Wheel[TaskPtr->TriggerTime & XPLMI_SCHED_WHEEL_MASK];
+	Node = Bucket->prev;
+	while (Node != Bucket) {
+		Prev = metal_container_of(Node, struct XPlmi_Task_t, Node);
+		if (XPlmi_SchedIsTickReached(Prev->TriggerTime,
+			TaskPtr->TriggerTime) == (u8)TRUE) {
+			break;
 		}
-	} else {
-		if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (0U == (SchedPtr->Tick
-		% SchedPtr->TaskList[TaskListIndex].Interval))) {
-			/* Periodic */
-			ReturnVal = (u8)TRUE;
+		Node = Node->prev;
+	}
+	metal_list_add_after(Node, &TaskPtr->Node);
+
+	/* A valid NextDue only has to be moved earlier */
+	if ((Sched.IsNextDueValid == (u8)TRUE) &&
+		(XPlmi_SchedIsTickReached(Sched.NextDue,
+			TaskPtr->TriggerTime) == (u8)FALSE)) {
+		Sched.NextDue = TaskPtr->TriggerTime;
+	}
+}
+
+/******************************************************************************/
+/**
+* @brief	The function unlinks the task from the wheel and returns its slot
+* 			to the free list. It must be called with interrupts disabled.
+*
+* @param	TaskPtr is pointer to the scheduler task
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedFreeTask(struct XPlmi_Task_t *TaskPtr)
+{
+	if (TaskPtr->TriggerTime == Sched.NextDue) {
+		Sched.IsNextDueValid = (u8)FALSE;
+	}
+	metal_list_del(&TaskPtr->Node);
+	TaskPtr->Interval = 0U;
+	TaskPtr->OwnerId = 0U;
+	TaskPtr->CustomerFunc = NULL;
+	TaskPtr->ErrorFunc = NULL;
+	TaskPtr->Data = NULL;
+	metal_list_add_tail(&Sched.FreeList, &TaskPtr->Node);
+	Sched.TaskCount--;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function adds the given slots to the free list.
+*
+* @param	Slots is pointer to the array of slots
+* @param	Count is the number of slots in the array
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedAddFreeSlots(struct XPlmi_Task_t *Slots, u32 Count)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Count; Idx++) {
+		Slots[Idx].Interval = 0U;
+		Slots[Idx].OwnerId = 0U;
+		Slots[Idx].CustomerFunc = NULL;
+		Slots[Idx].ErrorFunc = NULL;
+		Slots[Idx].Data = NULL;
+		metal_list_add_tail(&Sched.FreeList, &Slots[Idx].Node);
+	}
+}
+
+/******************************************************************************/
+/**
+* @brief	The function returns the number of ticks from the current tick
+* 			to the trigger time of the next due task, limited to
+* 			XPLMI_SCHED_MAX_IDLE_TICKS. When the next due task has been
+* 			triggered or removed, only the bucket heads are compared to
+* 			find the new one. It must be called with interrupts disabled.
+*
+* @return	Number of ticks to the next due task
+*
+****************************************************************************/
+static u32 XPlmi_SchedGetTicksToNext(void)
+{
+	u32 Ticks = XPLMI_SCHED_MAX_IDLE_TICKS;
+	u32 MinDelta = XPLMI_SCHED_HALF_RANGE;
+	u32 Delta;
+	u32 Idx;
+	const struct XPlmi_Task_t *TaskPtr;
+
+	if (Sched.TaskCount == 0U) {
+		goto END;
+	}
+
+	if (Sched.IsNextDueValid == (u8)FALSE) {
+		for (Idx = 0U; Idx < XPLMI_SCHED_WHEEL_SIZE; Idx++) {
+			if (metal_list_is_empty(&Sched.Wheel[Idx]) == (int)TRUE) {
+				continue;
+			}
+			TaskPtr = metal_container_of(Sched.Wheel[Idx].next,
+				struct XPlmi_Task_t, Node);
+			Delta = TaskPtr->TriggerTime - Sched.Tick;
+			if (Delta < MinDelta) {
+				MinDelta = Delta;
+				Sched.NextDue = TaskPtr->TriggerTime;
+			}
 		}
+		Sched.IsNextDueValid = (u8)TRUE;
+	}
+
+	Delta = Sched.NextDue - Sched.Tick;
+	if ((Delta == 0U) || (Delta >= XPLMI_SCHED_HALF_RANGE)) {
+		Ticks = 1U;
+	}
+	else if (Delta < Ticks) {
+		Ticks = Delta;
+	}
+	else {
+		/* Sleep for XPLMI_SCHED_MAX_IDLE_TICKS at most */
 	}
 
 END:
-	return ReturnVal;
+	return Ticks;
 }
 
 /******************************************************************************/
 /**
-* @brief	The function checks the specified task is periodic or not, returns
-* 			corresponding periodicity status.
+* @brief	The function restarts PIT3 with the given reset value.
 *
-* @param    SchedPtr is the Scheduler pointer
-* @param    TaskListIndex is the Task index
+* @param	Cycles is the PIT3 reset value
 *
-* @return	TRUE or FALSE based on the task peridocity status
+* @return	None
 *
 ****************************************************************************/
-static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
-	u32 TaskListIndex)
+static void XPlmi_SchedProgramPit(u32 Cycles)
 {
-	u8 ReturnVal = (u8)FALSE;
+	XIOModule *IOModule = XPlmi_GetIOModuleInst();
 
-	if (SchedPtr->TaskList[TaskListIndex].Type == XPLMI_NON_PERIODIC_TASK) {
-		ReturnVal = (u8)TRUE;
+	/* Reset value is loaded into PIT3 when it is started */
+	XIOModule_Timer_Stop(IOModule, (u8)XPLMI_PIT3);
+	XIOModule_SetResetValue(IOModule, (u8)XPLMI_PIT3, Cycles);
+	XIOModule_Timer_Start(IOModule, (u8)XPLMI_PIT3);
+}
+
+/******************************************************************************/
+/**
+* @brief	The function programs PIT3 to expire at the trigger time of the
+* 			next due task. While WDT is enabled, PIT3 expires every tick as
+* 			WDT handler has to be called periodically. It must be called
+* 			with interrupts disabled.
+*
+* @param	Now is the current timer value
+* @param	IsTickHandler is TRUE when called from the scheduler handler
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedSetTimer(u64 Now, u8 IsTickHandler)
+{
+	u32 Ticks = 1U;
+	u32 MaxTicks = XPLMI_SCHED_MAX_PIT_VALUE / Sched.TickCycles;
+	u32 MinCycles = Sched.TickCycles >> XPLMI_SCHED_MIN_CYCLES_SHIFT;
+	u64 Cycles;
+	u64 Elapsed;
+
+	if (XPlmi_IsWdtEnabled() == (u8)FALSE) {
+		Ticks = XPlmi_SchedGetTicksToNext();
+		if (Ticks > MaxTicks) {
+			Ticks = MaxTicks;
+		}
 	}
 
-	return ReturnVal;
+	if (IsTickHandler == (u8)TRUE) {
+		/**
+		 * - PIT3 has just reloaded at the start of the tick, so it is
+		 *   reprogrammed only if the number of ticks changes
+		 */
+		if (Ticks != Sched.PitTicks) {
+			XPlmi_SchedProgramPit(Ticks * Sched.TickCycles);
+			Sched.PitTicks = Ticks;
+		}
+		Sched.NextTick = Sched.Tick + Ticks;
+	}
+	else if (XPlmi_SchedIsTickReached(Sched.NextTick, Sched.Tick + Ticks) ==
+		(u8)FALSE) {
+		/**
+		 * - Otherwise PIT3 is reprogrammed only if the next due tick is
+		 *   before the programmed one, for the remaining cycles
+		 */
+		Elapsed = Sched.LastTimerTick - Now;
+		Cycles = (u64)Ticks * Sched.TickCycles;
+		if (Cycles > (Elapsed + MinCycles)) {
+			Cycles -= Elapsed;
+		}
+		else {
+			Cycles = MinCycles;
+		}
+		XPlmi_SchedProgramPit((u32)Cycles);
+		Sched.PitTicks = 0U;
+		Sched.NextTick = Sched.Tick + Ticks;
+	}
+	else {
+		/* PIT3 already expires in time */
+	}
+}
+
+/******************************************************************************/
+/**
+* @brief	The function removes the matching tasks of a wheel bucket. It
+* 			must be called with interrupts disabled.
+*
+* @param	Bucket is the wheel bucket to search
+* @param	OwnerId Id of the owner given while adding the task
+* @param	CallbackFn callback function given while adding the task
+* @param	MilliSeconds Periodicity of the task, 0 matches any
+* @param	Data is the pointer to the private data of the task
+*
+* @return	Number of removed tasks
+*
+****************************************************************************/
+static u32 XPlmi_SchedRemoveFromBucket(struct metal_list *Bucket,
+	u32 OwnerId, XPlmi_Callback_t CallbackFn, u32 MilliSeconds,
+	const void *Data)
+{
+	u32 TaskCount = 0U;
+	struct metal_list *Node = Bucket->next;
+	struct metal_list *Next;
+	struct XPlmi_Task_t *TaskPtr;
+
+	while (Node != Bucket) {
+		Next = Node->next;
+		TaskPtr = metal_container_of(Node, struct XPlmi_Task_t, Node);
+		if ((CallbackFn == TaskPtr->CustomerFunc) &&
+			(TaskPtr->OwnerId == OwnerId) &&
+			(TaskPtr->Data == Data) &&
+			((TaskPtr->Interval ==
+				(MilliSeconds / XPLMI_SCHED_TICK)) ||
+				(0U == MilliSeconds))) {
+			XPlmi_TaskRemove(TaskPtr->Task);
+			XPlmi_SchedFreeTask(TaskPtr);
+			TaskCount++;
+		}
+		Node = Next;
+	}
+
+	return TaskCount;
 }
 
 /******************************************************************************/
@@ -151,29 +437,87 @@ static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
 * @brief	The function initializes scheduler and returns the
 * 			initialization status.
 *
+* @param	TickCycles is the number of timer cycles of a scheduler tick,
+* 			PIT3 must be started with it as reset value
+*
 * @return
 * 			- None
 *
 ****************************************************************************/
-void XPlmi_SchedulerInit(void)
+void XPlmi_SchedulerInit(u32 TickCycles)
 {
 	u32 Idx;
 
-	/* Disable all the tasks */
-	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
-		Sched.TaskList[Idx].Interval = 0U;
-		Sched.TaskList[Idx].CustomerFunc = NULL;
+	for (Idx = 0U; Idx < XPLMI_SCHED_WHEEL_SIZE; Idx++) {
+		metal_list_init(&Sched.Wheel[Idx]);
 	}
+	metal_list_init(&Sched.FreeList);
+	XPlmi_SchedAddFreeSlots(SchedSlots, XPLMI_SCHED_MAX_TASK);
+	Sched.TaskCount = 0U;
 
+	Sched.TickCycles = TickCycles;
 	Sched.LastTimerTick = XPlmi_GetTimerValue();
 	Sched.Tick = 0U;
+	Sched.PitTicks = 1U;
+	Sched.NextTick = 1U;
+	Sched.IsNextDueValid = (u8)FALSE;
 }
 
 /******************************************************************************/
 /**
-* @brief	The function is scheduler handler and it is called at regular
-* 			intervals based on configured interval. Scheduler handler checks
-* 			and adds the user periodic task to PLM task queue.
+* @brief	The function adds slots for scheduler tasks. The slots are used in
+* 			addition to the XPLMI_SCHED_MAX_TASK default slots, so modules
+* 			having more scheduler tasks provide the storage for them. It
+* 			shall be called after the scheduler is initialized.
+*
+* @param	Slots is pointer to the array of slots, it must not be freed
+* @param	Count is the number of slots in the array
+*
+* @return
+* 			- None
+*
+****************************************************************************/
+void XPlmi_SchedulerAddSlots(struct XPlmi_Task_t *Slots, u32 Count)
+{
+	u32 Msr = mfmsr();
+
+	mtmsr(Msr & (~XPLMI_MB_MSR_IE_MASK));
+	XPlmi_SchedAddFreeSlots(Slots, Count);
+	mtmsr(Msr);
+}
+
+/******************************************************************************/
+/**
+* @brief	The function reprograms PIT3 for the current scheduler state. It
+* 			is called when WDT gets enabled, so that the scheduler ticks
+* 			every period from then on.
+*
+* @return
+* 			- None
+*
+****************************************************************************/
+void XPlmi_SchedulerUpdateTimer(void)
+{
+	u32 Msr;
+
+	if (Sched.TickCycles == 0U) {
+		goto END;
+	}
+
+	Msr = mfmsr();
+	mtmsr(Msr & (~XPLMI_MB_MSR_IE_MASK));
+	XPlmi_SchedSetTimer(XPlmi_GetTimerValue(), (u8)FALSE);
+	mtmsr(Msr);
+
+END:
+	return;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function is scheduler handler and it is called when PIT3
+* 			expires. Scheduler handler checks the wheel buckets of the
+* 			elapsed ticks and adds the due tasks to PLM task queue.
 *
 * @param	Data - Not used currently. Added as a part of generic interrupt
 * 			handler
@@ -184,55 +528,118 @@ void XPlmi_SchedulerInit(void)
 ****************************************************************************/
 void XPlmi_SchedulerHandler(void *Data)
 {
+	u64 Now = XPlmi_GetTimerValue();
+	u32 Ticks = 1U;
+	u32 MinTicks;
+	u32 StartTick;
+	u32 Buckets;
 	u32 Idx;
-	(void)Data;
+	struct metal_list DueList;
+	struct metal_list *Bucket;
+	struct metal_list *Node;
+	struct metal_list *Next;
+	struct XPlmi_Task_t *TaskPtr;
 	XPlmi_TaskNode *Task = NULL;
+	(void)Data;
 
-	Sched.LastTimerTick = XPlmi_GetTimerValue();
-	Sched.Tick++;
 	XPlmi_UtilRMW(PMC_PMC_MB_IO_IRQ_ACK, PMC_PMC_MB_IO_IRQ_ACK, 0x20U);
-	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
+	/**
+	 * - If PIT3 is not programmed for one tick, get the elapsed ticks
+	 *   from the timer, at least up to the programmed tick
+	 */
+	if (Sched.PitTicks != 1U) {
+		Ticks = (u32)((Sched.LastTimerTick - Now +
+			(Sched.TickCycles >> 1U)) / Sched.TickCycles);
+		MinTicks = Sched.NextTick - Sched.Tick;
+		if ((MinTicks == 0U) || (MinTicks >= XPLMI_SCHED_HALF_RANGE)) {
+			MinTicks = 1U;
+		}
+		if (Ticks < MinTicks) {
+			Ticks = MinTicks;
+		}
+	}
+	Sched.LastTimerTick = Now;
+	StartTick = Sched.Tick;
+	Sched.Tick += Ticks;
+
+	/**
+	 * - Move the due tasks from the heads of the buckets of the elapsed
+	 *   ticks to a list, all the buckets are visited after a full
+	 *   revolution
+	 */
+	metal_list_init(&DueList);
+	Buckets = Ticks;
+	if (Buckets > XPLMI_SCHED_WHEEL_SIZE) {
+		Buckets = XPLMI_SCHED_WHEEL_SIZE;
+	}
+	for (Idx = 1U; Idx <= Buckets; Idx++) {
+		Bucket = &Sched.Wheel[(StartTick + Idx) & XPLMI_SCHED_WHEEL_MASK];
+		Node = Bucket->next;
+		while (Node != Bucket) {
+			Next = Node->next;
+			TaskPtr = metal_container_of(Node, struct XPlmi_Task_t, Node);
+			if (XPlmi_SchedIsTickReached(TaskPtr->TriggerTime,
+				Sched.Tick) == (u8)FALSE) {
+				break;
+			}
+			metal_list_del(Node);
+			metal_list_add_tail(&DueList, Node);
+			Node = Next;
+		}
+	}
+	if (metal_list_is_empty(&DueList) == (int)FALSE) {
+		Sched.IsNextDueValid = (u8)FALSE;
+	}
+
+	Node = DueList.next;
+	while (Node != &DueList) {
+		Next = Node->next;
+		TaskPtr = metal_container_of(Node, struct XPlmi_Task_t, Node);
+		Task = TaskPtr->Task;
 		/**
-		 * - Check if the task is active and has a valid Callback
+		 * - Skip the task, if its already present in the queue
 		 */
-		if (XPlmi_IsTaskActive(&Sched, Idx) == (u8)TRUE) {
-			Task = Sched.TaskList[Idx].Task;
+		if (metal_list_is_empty(&Task->TaskNode) == (int)TRUE) {
+			Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
+			XPlmi_TaskTriggerNow(Task);
+		} else {
 			/**
-			 * - Skip the task, if its already present in the queue
+			 * - Check if a module has registered ErrorFunc for the task and
+			 * the previously scheduled task is executed or not
 			 */
-			if (metal_list_is_empty(&Task->TaskNode) == (int)TRUE) {
-				Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
-				XPlmi_TaskTriggerNow(Task);
-			} else {
+			if ((TaskPtr->ErrorFunc != NULL) &&
+				((Task->State & (u8)(XPLMI_SCHED_TASK_MISSED)) ==
+						(u8)0x0U)) {
 				/**
-				 * - Check if a module has registered ErrorFunc for the task and
-				 * the previously scheduled task is executed or not
+				 * - Update scheduler task state with task missed flag
 				 */
-				if ((Sched.TaskList[Idx].ErrorFunc != NULL) &&
-					((Task->State & (u8)(XPLMI_SCHED_TASK_MISSED)) ==
-							(u8)0x0U)) {
-					/**
-					 * - Update scheduler task state with task missed flag
-					 */
-					Task->State |= (u8)XPLMI_SCHED_TASK_MISSED;
-					/**
-					 * - Call the task specific ErrorFunc if
-					 *   previously scheduled task is not executed
-					 */
-					Sched.TaskList[Idx].ErrorFunc(XPLMI_ERR_SCHED_TASK_MISSED);
-				}
-			}
-			/**
-			 * - Remove the task from scheduler if it is non-periodic
-			 */
-			if (Sched.TaskList[Idx].Type == XPLMI_NON_PERIODIC_TASK) {
-				Sched.TaskList[Idx].OwnerId = 0U;
-				Sched.TaskList[Idx].CustomerFunc = NULL;
-				Sched.TaskList[Idx].ErrorFunc = NULL;
+				Task->State |= (u8)XPLMI_SCHED_TASK_MISSED;
+				/**
+				 * - Call the task specific ErrorFunc if
+				 *   previously scheduled task is not executed
+				 */
+				TaskPtr->ErrorFunc(XPLMI_ERR_SCHED_TASK_MISSED);
 			}
 		}
+		/**
+		 * - Remove the task from scheduler if it is non-periodic,
+		 *   else move it to the bucket of its next interval
+		 */
+		if (XPlmi_IsTaskNonPeriodic(TaskPtr) == (u8)TRUE) {
+			XPlmi_SchedFreeTask(TaskPtr);
+		} else {
+			metal_list_del(Node);
+			TaskPtr->TriggerTime += (((Sched.Tick - TaskPtr->TriggerTime) /
+				TaskPtr->Interval) + 1U) * TaskPtr->Interval;
+			XPlmi_SchedInsertTask(TaskPtr);
+		}
+		Node = Next;
 	}
-	XPlmi_WdtHandler();
+
+	for (Idx = 0U; Idx < Ticks; Idx++) {
+		XPlmi_WdtHandler();
+	}
+	XPlmi_SchedSetTimer(Now, (u8)TRUE);
 
 	return;
 }
@@ -248,7 +655,8 @@ void XPlmi_SchedulerHandler(void *Data)
 * 			on scheduled interval
 * @param	MilliSeconds For Periodic tasks, it's the Periodicity of the task.
 *			For Non-Periodic tasks, it's the delay after which task has to
-*			be scheduled. Value should be in multiples of 10ms
+*			be scheduled. Value should be in multiples of 10ms and at
+*			least 10ms for periodic tasks.
 * @param	Priority is the priority of the task
 * @param	Data is the pointer to the private data of the task
 * @param	TaskType is the type of Task (periodic or non-periodic)
@@ -259,6 +667,7 @@ void XPlmi_SchedulerHandler(void *Data)
 * 			- XPLMI_ERR_INVALID_TASK_PERIOD on invalid task period.
 * 			- XPLMI_ERR_TASK_EXISTS if task is already present.
 * 			- XPLM_ERR_TASK_CREATE if failed to create the task.
+* 			- XST_FAILURE if no free scheduler slot is available.
 *
 ****************************************************************************/
 int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
@@ -267,10 +676,12 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 {
 	int Status = XST_FAILURE;
 	XPlmi_PerfTime ExtraTime;
-	u32 Idx;
-	u32 TriggerTime = 0U;
+	u32 Interval = MilliSeconds / XPLMI_SCHED_TICK;
+	u32 CurTick;
+	u32 Msr;
+	struct metal_list *Node;
+	struct XPlmi_Task_t *TaskPtr;
 	XPlmi_TaskNode *Task = NULL;
-	u8 TaskNodePresent = (u8)FALSE;
 
 	if ((TaskType !=  XPLMI_PERIODIC_TASK) &&
 		(TaskType != XPLMI_NON_PERIODIC_TASK)) {
@@ -278,7 +689,7 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 		goto END;
 	}
 
-	if ((TaskType == XPLMI_PERIODIC_TASK) && (MilliSeconds == 0U)) {
+	if ((TaskType == XPLMI_PERIODIC_TASK) && (Interval == 0U)) {
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_INVALID_TASK_PERIOD, 0);
 		goto END;
 	}
@@ -288,56 +699,70 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			Status = XPlmi_UpdateStatus(XPLMI_ERR_TASK_EXISTS, 0);
 			goto END;
 		}
-		else {
-			TaskNodePresent = (u8)TRUE;
+	}
+	else {
+		/**
+		 * - Create a new task if task instance not found
+		 */
+		Task = XPlmi_TaskCreate(Priority, CallbackFn, Data);
+		if (Task == NULL) {
+			Status = XPlmi_UpdateStatus(XPLM_ERR_TASK_CREATE, 0);
+			XPlmi_Printf(DEBUG_INFO, "Task Creation "
+					"Err:0x%x\n\r", Status);
+			goto END;
 		}
 	}
+	Task->IntrId = XPLMI_INVALID_INTR_ID;
 
 	/**
-	 * - Get the Next Free Task Index
+	 * - Restore the interrupt state of the caller at the end, as tasks
+	 *   may be added with interrupts disabled
 	 */
-	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
-		if (NULL == Sched.TaskList[Idx].CustomerFunc) {
-			/**
-			 * - Add Interval as a factor of TICK_MILLISECONDS
-			 */
-			Sched.TaskList[Idx].Interval = MilliSeconds / XPLMI_SCHED_TICK;
-			Sched.TaskList[Idx].OwnerId = OwnerId;
-			Sched.TaskList[Idx].CustomerFunc = CallbackFn;
-			Sched.TaskList[Idx].ErrorFunc = ErrorFunc;
-			Sched.TaskList[Idx].Type = TaskType;
-			Sched.TaskList[Idx].Data = Data;
-			/**
-			 * - Create a new task if task instance not found
-			 */
-			if (TaskNodePresent == (u8)FALSE) {
-				Task = XPlmi_TaskCreate(Priority, CallbackFn, Data);
-			}
+	Msr = mfmsr();
+	mtmsr(Msr & (~XPLMI_MB_MSR_IE_MASK));
+	/**
+	 * - Get the Next Free Task slot
+	 */
+	Node = metal_list_first(&Sched.FreeList);
+	if (Node == NULL) {
+		mtmsr(Msr);
+		XPlmi_Printf(DEBUG_INFO, "Scheduler slots are full\n\r");
+		goto END;
+	}
+	metal_list_del(Node);
+	TaskPtr = metal_container_of(Node, struct XPlmi_Task_t, Node);
+	TaskPtr->Interval = Interval;
+	TaskPtr->OwnerId = OwnerId;
+	TaskPtr->CustomerFunc = CallbackFn;
+	TaskPtr->ErrorFunc = ErrorFunc;
+	TaskPtr->Type = TaskType;
+	TaskPtr->Data = Data;
+	TaskPtr->Task = Task;
+	Sched.TaskCount++;
 
-			if (Task == NULL) {
-				Status = XPlmi_UpdateStatus(XPLM_ERR_TASK_CREATE, 0);
-				XPlmi_Printf(DEBUG_INFO, "Task Creation "
-						"Err:0x%x\n\r", Status);
-				goto END;
-			}
-			Task->IntrId = XPLMI_INVALID_INTR_ID;
-			Sched.TaskList[Idx].Task = Task;
-			if (TaskType != XPLMI_PERIODIC_TASK) {
-				microblaze_disable_interrupts();
-				XPlmi_MeasurePerfTime(Sched.LastTimerTick, &ExtraTime);
-				if (Sched.Tick == 0U) {
-					ExtraTime.TPerfMs %= XPLMI_SCHED_TICK;
-				}
-				TriggerTime = Sched.Tick +
-					   (((u32)ExtraTime.TPerfMs + MilliSeconds) /
-					   XPLMI_SCHED_TICK);
-				microblaze_enable_interrupts();
-			}
-			Sched.TaskList[Idx].TriggerTime = TriggerTime;
-			Status = XST_SUCCESS;
-			break;
-		}
+	/**
+	 * - Get the current tick including the ticks elapsed since the last
+	 *   scheduler interrupt
+	 */
+	XPlmi_MeasurePerfTime(Sched.LastTimerTick, &ExtraTime);
+	if (Sched.Tick == 0U) {
+		ExtraTime.TPerfMs %= XPLMI_SCHED_TICK;
+	}
+	if (TaskType == XPLMI_PERIODIC_TASK) {
+		/**
+		 * - Periodic task is due at the next multiple of its interval
+		 */
+		CurTick = Sched.Tick + ((u32)ExtraTime.TPerfMs / XPLMI_SCHED_TICK);
+		TaskPtr->TriggerTime = ((CurTick / Interval) + 1U) * Interval;
 	}
+	else {
+		TaskPtr->TriggerTime = Sched.Tick +
+			(((u32)ExtraTime.TPerfMs + MilliSeconds) / XPLMI_SCHED_TICK);
+	}
+	XPlmi_SchedInsertTask(TaskPtr);
+	XPlmi_SchedSetTimer(XPlmi_GetTimerValue(), (u8)FALSE);
+	mtmsr(Msr);
+	Status = XST_SUCCESS;
 
 END:
 	return Status;
@@ -365,28 +790,15 @@ int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	int Status = XST_FAILURE;
 	u32 Idx;
 	u32 TaskCount = 0U;
+	u32 Msr = mfmsr();
 
-	/* Find the Task Index */
-	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
-		if ((CallbackFn == Sched.TaskList[Idx].CustomerFunc) &&
-			(Sched.TaskList[Idx].OwnerId == OwnerId) &&
-			(Sched.TaskList[Idx].Data == Data) &&
-			((Sched.TaskList[Idx].Interval ==
-				(MilliSeconds / XPLMI_SCHED_TICK)) ||
-				(0U == MilliSeconds))) {
-			Sched.TaskList[Idx].Interval = 0U;
-			Sched.TaskList[Idx].OwnerId = 0U;
-			Sched.TaskList[Idx].CustomerFunc = NULL;
-			Sched.TaskList[Idx].Data = NULL;
-			microblaze_disable_interrupts();
-			if (metal_list_is_empty(&Sched.TaskList[Idx].Task->TaskNode) ==
-				(int)FALSE) {
-				metal_list_del(&Sched.TaskList[Idx].Task->TaskNode);
-			}
-			microblaze_enable_interrupts();
-			TaskCount++;
-		}
+	mtmsr(Msr & (~XPLMI_MB_MSR_IE_MASK));
+	/* Find the Task in all the buckets */
+	for (Idx = 0U; Idx < XPLMI_SCHED_WHEEL_SIZE; Idx++) {
+		TaskCount += XPlmi_SchedRemoveFromBucket(&Sched.Wheel[Idx],
+			OwnerId, CallbackFn, MilliSeconds, Data);
 	}
+	mtmsr(Msr);
 
 	XPlmi_Printf(DEBUG_DETAILED, "%s: Removed %u tasks\r\n",
 			__func__, TaskCount);
@@ -32,6 +32,9 @@
 *       bsv  08/15/2021 Removed redundant element in structure
 * 1.04  bm   07/06/2022 Refactor versal and versal_net code
 * 1.05  nb   06/28/2023 Move XPLMI_SCHED_TICK here from .c file
+* 1.06  mb   10/16/2026 Replaced fixed task list with a timer wheel, added
+*                       XPlmi_SchedulerAddSlots and tickless idle
+*       mb   10/16/2026 Track the tick of the next due task
 *
 * </pre>
 *
@@ -54,18 +57,24 @@ extern "C" {
  */
 
 /************************** Constant Definitions *****************************/
-#define XPLMI_SCHED_MAX_TASK		(10U)
+#ifndef XPLMI_SCHED_MAX_TASK
+#define XPLMI_SCHED_MAX_TASK		(10U) /**< Slots in the default pool */
+#endif
 #define XPLMI_PERIODIC_TASK		(0U)
 #define XPLMI_NON_PERIODIC_TASK		(1U)
 #define XPLMI_SCHED_TICK		(10U)
+#define XPLMI_SCHED_WHEEL_SIZE		(16U) /**< Wheel buckets, power of 2 */
+#define XPLMI_SCHED_WHEEL_MASK		(XPLMI_SCHED_WHEEL_SIZE - 1U)
+#define XPLMI_SCHED_MAX_IDLE_TICKS	(100U) /**< Longest tickless sleep */
 
 typedef int (*XPlmi_Callback_t)(void *Data);
 typedef void (*XPlmi_ErrorFunc_t)(int Status);
 
 struct XPlmi_Task_t{
-	u32 Interval;
+	struct metal_list Node; /**< Wheel bucket or free list linkage */
+	u32 Interval; /**< Period in ticks, periodic tasks only */
 	u32 OwnerId;
-	u32 TriggerTime;
+	u32 TriggerTime; /**< Tick at which the task is due next */
 	XPlmi_Callback_t CustomerFunc;
 	XPlmi_ErrorFunc_t ErrorFunc;
 	XPlmi_TaskNode *Task;
@@ -74,19 +83,28 @@ struct XPlmi_Task_t{
 };
 
 typedef struct {
-	struct XPlmi_Task_t TaskList[XPLMI_SCHED_MAX_TASK];
-	u64 LastTimerTick;
-	u32 TaskCount;
-	u32 Tick;
+	struct metal_list Wheel[XPLMI_SCHED_WHEEL_SIZE]; /**< Tasks hashed
+			by TriggerTime */
+	struct metal_list FreeList; /**< Unused task slots */
+	u64 LastTimerTick; /**< Timer value at the last handled tick */
+	u32 TickCycles; /**< Timer cycles per scheduler tick */
+	u32 TaskCount; /**< Tasks in the wheel */
+	u32 Tick; /**< Scheduler ticks since init */
+	u32 NextTick; /**< Tick PIT3 is programmed to expire at */
+	u32 PitTicks; /**< Ticks PIT3 reload value is programmed for */
+	u32 NextDue; /**< Trigger time of the next due task */
+	u8 IsNextDueValid; /**< FALSE when NextDue has to be looked up */
 } XPlmi_Scheduler_t ;
 
-void XPlmi_SchedulerInit(void);
+void XPlmi_SchedulerInit(u32 TickCycles);
 void XPlmi_SchedulerHandler(void *Data);
 int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	XPlmi_ErrorFunc_t ErrorFunc, u32 MilliSeconds, TaskPriority_t Priority,
 	void *Data,	u8 TaskType);
 int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	u32 MilliSeconds, const void *Data);
+void XPlmi_SchedulerAddSlots(struct XPlmi_Task_t *Slots, u32 Count);
+void XPlmi_SchedulerUpdateTimer(void);
 
 /**
  * @}
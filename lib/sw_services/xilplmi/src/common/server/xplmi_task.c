@@ -45,6 +45,10 @@
 * 1.08  ng   11/11/2022 Updated doxygen comments
 * 2.00  ng   12/27/2023 Reduced log level for less frequent prints
 *       ng   01/28/2024 optimized u8 variables
+* 2.01  mb   10/16/2026 Select the next priority from a ready bitmap, dispatch
+*                       tasks of the same priority in batches and added
+*                       task queue wait statistics
+*       mb   10/16/2026 Record task start and end in the event trace
 *
 * </pre>
 *
@@ -64,11 +68,17 @@
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
+/* Ready bitmap bit of a priority, highest priority is the MSB */
+#define XPLMI_TASK_READY_BIT(Priority)	((u32)0x80000000U >> (Priority))
 
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
 static struct metal_list TaskQueue[XPLMI_TASK_PRIORITIES];
+static u32 TaskReadyMask; /**< Bit set for every non empty queue */
+#ifdef PLM_CMD_STATS
+static XPlmi_TaskStats TaskStats[XPLMI_TASK_PRIORITIES];
+#endif
 
 /*****************************************************************************/
 
@@ -166,6 +176,31 @@ void XPlmi_TaskTriggerNow(XPlmi_TaskNode *Task)
 	if (metal_list_is_empty(&Task->TaskNode) != (int)FALSE) {
 		metal_list_add_tail(&TaskQueue[Task->Priority],
 			&Task->TaskNode);
+		TaskReadyMask |= XPLMI_TASK_READY_BIT(Task->Priority);
+#ifdef PLM_CMD_STATS
+		Task->QueuedTime = XPlmi_GetTimerValue();
+#endif
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function removes the task from the task queue if it is
+ * queued. It must be called with interrupts disabled.
+ *
+ * @param	Task Pointer to the task node
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TaskRemove(XPlmi_TaskNode *Task)
+{
+	if (metal_list_is_empty(&Task->TaskNode) == (int)FALSE) {
+		metal_list_del(&Task->TaskNode);
+		if (metal_list_is_empty(&TaskQueue[Task->Priority]) !=
+			(int)FALSE) {
+			TaskReadyMask &= ~XPLMI_TASK_READY_BIT(Task->Priority);
+		}
 	}
 }
 
@@ -185,13 +220,43 @@ void XPlmi_TaskInit(void)
 	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
 		metal_list_init(&TaskQueue[Index]);
 	}
+	TaskReadyMask = 0U;
+}
+
+#ifdef PLM_CMD_STATS
+/*****************************************************************************/
+/**
+ * @brief	This function returns the queue statistics of all the task
+ * priorities.
+ *
+ * @return	Pointer to the array of XPLMI_TASK_PRIORITIES statistics
+ *
+ *****************************************************************************/
+XPlmi_TaskStats *XPlmi_GetTaskStats(void)
+{
+	return TaskStats;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function clears the task queue statistics.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_ClearTaskStats(void)
+{
+	(void)XPlmi_MemSetBytes(TaskStats, sizeof(TaskStats), 0U,
+		sizeof(TaskStats));
 }
+#endif
 
 /*****************************************************************************/
 /**
  * @brief	This function will be checking for tasks in the queue based on the
- * priority. After calling every task handlers, next high priority task will
- * be called.
+ * priority. The highest priority with pending tasks is taken from the ready
+ * bitmap and up to XPLMI_TASK_BATCH_MAX tasks of it are called in order,
+ * unless a task of higher priority gets ready in between.
  *
  * @return	None
  *
@@ -199,62 +264,68 @@ void XPlmi_TaskInit(void)
 void XPlmi_TaskDispatchLoop(void)
 {
 	int Status = XST_FAILURE;
-	struct metal_list *Node[XPLMI_TASK_PRIORITIES];
 	XPlmi_TaskNode *Task;
-	u32 Index;
+	u32 Priority;
+	u32 Count;
 #ifdef PLM_DEBUG_DETAILED
 	u64 TaskStartTime;
 	XPlmi_PerfTime PerfTime = {0U};
 #endif
+#ifdef PLM_CMD_STATS
+	u64 WaitTicks;
+#endif
 
 	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
-	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-		Node[Index] = &TaskQueue[Index];
-	}
 
 	while (TRUE) {
-		Task = NULL;
 		XPlmi_SetPlmLiveStatus();
 
 		microblaze_disable_interrupts();
 		/**
-		 * Perform Priority based task handling
+		 * Goto sleep when all queues are empty
+		 */
+		if (TaskReadyMask == 0U) {
+			XPlmi_Printf(DEBUG_DETAILED,
+				"No pending tasks..Going to sleep\n\r");
+			mb_sleep();
+			microblaze_enable_interrupts();
+			continue;
+		}
+
+		/**
+		 * - Get the highest priority with pending tasks
 		 */
-		for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
+		Priority = (u32)__builtin_clz(TaskReadyMask);
+#ifdef PLM_CMD_STATS
+		++TaskStats[Priority].Batches;
+#endif
+		for (Count = 0U; Count < XPLMI_TASK_BATCH_MAX; Count++) {
 			/**
-			 * If no pending tasks are present, go to sleep
+			 * - Get the next task of the priority in FIFO order
 			 */
-			if (metal_list_is_empty(&TaskQueue[Index]) != (int)FALSE) {
-				XPlmi_Printf(DEBUG_DETAILED,
-				 "No pending tasks in Priority%d Queue\n\r",
-				 Index);
-				continue;
-			} else {
-				/* Skip the first element as it
-				 * is not proper task
-				 */
-				if ((metal_list_is_empty(Node[Index]) != (int)FALSE) ||
-					(Node[Index] == &TaskQueue[Index])) {
-					Node[Index] = TaskQueue[Index].next;
-				}
-				/**
-				 * - Get the next task in round robin
-				 */
-				Task = metal_container_of(Node[Index],
-					XPlmi_TaskNode, TaskNode);
-				Node[Index] = Node[Index]->next;
+			if (metal_list_is_empty(&TaskQueue[Priority]) != (int)FALSE) {
 				break;
 			}
-		}
-		if (Task != NULL) {
+			Task = metal_container_of(TaskQueue[Priority].next,
+				XPlmi_TaskNode, TaskNode);
+			Xil_AssertVoid(Task->Handler != NULL);
+			XPlmi_TaskRemove(Task);
+#ifdef PLM_CMD_STATS
+			WaitTicks = Task->QueuedTime - XPlmi_GetTimerValue();
+			++TaskStats[Priority].Dispatched;
+			TaskStats[Priority].TotalWaitTicks += WaitTicks;
+			if (WaitTicks > TaskStats[Priority].MaxWaitTicks) {
+				TaskStats[Priority].MaxWaitTicks = (u32)WaitTicks;
+			}
+#endif
+			microblaze_enable_interrupts();
 #ifdef PLM_DEBUG_DETAILED
 			/* Call the task handler */
 			TaskStartTime = XPlmi_GetTimerValue();
 #endif
-			Xil_AssertVoid(Task->Handler != NULL);
-			metal_list_del(&Task->TaskNode);
-			microblaze_enable_interrupts();
+			XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_TASK_START, (UINTPTR)Task->Handler);
 			Status = Task->Handler(Task->PrivData);
+			XPLMI_EVT_TRACE(XPLMI_EVT_TRACE_TASK_END, (UINTPTR)Task->Handler);
 #ifdef PLM_DEBUG_DETAILED
 			XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
 			XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
@@ -263,15 +334,14 @@ void XPlmi_TaskDispatchLoop(void)
 			if (Status != XST_SUCCESS) {
 				XPlmi_ErrMgr(Status);
 			}
-			continue;
+			microblaze_disable_interrupts();
+			/**
+			 * - End the batch if a higher priority task got ready
+			 */
+			if ((TaskReadyMask >> (31U - Priority)) > 1U) {
+				break;
+			}
 		}
-
-		/**
-		 * Goto sleep when all queues are empty
-		 */
-		XPlmi_Printf(DEBUG_DETAILED,
-			"No pending tasks..Going to sleep\n\r");
-		mb_sleep();
 		microblaze_enable_interrupts();
 	}
 }
@@ -32,6 +32,8 @@
 * 1.05  bsv  03/05/2022 Fix exception while deleting two consecutive tasks of
 *                       same priority
 * 1.06  bm   01/03/2023 Create Secure Lockdown as a Critical Priority Task
+* 1.07  mb   10/16/2026 Added ready priority bitmap, batch dispatch and task
+*                       queue wait statistics
 *
 * </pre>
 *
@@ -51,6 +53,7 @@ extern "C" {
 #include "xil_types.h"
 #include "xstatus.h"
 #include "list.h"
+#include "xplmi_config.h"
 
 /**@cond xplmi_internal
  * @{
@@ -58,7 +61,10 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 #define XPLMI_TASK_MAX			(72U)
-#define XPLMI_TASK_PRIORITIES		(3U)
+#define XPLMI_TASK_PRIORITIES		(3U) /**< At most 32, one bit each in
+						the ready priority bitmap */
+#define XPLMI_TASK_BATCH_MAX		(4U) /**< Tasks of the same priority
+						dispatched in one pass */
 #define XPLMI_INVALID_INTR_ID		(0xFFFFFFFFU)
 
 
@@ -80,8 +86,23 @@ struct XPlmi_TaskNode {
     struct metal_list TaskNode;
     int (*Handler)(void * PrivData);
     void * PrivData;
+#ifdef PLM_CMD_STATS
+    u64 QueuedTime; /**< Timer value when the task was queued */
+#endif
 };
 
+#ifdef PLM_CMD_STATS
+/**
+ * Queue statistics of one task priority. Times are in PMC IRO timer ticks.
+ */
+typedef struct {
+	u32 Dispatched;	/**< Number of tasks dispatched */
+	u32 Batches;	/**< Number of dispatch passes */
+	u64 TotalWaitTicks;	/**< Total time tasks waited in the queue */
+	u32 MaxWaitTicks;	/**< Longest time a task waited in the queue */
+} XPlmi_TaskStats;
+#endif
+
 /***************** Macros (Inline Functions) Definitions *********************/
 /* Compute offset of a field within a structure. */
 #define metal_offset_of(structure, member)		\
@@ -99,6 +120,11 @@ void XPlmi_TaskInit(void);
 void XPlmi_TaskDispatchLoop(void);
 XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 	const void *PrivData, const u32 IntrId);
+void XPlmi_TaskRemove(XPlmi_TaskNode *Task);
+#ifdef PLM_CMD_STATS
+XPlmi_TaskStats *XPlmi_GetTaskStats(void);
+void XPlmi_ClearTaskStats(void);
+#endif
 
 /************************** Variable Definitions *****************************/
 
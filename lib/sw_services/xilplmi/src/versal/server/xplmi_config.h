@@ -49,6 +49,13 @@
 * 1.10  ng   06/21/2023 Added support for system device-tree flow
 *       ng   03/20/2024 Added CDO debug prints
 *       pre  07/11/2024 Implemented secure PLM to PLM communication
+* 1.11  mb   10/16/2026 Added PLM_CMD_STATS configuration macro
+*       mb   10/16/2026 Added task queue wait time to PLM_CMD_STATS
+*       mb   10/16/2026 Added PLM_CDO_WRITE_COALESCE configuration macro
+*       mb   10/16/2026 Added PLM_EVENT_TRACE configuration macro
+*       mb   10/16/2026 Added PLM_AUTH_CACHE configuration macro
+*       mb   10/16/2026 Enabled PLM_CMD_STATS by default, independent of
+*                       PLM_PRINT_PERF
 * </pre>
 *
 * @note
@@ -105,6 +112,13 @@ extern "C" {
 // To Enable CDO debug prints
 //#define CDO_DEBUG_ENABLE
 
+/**
+ * Enable the below define to execute runs of Write commands to consecutive
+ * NPI addresses in a CDO as one DMA transfer. Mask Write and other commands
+ * are executed one at a time.
+ */
+//#define PLM_CDO_WRITE_COALESCE
+
 /**
  * Enable the below define to disable prints from UART.
  * Prints to memory are still enabled as defined by PLM DEBUG macros
@@ -209,6 +223,34 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * PLM_CMD_STATS keeps the count, total, min and max time and a log2 latency
+ * histogram of every command ID executed by XPlmi_CmdExecute or as part of
+ * a coalesced Write run, and the time tasks of every priority wait in the
+ * task queue. They are retrieved through the event logging command. It is
+ * enabled by default, define PLM_CMD_STATS_EXCLUDE to exclude it.
+ */
+//#define PLM_CMD_STATS_EXCLUDE
+#if (!defined(PLM_CMD_STATS_EXCLUDE)) && (!defined(PLM_CMD_STATS))
+#define PLM_CMD_STATS
+#endif
+
+/**
+ * Enable the below define to record command start and end, task start and
+ * end, DMA start and done and IPI arrival as timestamped binary records in a
+ * ring in PPU RAM. The records are read incrementally through the event
+ * logging command and decoded on the host with misc/evt_trace.
+ */
+//#define PLM_EVENT_TRACE
+
+/**
+ * Enable the below define to remember the digest and public key of the last
+ * few successful RSA/ECDSA signature verifications, so that reloading the
+ * same partial PDI skips the signature verification. Hashing, PPK, SPK
+ * revocation checks and decryption are still done on every load.
+ */
+//#define PLM_AUTH_CACHE
+
 #define XPLMI_MJTAG_WA_GASKET_TOGGLE_CNT 10U /**< Number of clock cyles required
 					to change tap state to RESET */
 #define XPLMI_MJTAG_WA_DELAY_USED_IN_GASKET_TOGGLE 1U /**< Delay in usec in
@@ -26,6 +26,8 @@
 *       bm   01/14/2023 Remove bypassing of PLM Set Alive during boot
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
 *       ng   02/14/2024 removed int typecast for errors
+* 1.04  mb   10/16/2026 Added XPlmi_IsWdtEnabled and restart scheduler tick
+*                       when WDT is enabled
 *
 * </pre>
 *
@@ -39,6 +41,7 @@
 #include "xplmi_status.h"
 #include "xplmi_debug.h"
 #include "xplmi.h"
+#include "xplmi_scheduler.h"
 
 /**@cond xplmi_internal
  * @{
@@ -144,6 +147,8 @@ int XPlmi_EnableWdt(u32 NodeId, u32 Periodicity)
 
 	WdtInstance.Periodicity = Periodicity;
 	WdtInstance.IsEnabled = (u8)TRUE;
+	/* Scheduler must tick every period while WDT is serviced */
+	XPlmi_SchedulerUpdateTimer();
 	Status = XST_SUCCESS;
 
 END:
@@ -164,6 +169,18 @@ void XPlmi_DisableWdt(u32 NodeId)
 	WdtInstance.IsEnabled = (u8)FALSE;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the WDT is enabled.
+ *
+ * @return	TRUE if WDT is enabled, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XPlmi_IsWdtEnabled(void)
+{
+	return WdtInstance.IsEnabled;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function Sets the PLM Status.
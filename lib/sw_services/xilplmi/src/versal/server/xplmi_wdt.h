@@ -24,6 +24,7 @@
 * 1.02  bm   07/06/2022 Refactor versal and versal_net code
 * 1.03  ng   11/11/2022 Fixed doxygen file name error
 *       bm   01/14/2023 Remove bypassing of PLM Set Alive during boot
+* 1.04  mb   10/16/2026 Added XPlmi_IsWdtEnabled
 *
 * </pre>
 *
@@ -68,6 +69,7 @@ int XPlmi_EnableWdt(u32 NodeId, u32 Periodicity);
  */
 void XPlmi_DisableWdt(u32 NodeId);
 void XPlmi_WdtHandler(void);
+u8 XPlmi_IsWdtEnabled(void);
 
 #ifdef __cplusplus
 }
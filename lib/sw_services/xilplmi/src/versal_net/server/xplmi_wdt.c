@@ -23,6 +23,8 @@
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
 * 1.02  bm   05/01/2023 Fix Default PMC WDT timeout when Efuse is enabled
 *       ng   02/14/2024 removed int typecast for errors
+* 1.03  mb   10/16/2026 Added XPlmi_IsWdtEnabled and restart scheduler tick
+*                       when WDT is enabled
 *
 * </pre>
 *
@@ -38,6 +40,7 @@
 #include "xplmi.h"
 #include "xplmi_update.h"
 #include "xplmi_proc.h"
+#include "xplmi_scheduler.h"
 #ifdef XPLMI_PMC_WDT
 #include "xwdttb.h"
 #endif
@@ -244,6 +247,8 @@ int XPlmi_EnableWdt(u32 NodeId, u32 Periodicity)
 		WdtInstance.Periodicity = Periodicity;
 		WdtInstance.IsEnabled = (u8)TRUE;
 	}
+	/* Scheduler must tick every period while WDT is serviced */
+	XPlmi_SchedulerUpdateTimer();
 	Status = XST_SUCCESS;
 
 END:
@@ -318,6 +323,26 @@ void XPlmi_StopWdt(u32 NodeId)
 	}
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the external or PMC WDT is enabled.
+ *
+ * @return	TRUE if any WDT is enabled, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XPlmi_IsWdtEnabled(void)
+{
+	u8 IsEnabled = WdtInstance.IsEnabled;
+
+#ifdef XPLMI_PMC_WDT
+	if (PmcWdtInstance.WdtInst.IsEnabled == (u8)TRUE) {
+		IsEnabled = (u8)TRUE;
+	}
+#endif
+
+	return IsEnabled;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function Sets the PLM Status.
@@ -21,6 +21,7 @@
 * 1.00  bm   07/06/2022 Initial release
 * 1.01  ng   11/11/2022 Fixed doxygen file name error
 *       bm   01/14/2023 Remove bypassing of PLM Set Alive during boot
+* 1.02  mb   10/16/2026 Added XPlmi_IsWdtEnabled
 *
 * </pre>
 *
@@ -91,6 +92,7 @@ int XPlmi_DefaultSWdtConfig(void);
  */
 void XPlmi_DisableWdt(u32 NodeId);
 void XPlmi_WdtHandler(void);
+u8 XPlmi_IsWdtEnabled(void);
 
 #ifdef __cplusplus
 }
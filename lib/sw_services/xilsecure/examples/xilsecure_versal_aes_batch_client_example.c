@@ -0,0 +1,470 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+*
+* @file	xilsecure_versal_aes_batch_client_example.c
+* @addtogroup xsecure_versal_aes_batch_example XilSecure AES command batch API Example Usage
+* @{
+*
+* @note
+* This example illustrates the usage of the xilsecure command batch APIs with
+* the Versal AES client APIs using below tests
+* 	1. The AES GCM encryption of the data (init, AAD update, encrypt update and
+*	   final) and the decryption of the result are recorded into one command
+*	   batch and sent to PLM with a single IPI request. The test fails, if
+*	   decryption does not produce the original data or the GCM tag does not
+*	   match.
+* 	2. A client API which cannot be batched, AES write key, is called while a
+*	   batch is recorded. The test fails, if the API is not rejected with
+*	   XST_INVALID_PARAM.
+*
+* To build this application, xilmailbox library must be included in BSP and xilsecure
+* must be in client mode.
+* This example is supported for Versal and Versal Net devices.
+*
+* Procedure to link and compile the example for the default ddr less designs
+* ------------------------------------------------------------------------------------------------------------
+* The default linker settings places a software stack, heap and data in DDR memory. For this example to work,
+* any data shared between client running on A72/R5/PL and server running on PMC, should be placed in area
+* which is accessible to both client and server. This includes the command batch memory BatchMem, which
+* holds the command list and the shared memory of the batched commands.
+*
+* Following is the procedure to compile the example on OCM or any memory region which can be accessed by server
+*
+*		1. Open example linker script(lscript.ld) in Vitis project and section to memory mapping should
+*			be updated to point all the required sections to shared memory(OCM or TCM)
+*			using a memory region drop down selection
+*
+*						OR
+*
+*		1. In linker script(lscript.ld) user can add new memory section in source tab as shown below
+*			.sharedmemory : {
+*   			. = ALIGN(4);
+*   			__sharedmemory_start = .;
+*   			*(.sharedmemory)
+*   			*(.sharedmemory.*)
+*   			*(.gnu.linkonce.d.*)
+*   			__sharedmemory_end = .;
+* 			} > versal_cips_0_pspmc_0_psv_ocm_ram_0_psv_ocm_ram_0
+*
+* 		2. In this example ".data" section elements that are passed by reference to the server-side should
+* 		   be stored in the above shared memory section. To make it happen in below example,
+*		   replace ".data" in attribute section with ".sharedmemory". For example,
+* 	static u8 Data __attribute__ ((aligned (64U)) __attribute__ ((section (".data.Data")));
+* 					should be changed to
+* 	static u8 Data __attribute__ ((aligned (64U)) __attribute__ ((section (".sharedmemory.Data")));
+*
+* To keep things simple, by default the cache is disabled for this example
+*
+* MODIFICATION HISTORY:
+* <pre>
+* Ver   Who    Date     Changes
+* ----- ------ -------- -------------------------------------------------
+* 5.5   mb     10/16/26 First Release
+*
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_cache.h"
+#include "xil_util.h"
+#include "xsecure_aesclient.h"
+#include "xsecure_katclient.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Hardcoded KUP key for encryption of data */
+#define	XSECURE_AES_KEY	\
+	"F878B838D8589818E868A828C8488808F070B030D0509010E060A020C0408000"
+
+/* Hardcoded IV for encryption of data */
+#define	XSECURE_IV	"D2450E07EA5DE0426C0FA133"
+
+#define XSECURE_DATA	\
+	"1234567808F070B030D0509010E060A020C0408000A5DE08D85898A5A5FEDCA10134" \
+	"ABCDEF12345678900987654321123487654124456679874309713627463801AD1056"
+
+#define XSECURE_AAD			"67e21cf3cb29e0dcbc4d8b1d0cc5334b"
+
+#define XSECURE_DATA_SIZE		(68)
+#define XSECURE_DATA_SIZE_IN_BITS	(XSECURE_DATA_SIZE * 8U)
+#define XSECURE_IV_SIZE			(12)
+#define XSECURE_IV_SIZE_IN_BITS		(XSECURE_IV_SIZE * 8U)
+#define XSECURE_KEY_SIZE		(32)
+#define XSECURE_KEY_SIZE_IN_BITS	(XSECURE_KEY_SIZE * 8U)
+#define XSECURE_AAD_SIZE		(16)
+#define XSECURE_AAD_SIZE_IN_BITS	(XSECURE_AAD_SIZE * 8U)
+
+#define XSECURE_SECURE_GCM_TAG_SIZE	(16U)
+#define XSECURE_AES_KEY_SIZE_256 	(2U)
+#define XSECURE_SHARED_TOTAL_MEM_SIZE		(XSECURE_SHARED_MEM_SIZE +\
+						XSECURE_IV_SIZE + XSECURE_KEY_SIZE)
+#define XSECURE_BATCH_CMD_CNT		(8U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static s32 SecureAesBatchGcmTest(XSecure_ClientInstance *InstancePtr, u8 *Iv);
+static s32 SecureAesBatchRejectTest(XSecure_ClientInstance *InstancePtr, u8 *Key);
+
+/************************** Variable Definitions *****************************/
+
+/* shared memory allocation */
+static u8 SharedMem[XSECURE_SHARED_TOTAL_MEM_SIZE] __attribute__((aligned(64U)))
+						__attribute__ ((section (".data.SharedMem")));
+
+/* command list and shared memory of the batched commands */
+static u32 BatchMem[XSECURE_BATCH_MEM_SIZE / sizeof(u32)] __attribute__((aligned(64U)))
+						__attribute__ ((section (".data.BatchMem")));
+
+#if defined (__GNUC__)
+static u8 Data[XSECURE_DATA_SIZE]__attribute__ ((aligned (64)))
+				__attribute__ ((section (".data.Data")));
+static u8 DecData[XSECURE_DATA_SIZE]__attribute__ ((aligned (64)))
+				__attribute__ ((section (".data.DecData")));
+static u8 EncData[XSECURE_DATA_SIZE]__attribute__ ((aligned (64)))
+				__attribute__ ((section (".data.EncData")));
+static u8 GcmTag[XSECURE_SECURE_GCM_TAG_SIZE]__attribute__ ((aligned (64)))
+				__attribute__ ((section (".data.GcmTag")));
+static u8 Aad[XSECURE_AAD_SIZE]__attribute__ ((aligned (64)))
+				__attribute__ ((section (".data.Aad")));
+#elif defined (__ICCARM__)
+#pragma data_alignment = 64
+static u8 Data[XSECURE_DATA_SIZE];
+#pragma data_alignment = 64
+static u8 DecData[XSECURE_DATA_SIZE];
+#pragma data_alignment = 64
+static u8 EncData[XSECURE_DATA_SIZE ];
+#pragma data_alignment = 64
+static u8 GcmTag[XSECURE_SECURE_GCM_TAG_SIZE];
+#pragma data_alignment = 64
+static u8 Aad[XSECURE_AAD_SIZE];
+#endif
+
+/************************** Function Definitions ******************************/
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the AES command batch tests
+*
+* @param	None
+*
+* @return
+*       - XST_SUCCESS if example runs successfully
+*		- ErrorCode if the example fails.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status = XST_FAILURE;
+	XMailbox MailboxInstance;
+	XSecure_ClientInstance SecureClientInstance;
+	u8 *Key = NULL;
+	u8 *Iv = NULL;
+
+	#ifdef XSECURE_CACHE_DISABLE
+		Xil_DCacheDisable();
+	#endif
+
+	Status = XMailbox_Initialize(&MailboxInstance, 0U);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Mailbox initialize failed:%08x \r\n", Status);
+		goto END;
+	}
+
+	Status = XSecure_ClientInit(&SecureClientInstance, &MailboxInstance);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	/* Set shared memory */
+	Status = XMailbox_SetSharedMem(&MailboxInstance, (u64)(UINTPTR)(SharedMem +
+			XSECURE_KEY_SIZE + XSECURE_IV_SIZE), XSECURE_SHARED_MEM_SIZE);
+	if (Status != XST_SUCCESS) {
+		xil_printf("\r\n Shared Memory initialization failed");
+		goto END;
+	}
+
+	Key = &SharedMem[0U];
+	Iv = (Key + XSECURE_KEY_SIZE);
+
+	/* Covert strings to buffers */
+	Status = Xil_ConvertStringToHexBE((const char *) (XSECURE_AES_KEY),
+			Key, XSECURE_KEY_SIZE_IN_BITS);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+			"String Conversion error (KEY):%08x !!!\r\n", Status);
+		goto END;
+	}
+
+	Status = Xil_ConvertStringToHexBE( (const char *) (XSECURE_IV),
+			Iv, XSECURE_IV_SIZE_IN_BITS);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+			"String Conversion error (IV):%08x !!!\r\n", Status);
+		goto END;
+	}
+
+	Status = Xil_ConvertStringToHexBE((const char *) (XSECURE_DATA),
+				Data, XSECURE_DATA_SIZE_IN_BITS);
+	if (Status != XST_SUCCESS) {
+		xil_printf(
+			"String Conversion error (Data):%08x !!!\r\n", Status);
+		goto END;
+	}
+
+	Status = Xil_ConvertStringToHexBE((const char *) (XSECURE_AAD), Aad,
+		XSECURE_AAD_SIZE_IN_BITS);
+	if (Status != XST_SUCCESS) {
+		xil_printf("String Conversion error (AAD):%08x !!!\r\n", Status);
+		goto END;
+	}
+
+	Xil_DCacheFlushRange((UINTPTR)SharedMem, XSECURE_IV_SIZE + XSECURE_KEY_SIZE);
+	Xil_DCacheFlushRange((UINTPTR)Data, XSECURE_DATA_SIZE);
+	Xil_DCacheFlushRange((UINTPTR)Aad, XSECURE_AAD_SIZE);
+
+	Status = XSecure_InputSlrIndex(&SecureClientInstance, XSECURE_SLR_INDEX_0);
+	if (Status != XST_SUCCESS) {
+			xil_printf("\r\nInvalid SlrIndex\r\n");
+			goto END;
+	}
+
+	/* Key write and KATs are not batched, they run before the batch */
+	Status = XSecure_AesInitialize(&SecureClientInstance);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES initialize failed\n\r");
+		goto END;
+	}
+
+	Status = XSecure_AesWriteKey(&SecureClientInstance, XSECURE_AES_USER_KEY_0,
+				XSECURE_AES_KEY_SIZE_256, (UINTPTR)Key);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failure at key write\n\r");
+		goto END;
+	}
+
+	Status = XSecure_AesEncryptKat(&SecureClientInstance);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Aes encrypt KAT failed %x\n\r", Status);
+		goto END;
+	}
+
+	Status = XSecure_AesDecryptKat(&SecureClientInstance);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Aes decrypt KAT failed %x\n\r", Status);
+		goto END;
+	}
+
+	Status = SecureAesBatchGcmTest(&SecureClientInstance, Iv);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = SecureAesBatchRejectTest(&SecureClientInstance, Key);
+
+END:
+	if (Status == XST_SUCCESS) {
+		xil_printf("\r\nSuccessfully ran Versal AES command batch example\r\n");
+	}
+	else {
+		xil_printf("\r\nVersal AES command batch example failed\r\n");
+	}
+	Status |= XMailbox_ReleaseSharedMem(&MailboxInstance);
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function records the AES GCM encryption of the data and the decryption
+* of the result into one command batch and sends it with a single IPI request.
+* The test fails, if not all commands complete, the decryption does not
+* produce the original data or the GCM tag does not match.
+*
+* @param	InstancePtr Pointer to the client instance
+* @param	Iv  Pointer to initialization vector
+*
+* @return
+*		- XST_SUCCESS if the AES batch GCM test was successful.
+*		- ErrorCode   if the AES batch GCM test was failed.
+*
+* @note		None.
+*
+****************************************************************************/
+/** //! [AES command batch example] */
+static s32 SecureAesBatchGcmTest(XSecure_ClientInstance *InstancePtr, u8 *Iv)
+{
+	s32 Status = XST_FAILURE;
+	XSecure_CmdBatch Batch;
+	u32 DoneCnt = 0U;
+	u32 Index;
+
+	Xil_DCacheInvalidateRange((UINTPTR)EncData, XSECURE_DATA_SIZE);
+	Xil_DCacheInvalidateRange((UINTPTR)DecData, XSECURE_DATA_SIZE);
+	Xil_DCacheInvalidateRange((UINTPTR)GcmTag, XSECURE_SECURE_GCM_TAG_SIZE);
+
+	/* The AES client APIs below are recorded, they are not sent to PLM */
+	Status = XSecure_BatchStart(InstancePtr, &Batch, BatchMem);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Batch start failed %x\n\r", Status);
+		goto END;
+	}
+
+	Status = XSecure_AesEncryptInit(InstancePtr, XSECURE_AES_USER_KEY_0,
+			XSECURE_AES_KEY_SIZE_256, (UINTPTR)Iv);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES encrypt init record failed\n\r");
+		goto END_BATCH;
+	}
+
+	Status = XSecure_AesUpdateAad(InstancePtr, (UINTPTR)Aad, XSECURE_AAD_SIZE);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES update aad record failed %x\n\r", Status);
+		goto END_BATCH;
+	}
+
+	Status = XSecure_AesEncryptUpdate(InstancePtr, (UINTPTR)&Data,(UINTPTR)EncData,
+						XSECURE_DATA_SIZE, TRUE);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES encrypt update record failed\n\r");
+		goto END_BATCH;
+	}
+
+	Status = XSecure_AesEncryptFinal(InstancePtr, (UINTPTR)&GcmTag);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES encrypt final record failed\n\r");
+		goto END_BATCH;
+	}
+
+	/* Decryption of the encrypted data, checks the GCM tag */
+	Status = XSecure_AesDecryptInit(InstancePtr, XSECURE_AES_USER_KEY_0,
+			XSECURE_AES_KEY_SIZE_256, (UINTPTR)Iv);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES decrypt init record failed\n\r");
+		goto END_BATCH;
+	}
+
+	Status = XSecure_AesUpdateAad(InstancePtr, (UINTPTR)Aad, XSECURE_AAD_SIZE);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES update aad record failed %x\n\r", Status);
+		goto END_BATCH;
+	}
+
+	Status = XSecure_AesDecryptUpdate(InstancePtr, (UINTPTR)&EncData, (UINTPTR)&DecData,
+						 XSECURE_DATA_SIZE, TRUE);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES decrypt update record failed\n\r");
+		goto END_BATCH;
+	}
+
+	Status = XSecure_AesDecryptFinal(InstancePtr, (UINTPTR)&GcmTag);
+	if (Status != XST_SUCCESS) {
+		xil_printf(" AES decrypt final record failed\n\r");
+		goto END_BATCH;
+	}
+
+END_BATCH:
+	/* Send the batch, or end the recording after a failure */
+	if (Status == XST_SUCCESS) {
+		Status = XSecure_BatchEnd(InstancePtr, &Batch, &DoneCnt);
+	}
+	else {
+		(void)XSecure_BatchEnd(InstancePtr, &Batch, &DoneCnt);
+	}
+	if ((Status != XST_SUCCESS) || (DoneCnt != XSECURE_BATCH_CMD_CNT)) {
+		xil_printf("AES command batch failed %x, %u of %u commands done\n\r",
+			Status, DoneCnt, XSECURE_BATCH_CMD_CNT);
+		Status = XST_FAILURE;
+		goto END;
+	}
+
+	Xil_DCacheInvalidateRange((UINTPTR)EncData, XSECURE_DATA_SIZE);
+	Xil_DCacheInvalidateRange((UINTPTR)DecData, XSECURE_DATA_SIZE);
+	Xil_DCacheInvalidateRange((UINTPTR)GcmTag, XSECURE_SECURE_GCM_TAG_SIZE);
+
+	xil_printf("Encrypted data: \n\r");
+	for (Index = 0; Index < XSECURE_DATA_SIZE; Index++) {
+		xil_printf("%02x", EncData[Index]);
+	}
+	xil_printf( "\r\n");
+
+	xil_printf("GCM tag: \n\r");
+	for (Index = 0; Index < XSECURE_SECURE_GCM_TAG_SIZE; Index++) {
+		xil_printf("%02x", GcmTag[Index]);
+	}
+	xil_printf( "\r\n\n");
+
+	/* Comparison of Decrypted Data with original data */
+	for(Index = 0; Index < XSECURE_DATA_SIZE; Index++) {
+		if (Data[Index] != DecData[Index]) {
+			xil_printf("Failure during comparison of the data\n\r");
+			Status = XST_FAILURE;
+			goto END;
+		}
+	}
+
+	xil_printf("Successfully ran AES batch GCM Test\n\r");
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function calls a client API which cannot be batched while a command
+* batch is recorded. The API must fail with XST_INVALID_PARAM and must not be
+* recorded.
+*
+* @param	InstancePtr Pointer to the client instance
+* @param	Key Pointer to AES key
+*
+* @return
+*		- XST_SUCCESS if the API was rejected.
+*		- XST_FAILURE if the API was recorded.
+*
+* @note		None.
+*
+****************************************************************************/
+static s32 SecureAesBatchRejectTest(XSecure_ClientInstance *InstancePtr, u8 *Key)
+{
+	s32 Status = XST_FAILURE;
+	s32 WriteKeyStatus = XST_FAILURE;
+	XSecure_CmdBatch Batch;
+	u32 DoneCnt = 0U;
+
+	Status = XSecure_BatchStart(InstancePtr, &Batch, BatchMem);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Batch start failed %x\n\r", Status);
+		goto END;
+	}
+
+	WriteKeyStatus = XSecure_AesWriteKey(InstancePtr, XSECURE_AES_USER_KEY_0,
+				XSECURE_AES_KEY_SIZE_256, (UINTPTR)Key);
+
+	/* The batch is empty, ending it sends nothing */
+	Status = XSecure_BatchEnd(InstancePtr, &Batch, &DoneCnt);
+	if ((Status != XST_SUCCESS) || (DoneCnt != 0U) ||
+		(WriteKeyStatus != XST_INVALID_PARAM)) {
+		xil_printf("AES write key was not rejected in a batch %x\n\r",
+			WriteKeyStatus);
+		Status = XST_FAILURE;
+		goto END;
+	}
+
+	xil_printf("Successfully ran AES batch reject Test\n\r");
+END:
+	return Status;
+}
+
+/** //! [AES command batch example] */
+/** @} */
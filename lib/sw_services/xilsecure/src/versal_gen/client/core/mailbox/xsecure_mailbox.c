@@ -31,6 +31,8 @@
 *	ss   04/05/24 Fixed doxygen warnings
 * 5.4   yog  04/29/24 Fixed doxygen warnings.
 *       pre  08/16/24 Added API to use SSIT support
+* 5.5   mb   10/16/26 Added command batch APIs
+*       mb   10/16/26 Record only the AES data commands in a command batch
 *
 * </pre>
 *
@@ -43,10 +45,22 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Constant Definitions *****************************/
+#define XSECURE_BATCH_RESP_CMD_CNT_IDX	(1U)
+				/**< Response index of the executed command count */
 
 /**************************** Type Definitions *******************************/
 
+/************************** Function Prototypes ******************************/
+static int XSecure_SendAndRecv(XMailbox *MailboxPtr, u32 *MsgPtr, u32 MsgLen,
+	u32 *Response);
+static int XSecure_BatchAddCmd(XSecure_CmdBatch *BatchPtr, const u32 *MsgPtr, u32 MsgLen);
+static u32 XSecure_BatchIsCmdAllowed(u32 ApiId);
+static int XSecure_BatchSetSharedMem(XSecure_CmdBatch *BatchPtr);
+static void XSecure_BatchRestoreSharedMem(const XSecure_CmdBatch *BatchPtr);
+
 /************************** Variable Definitions *****************************/
+static XSecure_CmdBatch *XSecure_ActiveBatch = NULL;
+				/**< Command batch being recorded */
 
 /************************** Function Definitions *****************************/
 
@@ -94,6 +108,41 @@ int XSecure_ProcessMailbox(XMailbox *MailboxPtr, u32 *MsgPtr, u32 MsgLen)
 	int Status = XST_FAILURE;
 	u32 Response[RESPONSE_ARG_CNT];
 
+	/**
+	 * Record the command if a command batch is being recorded for the mailbox
+	 */
+	if ((XSecure_ActiveBatch != NULL) &&
+		(XSecure_ActiveBatch->MailboxPtr == MailboxPtr)) {
+		Status = XSecure_BatchAddCmd(XSecure_ActiveBatch, MsgPtr, MsgLen);
+		goto END;
+	}
+
+	Status = XSecure_SendAndRecv(MailboxPtr, MsgPtr, MsgLen, Response);
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function sends IPI request to the target module and waits
+ * for the response
+ *
+ * @param	MailboxPtr	Pointer to XMailbox
+ * @param	MsgPtr		Pointer to the payload message
+ * @param	MsgLen		Length of the message
+ * @param	Response	Buffer of RESPONSE_ARG_CNT words for the response
+ *
+ * @return
+ *	-	XST_SUCCESS - If the IPI send and receive is successful
+ *	-	XST_FAILURE - If there is a failure
+ *
+ ****************************************************************************/
+static int XSecure_SendAndRecv(XMailbox *MailboxPtr, u32 *MsgPtr, u32 MsgLen,
+	u32 *Response)
+{
+	int Status = XST_FAILURE;
+
 	/**
 	 * Send CDO to PLM through IPI. Return XST_FAILURE if sending data failed
 	 */
@@ -148,3 +197,287 @@ int XSecure_ClientInit(XSecure_ClientInstance* const InstancePtr, XMailbox* cons
 
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts recording a command batch. Until
+ *		XSecure_BatchEnd is called the xilsecure client APIs called with
+ *		the mailbox of InstancePtr do not send IPI requests, their commands
+ *		are appended to the command list instead. Each recorded command
+ *		gets its own slot of XSECURE_SHARED_MEM_SIZE bytes as shared memory.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	BatchPtr	Pointer to the command batch
+ * @param	BatchMem	Memory of XSECURE_BATCH_MEM_SIZE bytes for the
+ *				command list and the shared memory slots. It must
+ *				be accessible to PLM and stay valid until
+ *				XSecure_BatchEnd returns.
+ *
+ * @return
+ *	-	XST_SUCCESS - If recording is started
+ *	-	XST_FAILURE - On invalid parameters or if a batch is already
+ *			      being recorded
+ *
+ * @note	Only the AES data commands (init, operation init, AAD update,
+ *		encrypt/decrypt update and final) can be recorded. Other client
+ *		APIs called with the mailbox while recording fail with
+ *		XST_INVALID_PARAM and are not recorded.
+ *
+ ******************************************************************************/
+int XSecure_BatchStart(const XSecure_ClientInstance *InstancePtr, XSecure_CmdBatch *BatchPtr,
+	u32 *BatchMem)
+{
+	int Status = XST_FAILURE;
+	u64 *SharedMem = NULL;
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL) ||
+		(BatchPtr == NULL) || (BatchMem == NULL) ||
+		(XSecure_ActiveBatch != NULL)) {
+		goto END;
+	}
+
+	BatchPtr->MailboxPtr = InstancePtr->MailboxPtr;
+	BatchPtr->CmdList = BatchMem;
+	BatchPtr->Len = 0U;
+	BatchPtr->CmdCnt = 0U;
+
+	/**
+	 * Save the shared memory of the mailbox, it is replaced by the batch
+	 * slots while recording
+	 */
+	BatchPtr->SharedMemSize = XMailbox_GetSharedMem(BatchPtr->MailboxPtr, &SharedMem);
+	BatchPtr->SharedMemAddr = (u64)(UINTPTR)SharedMem;
+
+	Status = XSecure_BatchSetSharedMem(BatchPtr);
+	if (Status != XST_SUCCESS) {
+		XSecure_BatchRestoreSharedMem(BatchPtr);
+		goto END;
+	}
+
+	XSecure_ActiveBatch = BatchPtr;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stops recording a command batch and sends it to
+ *		PLM with a single IPI request. PLM executes the commands in
+ *		order until the end of the list or the first failure.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	BatchPtr	Pointer to the command batch
+ * @param	DoneCnt		Number of commands executed successfully
+ *
+ * @return
+ *	-	XST_SUCCESS - If all commands in the batch are successful
+ *	-	XST_FAILURE - On invalid parameters
+ *	-	ErrorCode - Status of the first failing command
+ *
+ * @note	On failure the AES operation of the failing command has to be
+ *		initialized again.
+ *
+ ******************************************************************************/
+int XSecure_BatchEnd(const XSecure_ClientInstance *InstancePtr, XSecure_CmdBatch *BatchPtr,
+	u32 *DoneCnt)
+{
+	int Status = XST_FAILURE;
+	u32 Payload[XMAILBOX_PAYLOAD_LEN_4U];
+	u32 Response[RESPONSE_ARG_CNT] = {0U};
+	u64 ListAddr;
+
+	if ((InstancePtr == NULL) || (BatchPtr == NULL) || (DoneCnt == NULL) ||
+		(XSecure_ActiveBatch != BatchPtr) ||
+		(InstancePtr->MailboxPtr != BatchPtr->MailboxPtr)) {
+		goto END;
+	}
+
+	XSecure_ActiveBatch = NULL;
+	XSecure_BatchRestoreSharedMem(BatchPtr);
+	*DoneCnt = 0U;
+
+	if (BatchPtr->CmdCnt == 0U) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	ListAddr = (u64)(UINTPTR)BatchPtr->CmdList;
+	XSecure_DCacheFlushRange(BatchPtr->CmdList, BatchPtr->Len * sizeof(u32));
+
+	/* Fill IPI Payload */
+	Payload[0U] = HEADER(0U, (InstancePtr->SlrIndex << XSECURE_SLR_INDEX_SHIFT) |
+				XSECURE_API_CMD_BATCH);
+	Payload[1U] = (u32)ListAddr;
+	Payload[2U] = (u32)(ListAddr >> XSECURE_ADDR_HIGH_SHIFT);
+	Payload[3U] = BatchPtr->Len;
+
+	/**
+	 * Send one IPI request for the whole command list and wait for its
+	 * response
+	 */
+	Status = XSecure_SendAndRecv(InstancePtr->MailboxPtr, Payload,
+				sizeof(Payload)/sizeof(u32), Response);
+	*DoneCnt = Response[XSECURE_BATCH_RESP_CMD_CNT_IDX];
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function appends a command to the command batch
+ *
+ * @param	BatchPtr	Pointer to the command batch
+ * @param	MsgPtr		Pointer to the payload message
+ * @param	MsgLen		Length of the message
+ *
+ * @return
+ *	-	XST_SUCCESS - If the command is recorded
+ *	-	XST_INVALID_PARAM - If the command cannot be batched
+ *	-	XST_FAILURE - If the command does not fit in the batch
+ *
+ ******************************************************************************/
+static int XSecure_BatchAddCmd(XSecure_CmdBatch *BatchPtr, const u32 *MsgPtr, u32 MsgLen)
+{
+	int Status = XST_FAILURE;
+	u32 *Entry;
+	u32 Idx;
+
+	if (MsgLen == 0U) {
+		goto END;
+	}
+
+	/**
+	 * Commands which return data or keep client state are not executed
+	 * when recorded, they are rejected so that the caller does not get
+	 * stale results
+	 */
+	if (XSecure_BatchIsCmdAllowed(MsgPtr[0U] & XSECURE_API_ID_MASK) != (u32)TRUE) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	if (((MsgLen - 1U) > XSECURE_BATCH_MAX_PAYLOAD_LEN) ||
+		(BatchPtr->CmdCnt >= XSECURE_BATCH_MAX_CMDS) ||
+		((BatchPtr->Len + MsgLen) > XSECURE_BATCH_MAX_LEN)) {
+		goto END;
+	}
+
+	/**
+	 * Commands run on the SLR the batch is sent to. PLM takes the payload
+	 * length of each command from its header.
+	 */
+	Entry = &BatchPtr->CmdList[BatchPtr->Len];
+	Entry[0U] = (MsgPtr[0U] & ~(XSECURE_BATCH_CMD_LEN_MASK | XSECURE_SLR_INDEX_MASK)) |
+			((MsgLen - 1U) << XSECURE_BATCH_CMD_LEN_SHIFT);
+	for (Idx = 1U; Idx < MsgLen; Idx++) {
+		Entry[Idx] = MsgPtr[Idx];
+	}
+	BatchPtr->Len += MsgLen;
+	BatchPtr->CmdCnt++;
+
+	/**
+	 * Give the next command its own shared memory slot. A full batch
+	 * leaves the mailbox without shared memory, so that the slot of the
+	 * last command is not overwritten.
+	 */
+	if (BatchPtr->CmdCnt < XSECURE_BATCH_MAX_CMDS) {
+		Status = XSecure_BatchSetSharedMem(BatchPtr);
+	}
+	else {
+		Status = XMailbox_ReleaseSharedMem(BatchPtr->MailboxPtr);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if a command can be recorded in a batch.
+ *		Only the AES data commands are allowed, they return nothing but
+ *		the status in the IPI response and keep no client state. The
+ *		SHA commands advance the client SHA state when recorded and
+ *		other commands return data in the response, they are rejected.
+ *
+ * @param	ApiId	API ID of the command
+ *
+ * @return
+ *	-	TRUE - If the command can be recorded
+ *	-	FALSE - Otherwise
+ *
+ ******************************************************************************/
+static u32 XSecure_BatchIsCmdAllowed(u32 ApiId)
+{
+	u32 IsAllowed = (u32)FALSE;
+
+	switch (ApiId) {
+	case XSECURE_API(XSECURE_API_AES_INIT):
+	case XSECURE_API(XSECURE_API_AES_OP_INIT):
+	case XSECURE_API(XSECURE_API_AES_UPDATE_AAD):
+	case XSECURE_API(XSECURE_API_AES_ENCRYPT_UPDATE):
+	case XSECURE_API(XSECURE_API_AES_ENCRYPT_FINAL):
+	case XSECURE_API(XSECURE_API_AES_DECRYPT_UPDATE):
+	case XSECURE_API(XSECURE_API_AES_DECRYPT_FINAL):
+		IsAllowed = (u32)TRUE;
+		break;
+	default:
+		IsAllowed = (u32)FALSE;
+		break;
+	}
+
+	return IsAllowed;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function sets the shared memory slot of the next command
+ *		as the shared memory of the mailbox
+ *
+ * @param	BatchPtr	Pointer to the command batch
+ *
+ * @return
+ *	-	XST_SUCCESS - If the shared memory is set
+ *	-	XST_FAILURE - If the batch is full or there is a failure
+ *
+ ******************************************************************************/
+static int XSecure_BatchSetSharedMem(XSecure_CmdBatch *BatchPtr)
+{
+	int Status = XST_FAILURE;
+	u64 SlotAddr;
+
+	Status = XMailbox_ReleaseSharedMem(BatchPtr->MailboxPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	if (BatchPtr->CmdCnt >= XSECURE_BATCH_MAX_CMDS) {
+		Status = XST_FAILURE;
+		goto END;
+	}
+
+	SlotAddr = (u64)(UINTPTR)&BatchPtr->CmdList[XSECURE_BATCH_MAX_LEN] +
+		((u64)BatchPtr->CmdCnt * XSECURE_SHARED_MEM_SIZE);
+	Status = (int)XMailbox_SetSharedMem(BatchPtr->MailboxPtr, SlotAddr,
+			XSECURE_SHARED_MEM_SIZE);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function restores the shared memory the mailbox had before
+ *		the command batch was started
+ *
+ * @param	BatchPtr	Pointer to the command batch
+ *
+ ******************************************************************************/
+static void XSecure_BatchRestoreSharedMem(const XSecure_CmdBatch *BatchPtr)
+{
+	(void)XMailbox_ReleaseSharedMem(BatchPtr->MailboxPtr);
+	if (BatchPtr->SharedMemSize != 0U) {
+		(void)XMailbox_SetSharedMem(BatchPtr->MailboxPtr, BatchPtr->SharedMemAddr,
+				BatchPtr->SharedMemSize);
+	}
+}
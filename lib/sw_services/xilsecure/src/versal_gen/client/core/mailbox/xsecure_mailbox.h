@@ -32,6 +32,7 @@
 *	ss   04/05/24 Fixed doxygen warnings
 * 5.4   yog  04/29/24 Fixed doxygen grouping and doxygen warnings.
 *       pre  08/16/24 Added XSECURE_SLR_INDEX_SHIFT macro
+* 5.5   mb   10/16/26 Added command batch APIs
 *
 * </pre>
 *
@@ -52,6 +53,7 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xilmailbox.h"
 #include "xparameters.h"
+#include "xsecure_defs.h"
 
 /************************** Constant Definitions ****************************/
 /**
@@ -80,6 +82,14 @@ extern "C" {
 #define XSECURE_SHARED_MEM_SIZE		(160U)
 					/**< Shared memory size */
 #define XSECURE_SLR_INDEX_SHIFT     (6U) /**< Slr index shift constant*/
+#define XSECURE_SLR_INDEX_MASK      ((u32)XSECURE_SLR_INDEX_3 << XSECURE_SLR_INDEX_SHIFT)
+					/**< Slr index mask in the API ID */
+
+/* Size of the memory used by a command batch, the command list followed by
+ * one shared memory slot for each command */
+#define XSECURE_BATCH_MEM_SIZE		((XSECURE_BATCH_MAX_LEN * (u32)sizeof(u32)) + \
+					(XSECURE_BATCH_MAX_CMDS * XSECURE_SHARED_MEM_SIZE))
+					/**< Command batch memory size in bytes */
 
 /**************************** Type Definitions *******************************/
 /**
@@ -90,6 +100,18 @@ typedef struct {
 	u32 SlrIndex;
 } XSecure_ClientInstance;
 
+/**
+ * Data structure to record xilsecure commands into a command batch
+ */
+typedef struct {
+	XMailbox *MailboxPtr;	/**< Mailbox whose commands are recorded */
+	u32 *CmdList;		/**< Command list */
+	u64 SharedMemAddr;	/**< Shared memory to restore after the batch */
+	u32 SharedMemSize;	/**< Size of the shared memory to restore */
+	u32 Len;		/**< Length of the command list in words */
+	u32 CmdCnt;		/**< Number of commands in the list */
+} XSecure_CmdBatch;
+
 /** Enumeration constants for SlrIndex*/
 typedef enum{
 	XSECURE_SLR_INDEX_0 = 0,/**< SLR_INDEX_0 */
@@ -137,6 +159,10 @@ static inline int XSecure_SetSlrIndex(XSecure_ClientInstance *InstancePtr, u32 S
 int XSecure_ProcessMailbox(XMailbox *MailboxPtr, u32 *MsgPtr, u32 MsgLen);
 int XSecure_ClientInit(XSecure_ClientInstance* const InstancePtr, XMailbox* const MailboxPtr);
 int XSecure_InputSlrIndex(XSecure_ClientInstance *InstancePtr, u32 SlrIndex);
+int XSecure_BatchStart(const XSecure_ClientInstance *InstancePtr, XSecure_CmdBatch *BatchPtr,
+	u32 *BatchMem);
+int XSecure_BatchEnd(const XSecure_ClientInstance *InstancePtr, XSecure_CmdBatch *BatchPtr,
+	u32 *DoneCnt);
 
 #ifdef __cplusplus
 }
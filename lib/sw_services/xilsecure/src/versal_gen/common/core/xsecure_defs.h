@@ -35,6 +35,7 @@
 * 5.4   yog  04/29/24 Fixed doxygen warnings.
 *       mb   05/23/24 Added support for P-192 Curve
 *       mb   05/23/24 Added support for P-224 Curve
+* 5.5   mb   10/16/26 Added command batch macros
 *
 * </pre>
 *
@@ -110,6 +111,17 @@ extern "C" {
 				/**< Clear the Ipi mask value */
 #define XSECURE_SET_DATA_CONTEXT	(1U)
 				/**< Set the data context*/
+#define XSECURE_BATCH_MAX_CMDS		(32U)
+				/**< Maximum number of commands in a command batch */
+#define XSECURE_BATCH_MAX_PAYLOAD_LEN	(6U)
+				/**< Maximum payload length in words of a batched command */
+#define XSECURE_BATCH_MAX_LEN		(XSECURE_BATCH_MAX_CMDS * \
+					(XSECURE_BATCH_MAX_PAYLOAD_LEN + 1U))
+				/**< Maximum length in words of a command list */
+#define XSECURE_BATCH_CMD_LEN_SHIFT	(16U)
+				/**< Shift of the payload length in a command header */
+#define XSECURE_BATCH_CMD_LEN_MASK	(0xFF0000U)
+				/**< Mask of the payload length in a command header */
 /************************** Variable Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
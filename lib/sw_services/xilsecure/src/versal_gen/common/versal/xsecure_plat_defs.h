@@ -20,6 +20,7 @@
 *       kpt  07/24/22 Added XSECURE_API_KAT and additional KAT ids
 *       dc   08/26/22 Removed gaps between the API IDs
 * 5.1   skg  12/16/22 Added IPI commands for Encrypt/Decrypt Init,update,Final
+* 5.5   mb   10/16/26 Added XSECURE_API_CMD_BATCH
 *
 * </pre>
 * @note
@@ -68,7 +69,8 @@ typedef enum {
 	XSECURE_API_KAT,				/**< 21U */
 	/**< 22U reserved for versal_net*/
 	XSECURE_API_AES_PERFORM_OPERATION = 23U, /**< 23U */
-	XSECURE_API_MAX,			/**< 24U */
+	XSECURE_API_CMD_BATCH,			/**< 24U */
+	XSECURE_API_MAX,			/**< 25U */
 } XSecure_ApiId;
 
 typedef enum {
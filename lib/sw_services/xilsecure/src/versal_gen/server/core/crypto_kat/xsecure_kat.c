@@ -33,6 +33,8 @@
 *       mb   05/23/2024 Added support for P-192
 *       mb   05/23/2024 Added support for P-224
 *       kal  07/24/2024 Code refacroring for versal_aiepg2.
+* 5.5   mb   10/16/2026 Added XSecure_RsaPublicEncryptKatStart and
+*                       XSecure_RsaPublicEncryptKatFinish
 *
 * </pre>
 *
@@ -1147,6 +1149,96 @@ END_CLR:
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts the KAT on RSA core without waiting for the
+ *		RSA operation to complete, so that KATs of other crypto engines
+ *		can run meanwhile. XSecure_RsaPublicEncryptKatFinish must be
+ *		called to complete the KAT.
+ *
+ * @param	RsaInstance	Pointer to the XSecure_Rsa instance to be used
+ *				until the KAT is finished
+ *
+ * @return
+ *	-	XST_SUCCESS - If the RSA operation is started
+ *	-	XSECURE_RSA_KAT_INIT_ERROR - When RSA initialization fails
+ *	-	XSECURE_RSA_KAT_ENCRYPT_FAILED_ERROR - When RSA operation cannot
+ *							be started
+ *
+ *****************************************************************************/
+int XSecure_RsaPublicEncryptKatStart(XSecure_Rsa *RsaInstance)
+{
+	volatile int Status = XST_FAILURE;
+	u32 PubExp = XSECURE_KAT_RSA_PUB_EXP;
+
+	Status = XSecure_RsaInitialize(RsaInstance, (u8 *)RsaModulus,
+		(u8*)RsaModExt, (u8 *)&PubExp);
+	if (Status != XST_SUCCESS) {
+		Status = (int)XSECURE_RSA_KAT_INIT_ERROR;
+		goto END;
+	}
+
+	/* Key and data are loaded to the RSA core before it returns */
+	Status = XST_FAILURE;
+	Status = XSecure_RsaOperationStart(RsaInstance, (u64)(UINTPTR)RsaData,
+		XSECURE_RSA_SIGN_ENC, XSECURE_RSA_2048_KEY_SIZE);
+	if (Status != XST_SUCCESS) {
+		Status = (int)XSECURE_RSA_KAT_ENCRYPT_FAILED_ERROR;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the RSA operation started by
+ *		XSecure_RsaPublicEncryptKatStart and checks its result
+ *
+ * @param	RsaInstance	Pointer to the XSecure_Rsa instance passed to
+ *				XSecure_RsaPublicEncryptKatStart
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XSECURE_RSA_KAT_ENCRYPT_FAILED_ERROR - When RSA KAT fails
+ *	-	XSECURE_RSA_KAT_ENCRYPT_DATA_MISMATCH_ERROR - Error when RSA data not
+ *							matched with expected data
+ *
+ *****************************************************************************/
+int XSecure_RsaPublicEncryptKatFinish(XSecure_Rsa *RsaInstance)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int SStatus = XST_FAILURE;
+	volatile u32 Index;
+	u32 RsaOutput[XSECURE_RSA_2048_SIZE_WORDS];
+
+	Status = XSecure_RsaOperationWait(RsaInstance, (u64)(UINTPTR)RsaOutput);
+	if (Status != XST_SUCCESS) {
+		Status = (int)XSECURE_RSA_KAT_ENCRYPT_FAILED_ERROR;
+		goto END_CLR;
+	}
+
+	/* Initialized to error */
+	Status = (int)XSECURE_RSA_KAT_ENCRYPT_DATA_MISMATCH_ERROR;
+	for (Index = 0U; Index < XSECURE_RSA_2048_SIZE_WORDS; Index++) {
+		if (RsaOutput[Index] != RsaExpCtData[Index]) {
+			Status = (int)XSECURE_RSA_KAT_ENCRYPT_DATA_MISMATCH_ERROR;
+			goto END_CLR;
+		}
+	}
+	if (Index == XSECURE_RSA_2048_SIZE_WORDS) {
+		Status = XST_SUCCESS;
+	}
+
+END_CLR:
+	SStatus = Xil_SecureZeroize((u8*)RsaOutput, XSECURE_RSA_2048_KEY_SIZE);
+	if ((Status == XST_SUCCESS) && (Status == XST_SUCCESS)) {
+		Status = SStatus;
+	}
+
+	return Status;
+}
 #endif
 
 #ifndef PLM_ECDSA_EXCLUDE
@@ -20,6 +20,7 @@
 * 5.0   kpt  07/15/2022 Initial release
 * 5.1   yog  05/03/2023 Fixed MISRA C violation of Rule 8.3
 * 5.4   yog  04/29/2024 Fixed doxygen grouping.
+* 5.5   mb   10/16/2026 Added RSA KAT start and finish APIs
 *
 * </pre>
 *
@@ -40,6 +41,9 @@ extern "C" {
 #include "xparameters.h"
 #include "xsecure_aes.h"
 #include "xsecure_sha.h"
+#ifndef PLM_RSA_EXCLUDE
+#include "xsecure_rsa.h"
+#endif
 #ifndef PLM_ECDSA_EXCLUDE
 #include "xsecure_elliptic.h"
 #endif
@@ -67,6 +71,8 @@ u32* XSecure_GetKatRsaData(void);
 u32* XSecure_GetKatRsaCtData(void);
 u32* XSecure_GetKatRsaPrivateExp(void);
 int XSecure_RsaPublicEncryptKat(void);
+int XSecure_RsaPublicEncryptKatStart(XSecure_Rsa *RsaInstance);
+int XSecure_RsaPublicEncryptKatFinish(XSecure_Rsa *RsaInstance);
 #endif
 
 #ifndef PLM_ECDSA_EXCLUDE
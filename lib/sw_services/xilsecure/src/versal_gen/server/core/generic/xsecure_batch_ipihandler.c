@@ -0,0 +1,321 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_batch_ipihandler.c
+*
+* This file contains the xilsecure command batch IPI handler implementation.
+* A command batch is a list of xilsecure IPI commands in memory, each one a
+* command header followed by its payload. The commands are executed back to
+* back and the batch is completed with a single IPI response.
+*
+* Every command in a batch gets the same validation as the command sent
+* alone over the IPI of the batch requester and only the commands listed in
+* XSecure_BatchIsCmdAllowed can be batched. KAT, key management and other
+* commands which return data or can lock down the device are rejected.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.5   mb   10/16/2026 Initial release
+*       mb   10/16/2026 Validate batched commands as IPI commands and allow
+*                       only the AES data commands
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xplmi.h"
+#include "xplmi_dma.h"
+#include "xplmi_ipi.h"
+#include "xplmi_modules.h"
+#include "xplmi_plat.h"
+#include "xsecure_defs.h"
+#include "xsecure_utils.h"
+#include "xsecure_batch_ipihandler.h"
+
+/************************** Constant Definitions *****************************/
+#define XSECURE_BATCH_MAX_ENTRY_LEN	(XSECURE_BATCH_MAX_PAYLOAD_LEN + 1U)
+				/**< Maximum length of a batch entry in words */
+#define XSECURE_BATCH_RESP_CMD_CNT_IDX	(1U)
+				/**< Response index of the executed command count */
+
+/************************** Function Prototypes *****************************/
+#ifdef XPLMI_IPI_DEVICE_ID
+static int XSecure_BatchGetIpiSrcIndex(u32 IpiMask, u32 *SrcIndex);
+static int XSecure_BatchValidateCmd(XPlmi_Cmd *SubCmd, u32 SrcIndex,
+	u32 MaxPayloadLen);
+static u32 XSecure_BatchIsCmdAllowed(u32 ApiId);
+#endif
+
+/*****************************************************************************/
+/**
+ * @brief	This function executes a batch of xilsecure commands.
+ *		The commands are run in order until the end of the list or
+ *		the first failure. The number of commands executed
+ *		successfully is returned in the second word of the response.
+ *		Batches are accepted over IPI only.
+ *
+ * @param	Cmd is pointer to the command structure
+ *		- Payload[0] Lower 32 bit address of the command list
+ *		- Payload[1] Upper 32 bit address of the command list
+ *		- Payload[2] Length of the command list in words
+ *
+ * @return
+ *		- XST_SUCCESS - If all commands in the batch are successful
+ *		- XST_INVALID_PARAM - If the batch or one of its commands is
+ *		  invalid
+ *		- ErrorCode - Status of the first failing command
+ *
+ ******************************************************************************/
+int XSecure_BatchIpiHandler(XPlmi_Cmd *Cmd)
+{
+	volatile int Status = XST_FAILURE;
+#ifdef XPLMI_IPI_DEVICE_ID
+	const u32 *Pload = NULL;
+	u32 Entry[XSECURE_BATCH_MAX_ENTRY_LEN];
+	XPlmi_Cmd SubCmd = {0U};
+	u64 ListAddr;
+	u32 ListLen;
+	u32 EntryLen;
+	u32 PayloadLen;
+	u32 SrcIndex = 0U;
+	u32 Offset = 0U;
+	u32 CmdCnt = 0U;
+	u32 Idx;
+
+	if ((Cmd == NULL) || (Cmd->Payload == NULL)) {
+		Status = XST_INVALID_PARAM;
+		goto RET;
+	}
+
+	Pload = Cmd->Payload;
+	ListAddr = ((u64)Pload[1U] << XSECURE_ADDR_HIGH_SHIFT) | (u64)Pload[0U];
+	ListLen = Pload[2U];
+	if ((ListLen == 0U) || (ListLen > XSECURE_BATCH_MAX_LEN)) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	/** Validate the address range of the command list */
+	Status = XPlmi_VerifyAddrRange(ListAddr, ListAddr +
+		((u64)ListLen * XSECURE_WORD_SIZE) - 1U);
+	if (Status != XST_SUCCESS) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	/** Commands in a batch are validated for the IPI channel of the batch */
+	Status = XSecure_BatchGetIpiSrcIndex(Cmd->IpiMask, &SrcIndex);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	while (Offset < ListLen) {
+		if (CmdCnt >= XSECURE_BATCH_MAX_CMDS) {
+			Status = XST_INVALID_PARAM;
+			goto END;
+		}
+
+		/** Copy the header and at most the longest payload left in the list */
+		EntryLen = ListLen - Offset;
+		if (EntryLen > XSECURE_BATCH_MAX_ENTRY_LEN) {
+			EntryLen = XSECURE_BATCH_MAX_ENTRY_LEN;
+		}
+		Status = XPlmi_MemCpy64((u64)(UINTPTR)Entry,
+			ListAddr + ((u64)Offset * XSECURE_WORD_SIZE),
+			EntryLen * XSECURE_WORD_SIZE);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+
+		/** Commands in the batch run on behalf of the batch requester */
+		SubCmd.CmdId = Entry[0U];
+		SubCmd.SubsystemId = Cmd->SubsystemId;
+		SubCmd.IpiMask = Cmd->IpiMask;
+		SubCmd.AckInPLM = (u8)TRUE;
+		SubCmd.ProcessedLen = 0U;
+		SubCmd.ResumeHandler = NULL;
+		/**
+		 * A command is secure only if both the batch and the command
+		 * header request a secure access
+		 */
+		if ((Cmd->IpiReqType == XPLMI_CMD_SECURE) &&
+			((Entry[0U] & IPI_CMD_HDR_SECURE_BIT_MASK) == 0U)) {
+			SubCmd.IpiReqType = XPLMI_CMD_SECURE;
+		}
+		else {
+			SubCmd.IpiReqType = XPLMI_CMD_NON_SECURE;
+		}
+
+		Status = XST_FAILURE;
+		Status = XSecure_BatchValidateCmd(&SubCmd, SrcIndex, EntryLen - 1U);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		PayloadLen = SubCmd.Len;
+
+		/** Clear the words copied from the next command */
+		for (Idx = PayloadLen + 1U; Idx < XSECURE_BATCH_MAX_ENTRY_LEN; Idx++) {
+			Entry[Idx] = 0U;
+		}
+
+		SubCmd.PayloadLen = PayloadLen;
+		SubCmd.Payload = &Entry[1U];
+		Status = XST_FAILURE;
+		Status = XPlmi_CmdExecute(&SubCmd);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+
+		CmdCnt++;
+		Offset += PayloadLen + 1U;
+	}
+
+END:
+	Cmd->Response[XSECURE_BATCH_RESP_CMD_CNT_IDX] = CmdCnt;
+
+RET:
+#else
+	(void)Cmd;
+	Status = XST_INVALID_PARAM;
+#endif
+	return Status;
+}
+
+#ifdef XPLMI_IPI_DEVICE_ID
+/*****************************************************************************/
+/**
+ * @brief	This function returns the IPI buffer index of the agent which
+ *		sent the batch. Batches not received over IPI are rejected.
+ *
+ * @param	IpiMask is the IPI mask of the batch requester
+ * @param	SrcIndex is pointer to store the IPI buffer index
+ *
+ * @return
+ *		- XST_SUCCESS - If the requester is an IPI agent
+ *		- XST_INVALID_PARAM - Otherwise
+ *
+ ******************************************************************************/
+static int XSecure_BatchGetIpiSrcIndex(u32 IpiMask, u32 *SrcIndex)
+{
+	int Status = XST_INVALID_PARAM;
+	const XIpiPsu *IpiInst = XPlmi_GetIpiInstance();
+	u32 Idx;
+
+	if (IpiMask == 0U) {
+		goto END;
+	}
+
+	for (Idx = 0U; Idx < XPLMI_IPI_MASK_COUNT; Idx++) {
+		if (IpiInst->Config.TargetList[Idx].Mask == IpiMask) {
+			*SrcIndex = IpiInst->Config.TargetList[Idx].BufferIndex;
+			Status = XST_SUCCESS;
+			break;
+		}
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function validates a command in a batch. The command
+ *		must be in the batch allowlist, must be a xilsecure command
+ *		for the local SLR and must pass XPlmi_ValidateIpiCmd for the
+ *		IPI channel and request type of the batch, as it would when
+ *		sent alone.
+ *
+ * @param	SubCmd is pointer to the command with CmdId and IpiReqType
+ *		set, its Len is updated with the payload length
+ * @param	SrcIndex is the IPI buffer index of the batch requester
+ * @param	MaxPayloadLen is the number of words left in the list after
+ *		the header
+ *
+ * @return
+ *		- XST_SUCCESS - If the command can be executed in a batch
+ *		- XST_INVALID_PARAM - If the command is not allowed
+ *		- ErrorCode - If XPlmi_ValidateIpiCmd fails
+ *
+ ******************************************************************************/
+static int XSecure_BatchValidateCmd(XPlmi_Cmd *SubCmd, u32 SrcIndex,
+	u32 MaxPayloadLen)
+{
+	volatile int Status = XST_INVALID_PARAM;
+	u32 ModuleId = (SubCmd->CmdId & XPLMI_CMD_MODULE_ID_MASK) >>
+		XPLMI_CMD_MODULE_ID_SHIFT;
+	u32 ApiId = SubCmd->CmdId & XSECURE_API_ID_MASK;
+	u32 PayloadLen = (SubCmd->CmdId & XSECURE_BATCH_CMD_LEN_MASK) >>
+		XSECURE_BATCH_CMD_LEN_SHIFT;
+
+	if ((ModuleId != XPLMI_MODULE_XILSECURE_ID) ||
+		(XSecure_BatchIsCmdAllowed(ApiId) != (u32)TRUE)) {
+		goto END;
+	}
+
+	if ((PayloadLen > XSECURE_BATCH_MAX_PAYLOAD_LEN) ||
+		(PayloadLen > XPLMI_MAX_IPI_CMD_LEN) ||
+		(PayloadLen > MaxPayloadLen)) {
+		goto END;
+	}
+
+	/** Same checks as for the command received alone over IPI */
+	Status = XST_FAILURE;
+	Status = XPlmi_ValidateIpiCmd(SubCmd, SrcIndex);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	SubCmd->Len = PayloadLen;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if a command can be executed in a batch.
+ *		Only the AES data commands are allowed; they return no data in
+ *		the IPI response and keep no state in the client. SHA commands
+ *		advance the client SHA state and are not allowed, neither are
+ *		KAT commands, which lock down the device on failure, key
+ *		management, TRNG and status update commands.
+ *
+ * @param	ApiId is the API ID of the command
+ *
+ * @return
+ *		- TRUE - If the command can be executed in a batch
+ *		- FALSE - Otherwise
+ *
+ ******************************************************************************/
+static u32 XSecure_BatchIsCmdAllowed(u32 ApiId)
+{
+	u32 IsAllowed = (u32)FALSE;
+
+	switch (ApiId) {
+	case XSECURE_API(XSECURE_API_AES_INIT):
+	case XSECURE_API(XSECURE_API_AES_OP_INIT):
+	case XSECURE_API(XSECURE_API_AES_UPDATE_AAD):
+	case XSECURE_API(XSECURE_API_AES_ENCRYPT_UPDATE):
+	case XSECURE_API(XSECURE_API_AES_ENCRYPT_FINAL):
+	case XSECURE_API(XSECURE_API_AES_DECRYPT_UPDATE):
+	case XSECURE_API(XSECURE_API_AES_DECRYPT_FINAL):
+		IsAllowed = (u32)TRUE;
+		break;
+	default:
+		IsAllowed = (u32)FALSE;
+		break;
+	}
+
+	return IsAllowed;
+}
+#endif
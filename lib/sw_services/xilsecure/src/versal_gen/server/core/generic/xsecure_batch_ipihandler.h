@@ -0,0 +1,45 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_batch_ipihandler.h
+*
+* This file contains the xilsecure command batch IPI handler declaration.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.5   mb   10/16/2026 Initial release
+*
+* </pre>
+*
+*
+******************************************************************************/
+#ifndef XSECURE_BATCH_IPIHANDLER_H_
+#define XSECURE_BATCH_IPIHANDLER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xplmi_cmd.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/************************** Function Prototypes ******************************/
+int XSecure_BatchIpiHandler(XPlmi_Cmd *Cmd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XSECURE_BATCH_IPIHANDLER_H_ */
@@ -47,6 +47,7 @@
 * 5.2   kpt  08/20/23 Added XSecure_RsaEcdsaZeroizeAndVerifyRam
 *	vss  09/18/23 Fixed compilation warning due to XSecure_RsaEcdsaZeroizeAndVerifyRam
 * 5.4   yog  04/29/24 Fixed doxygen warnings.
+* 5.5   mb   10/16/26 Split XSecure_RsaOperation into start and wait
 *
 * </pre>
 *
@@ -88,6 +89,7 @@ static void XSecure_RsaMod32Inverse(const XSecure_Rsa *InstancePtr);
 static void XSecure_RsaGetData(const XSecure_Rsa *InstancePtr, u64 RdDataAddr);
 static void XSecure_RsaDataLenCfg(const XSecure_Rsa *InstancePtr, u32 Cfg0, u32 Cfg1,
 	u32 Cfg2, u32 Cfg5);
+static int XSecure_RsaRelease(const XSecure_Rsa *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -152,9 +154,44 @@ END:
 int XSecure_RsaOperation(XSecure_Rsa *InstancePtr, u64 Input,
 	u64 Result, XSecure_RsaOps RsaOp, u32 KeySize)
 {
-	int Status = XST_FAILURE;
 	volatile int ErrorCode = XST_FAILURE;
-	u32 Events;
+
+	ErrorCode = XSecure_RsaOperationStart(InstancePtr, Input, RsaOp, KeySize);
+	if (ErrorCode != XST_SUCCESS) {
+		goto END;
+	}
+
+	ErrorCode = XST_FAILURE;
+	ErrorCode = XSecure_RsaOperationWait(InstancePtr, Result);
+
+END:
+	return ErrorCode;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function loads the RSA core with the provided inputs and
+ * 			starts the public encryption or private decryption without
+ * 			waiting for it to complete. XSecure_RsaOperationWait must be
+ * 			called to collect the result and release the core.
+ *
+ * @param	InstancePtr	 Pointer to the XSecure_Rsa instance
+ * @param	Input		 Address of the buffer which contains the input
+ *				  data to be encrypted/decrypted
+ * @param	RsaOp		 Flag to inform the operation to be performed
+ * 				  is either encryption/decryption
+ * @param	KeySize		 Size of the key in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - If the operation is started
+ *	-	XSECURE_RSA_INVALID_PARAM - On invalid parameter
+ *	-	XST_FAILURE - On failure
+ *
+******************************************************************************/
+int XSecure_RsaOperationStart(XSecure_Rsa *InstancePtr, u64 Input,
+	XSecure_RsaOps RsaOp, u32 KeySize)
+{
+	volatile int ErrorCode = XST_FAILURE;
 
 	/* Validate the input arguments */
 	if (InstancePtr == NULL) {
@@ -255,7 +292,43 @@ int XSecure_RsaOperation(XSecure_Rsa *InstancePtr, u64 Input,
 				XSECURE_RSA_CONTROL_EXP);
 	}
 
-	ErrorCode = XST_FAILURE;
+	ErrorCode = XST_SUCCESS;
+	goto END;
+
+END_RST:
+	ErrorCode |= XSecure_RsaRelease(InstancePtr);
+
+END:
+	return ErrorCode;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the RSA operation started by
+ * 			XSecure_RsaOperationStart to complete, copies the result and
+ * 			releases the RSA core
+ *
+ * @param	InstancePtr	 Pointer to the XSecure_Rsa instance
+ * @param	Result		 Address of buffer where resultant
+ *				  encrypted/decrypted data to be stored
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XSECURE_RSA_INVALID_PARAM - On invalid parameter
+ *	-	XST_FAILURE - On failure
+ *
+******************************************************************************/
+int XSecure_RsaOperationWait(XSecure_Rsa *InstancePtr, u64 Result)
+{
+	int Status = XST_FAILURE;
+	volatile int ErrorCode = XST_FAILURE;
+	u32 Events;
+
+	/* Validate the input arguments */
+	if (InstancePtr == NULL) {
+		ErrorCode = (int)XSECURE_RSA_INVALID_PARAM;
+		goto END;
+	}
 
 	/* Check and wait for status */
 	Status = (int)Xil_WaitForEvents((InstancePtr->BaseAddress +
@@ -283,6 +356,29 @@ int XSecure_RsaOperation(XSecure_Rsa *InstancePtr, u64 Input,
 
 	ErrorCode = XST_SUCCESS;
 END_RST:
+	ErrorCode |= XSecure_RsaRelease(InstancePtr);
+
+END:
+	return ErrorCode;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reverts the data endianness configuration,
+ * 			zeroizes the RSA memory after a decryption and puts the RSA
+ * 			core in reset
+ *
+ * @param	InstancePtr	 Pointer to the XSecure_Rsa instance
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XSECURE_RSA_ZEROIZE_ERROR - On zeroization failure
+ *
+******************************************************************************/
+static int XSecure_RsaRelease(const XSecure_Rsa *InstancePtr)
+{
+	int Status = XST_SUCCESS;
+
 	/* Revert configuring endianness for data */
 	XSecure_WriteReg(InstancePtr->BaseAddress,
 		XSECURE_ECDSA_RSA_CFG_OFFSET,
@@ -291,14 +387,12 @@ END_RST:
 	/* Zeroize and Verify RSA memory space */
 	if (InstancePtr->EncDec == (u8)XSECURE_RSA_SIGN_DEC) {
 		Status = XSecure_RsaZeroize(InstancePtr);
-		ErrorCode |= Status;
 	}
 	/* Reset core */
 	XSecure_SetReset(InstancePtr->BaseAddress,
 			XSECURE_ECDSA_RSA_RESET_OFFSET);
 
-END:
-	return ErrorCode;
+	return Status;
 }
 
 /*****************************************************************************/
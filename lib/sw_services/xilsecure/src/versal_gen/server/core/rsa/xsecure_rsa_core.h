@@ -32,6 +32,7 @@
 * 5.0   kpt  07/24/21 Moved XSecure_RsaPublicEncrypt KAT into xsecure_kat.c
 * 5.2   kpt  08/20/23 Added prototype XSecure_RsaEcdsaZeroizeAndVerifyRam
 * 5.4   yog  04/29/24 Fixed doxygen grouping and doxygen warnings.
+* 5.5   mb   10/16/26 Added XSecure_RsaOperationStart and XSecure_RsaOperationWait
 *
 * </pre>
 *
@@ -158,6 +159,9 @@ int XSecure_RsaCfgInitialize(XSecure_Rsa *InstancePtr);
 /* Versal specific RSA core encryption/decryption function */
 int XSecure_RsaOperation(XSecure_Rsa *InstancePtr, u64 Input,
 	u64 Result, XSecure_RsaOps RsaOp, u32 KeySize);
+int XSecure_RsaOperationStart(XSecure_Rsa *InstancePtr, u64 Input,
+	XSecure_RsaOps RsaOp, u32 KeySize);
+int XSecure_RsaOperationWait(XSecure_Rsa *InstancePtr, u64 Result);
 
 /* Versal specific function for selection of PKCS padding */
 u8* XSecure_RsaGetTPadding(void);
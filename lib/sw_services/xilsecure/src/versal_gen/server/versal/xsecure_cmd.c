@@ -32,6 +32,7 @@
 *       bm   07/05/2023 Added crypto check in features command
 *       ng   07/05/2023 Added support for system device tree flow
 *       mb   07/31/2024 Added the check to validate Payload for NULL pointer
+* 5.5   mb   10/16/2026 Added XSECURE_API_CMD_BATCH command
 *
 * </pre>
 *
@@ -61,6 +62,7 @@
 #include "xsecure_cmd.h"
 #include "xplmi_ssit.h"
 #include "xsecure_cryptochk.h"
+#include "xsecure_batch_ipihandler.h"
 
 #ifdef SDT
 #include "xsecure_config.h"
@@ -99,6 +101,7 @@ static XPlmi_AccessPerm_t XSecure_AccessPermBuff[XSECURE_API_MAX] =
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_SET_DPA_CM),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_KAT),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_OPERATION),
+	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_CMD_BATCH),
 };
 
 static XPlmi_Module XPlmi_Secure =
@@ -159,6 +162,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 	 */
 	switch (ApiId) {
 	case XSECURE_API(XSECURE_API_SHA3_UPDATE):
+	case XSECURE_API(XSECURE_API_CMD_BATCH):
 #ifndef PLM_SECURE_EXCLUDE
 #ifndef PLM_RSA_EXCLUDE
 	case XSECURE_API(XSECURE_API_RSA_PRIVATE_DECRYPT):
@@ -270,6 +274,10 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 		Status = XSecure_PlatIpiHandler(Cmd);
 		break;
 #endif
+	case XSECURE_API(XSECURE_API_CMD_BATCH):
+		/**   - @ref XSecure_BatchIpiHandler */
+		Status = XSecure_BatchIpiHandler(Cmd);
+		break;
 	default:
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "CMD: INVALID PARAM\r\n");
 		Status = XST_INVALID_PARAM;
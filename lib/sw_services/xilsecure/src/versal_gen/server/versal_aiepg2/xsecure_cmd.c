@@ -17,6 +17,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 5.4   kal  07/24/24 Initial release
 *       sk   08/22/24 Added support for key transfer to ASU
+* 5.5   mb   10/16/26 Added XSECURE_API_CMD_BATCH command
 *
 * </pre>
 *
@@ -43,6 +44,7 @@
 #include "xplmi_tamper.h"
 #include "xsecure_cryptochk.h"
 #include "xsecure_plat_aes_ipihandler.h"
+#include "xsecure_batch_ipihandler.h"
 
 #ifdef SDT
 #include "xsecure_config.h"
@@ -87,6 +89,7 @@ static XPlmi_AccessPerm_t XSecure_AccessPermBuff[XSECURE_API_MAX] =
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_GEN_SHARED_SECRET),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_OPERATION_AND_ZEROIZE_KEY),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_ASU_KEY_TRANSFER),
+	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_CMD_BATCH),
 };
 
 static XPlmi_Module XPlmi_Secure =
@@ -124,6 +127,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 	case XSECURE_API(XSECURE_API_SHA_UPDATE):
 	case XSECURE_API(XSECURE_API_SHA_INIT):
 	case XSECURE_API(XSECURE_API_SHA_FINISH):
+	case XSECURE_API(XSECURE_API_CMD_BATCH):
 #ifndef PLM_SECURE_EXCLUDE
 #ifndef PLM_RSA_EXCLUDE
 	case XSECURE_API(XSECURE_API_RSA_PRIVATE_DECRYPT):
@@ -240,6 +244,10 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 		XSecure_Printf(DEBUG_PRINT_ALWAYS, "CMD: XSECURE_API_ASU_KEY_TRANSFER\r\n");
 		break;
 
+	case XSECURE_API(XSECURE_API_CMD_BATCH):
+		Status = XSecure_BatchIpiHandler(Cmd);
+		break;
+
 	default:
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "CMD: INVALID PARAM\r\n");
 		Status = XST_INVALID_PARAM;
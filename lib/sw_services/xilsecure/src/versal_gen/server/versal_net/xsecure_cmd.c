@@ -36,6 +36,7 @@
 * 5.3   har  02/06/2024 Added support for AES operation and zeroize key
 * 5.4   kpt  06/13/2024 Added XSECURE_API_RSA_RELEASE_KEY
 *       mb   07/31/2024 Added the check to validate Payload for NULL pointer
+* 5.5   mb   10/16/2026 Added XSECURE_API_CMD_BATCH command
 *
 * </pre>
 *
@@ -63,6 +64,7 @@
 #include "xplmi_tamper.h"
 #include "xsecure_cryptochk.h"
 #include "xsecure_plat_aes_ipihandler.h"
+#include "xsecure_batch_ipihandler.h"
 
 #ifdef SDT
 #include "xsecure_config.h"
@@ -114,6 +116,7 @@ static XPlmi_AccessPerm_t XSecure_AccessPermBuff[XSECURE_API_MAX] =
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_KEY_UNWRAP),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_OPERATION_AND_ZEROIZE_KEY),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_RSA_RELEASE_KEY),
+	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_CMD_BATCH),
 };
 
 static XPlmi_Module XPlmi_Secure =
@@ -149,6 +152,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 
 	switch (ApiId) {
 	case XSECURE_API(XSECURE_API_SHA3_UPDATE):
+	case XSECURE_API(XSECURE_API_CMD_BATCH):
 #ifndef PLM_SECURE_EXCLUDE
 #ifndef PLM_RSA_EXCLUDE
 	case XSECURE_API(XSECURE_API_RSA_PRIVATE_DECRYPT):
@@ -290,6 +294,9 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 	case XSECURE_API(XSECURE_API_AES_PERFORM_OPERATION_AND_ZEROIZE_KEY):
 		Status = XSecure_PlatAesIpiHandler(Cmd);
 		break;
+	case XSECURE_API(XSECURE_API_CMD_BATCH):
+		Status = XSecure_BatchIpiHandler(Cmd);
+		break;
 	default:
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "CMD: INVALID PARAM\r\n");
 		Status = XST_INVALID_PARAM;